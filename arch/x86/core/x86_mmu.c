@@ -1054,6 +1054,120 @@ out:
 	return ret;
 }
 
+#ifdef CONFIG_X86_MMU_HUGE_PAGES
+#define HUGE_PAGE_SIZE	MB(2)
+
+/* Page tables displaced by huge page mappings, one per huge page of the
+ * kernel's address space, so that they can be linked back in when the
+ * mappings are removed. 0 if the huge page is not mapped.
+ */
+static pentry_t huge_page_tables[CONFIG_KERNEL_VM_SIZE / HUGE_PAGE_SIZE];
+
+/* Get the page directory entry covering @virt, NULL if an upper level
+ * table is missing or is itself a leaf
+ */
+__pinned_func
+static pentry_t *pde_ptr_get(pentry_t *ptables, void *virt)
+{
+	pentry_t *table = ptables;
+
+	for (int level = 0; level < PDE_LEVEL; level++) {
+		pentry_t entry = get_entry(table, virt, level);
+
+		if (((entry & MMU_P) == 0U) || is_leaf(level, entry)) {
+			return NULL;
+		}
+		table = next_table(entry, level);
+	}
+
+	return get_entry_ptr(table, virt, PDE_LEVEL);
+}
+
+/**
+ * Update a whole huge page of a mapping at once
+ *
+ * New mappings of at least a huge page, with aligned virtual and physical
+ * addresses, are set up as a single page directory entry instead of a page
+ * table, provided the page table maps nothing yet. Huge pages set up this
+ * way are updated or unmapped as a whole.
+ *
+ * Arguments are those of range_map_ptables(), for the part of the region
+ * not yet processed.
+ *
+ * @retval true if the huge page at @p virt was updated
+ * @retval false if @p virt must be updated a page at a time
+ */
+__pinned_func
+static bool huge_page_map_set(pentry_t *ptables, uint8_t *virt, uintptr_t phys,
+			      size_t size, pentry_t entry_flags, pentry_t mask,
+			      uint32_t options)
+{
+	size_t index = (POINTER_TO_UINT(virt) - POINTER_TO_UINT(Z_VIRT_RAM_START)) /
+		       HUGE_PAGE_SIZE;
+	pentry_t *pde, *pt;
+
+	if ((size < HUGE_PAGE_SIZE) ||
+	    ((POINTER_TO_UINT(virt) % HUGE_PAGE_SIZE) != 0U) ||
+	    (virt < Z_VIRT_RAM_START) ||
+	    ((virt + HUGE_PAGE_SIZE) > Z_VIRT_RAM_END) ||
+	    ((options & OPTION_RESET) != 0U)) {
+		return false;
+	}
+
+	pde = pde_ptr_get(ptables, virt);
+	if (pde == NULL) {
+		return false;
+	}
+
+	if ((*pde & MMU_PS) != 0U) {
+		if (huge_page_tables[index] == 0U) {
+			/* Not set up by us */
+			return false;
+		}
+
+		if ((options & OPTION_CLEAR) != 0U) {
+			/* The page table was left empty, linking it back in
+			 * un-maps the whole huge page.
+			 */
+			*pde = huge_page_tables[index];
+			huge_page_tables[index] = 0U;
+		} else {
+			if (((mask & paging_levels[PTE_LEVEL].mask) != 0U) &&
+			    ((phys % HUGE_PAGE_SIZE) != 0U)) {
+				return false;
+			}
+			*pde = (*pde & ~mask) | ((phys | entry_flags) & mask) |
+			       MMU_PS;
+		}
+		tlb_flush_page(virt);
+
+		return true;
+	}
+
+	if (((options & OPTION_CLEAR) != 0U) || (mask != MASK_ALL) ||
+	    ((phys % HUGE_PAGE_SIZE) != 0U) || ((*pde & MMU_P) == 0U)) {
+		return false;
+	}
+
+	pt = next_table(*pde, PDE_LEVEL);
+	for (size_t i = 0; i < get_num_entries(PTE_LEVEL); i++) {
+		if (pt[i] != 0U) {
+			return false;
+		}
+	}
+
+	huge_page_tables[index] = *pde;
+	*pde = (pentry_t)phys | entry_flags | MMU_PS;
+
+	/* The page directory entry may be cached as pointing to the page
+	 * table
+	 */
+	tlb_flush_page(virt);
+
+	return true;
+}
+#endif /* CONFIG_X86_MMU_HUGE_PAGES */
+
 /**
  * Map a physical region in a specific set of page tables.
  *
@@ -1090,6 +1204,7 @@ static int range_map_ptables(pentry_t *ptables, void *virt, uintptr_t phys,
 			     uint32_t options)
 {
 	bool zero_entry = (options & (OPTION_RESET | OPTION_CLEAR)) != 0U;
+	size_t step = CONFIG_MMU_PAGE_SIZE;
 	int ret = 0, ret2;
 
 	CHECKIF(!is_addr_aligned(phys) || !is_size_aligned(size)) {
@@ -1108,10 +1223,20 @@ static int range_map_ptables(pentry_t *ptables, void *virt, uintptr_t phys,
 	 * We do a full page table walk for every page we are updating.
 	 * Recursive approaches are possible, but use much more stack space.
 	 */
-	for (size_t offset = 0; offset < size; offset += CONFIG_MMU_PAGE_SIZE) {
+	for (size_t offset = 0; offset < size; offset += step) {
 		uint8_t *dest_virt = (uint8_t *)virt + offset;
 		pentry_t entry_val;
 
+		step = CONFIG_MMU_PAGE_SIZE;
+#ifdef CONFIG_X86_MMU_HUGE_PAGES
+		if (huge_page_map_set(ptables, dest_virt, phys + offset,
+				      size - offset, entry_flags, mask,
+				      options)) {
+			step = HUGE_PAGE_SIZE;
+			continue;
+		}
+#endif /* CONFIG_X86_MMU_HUGE_PAGES */
+
 		if (zero_entry) {
 			entry_val = 0;
 		} else {
@@ -1281,10 +1406,20 @@ static pentry_t flags_to_entry(uint32_t flags)
 __pinned_func
 void arch_mem_map(void *virt, uintptr_t phys, size_t size, uint32_t flags)
 {
+	uint32_t options = 0U;
 	int ret;
 
+#ifdef CONFIG_X86_MMU_HUGE_PAGES
+	/* Other CPUs may have cached the page directory entries that
+	 * huge pages replace
+	 */
+	if (size >= HUGE_PAGE_SIZE) {
+		options |= OPTION_FLUSH;
+	}
+#endif /* CONFIG_X86_MMU_HUGE_PAGES */
+
 	ret = range_map_unlocked(virt, phys, size, flags_to_entry(flags),
-				 MASK_ALL, 0);
+				 MASK_ALL, options);
 	__ASSERT_NO_MSG(ret == 0);
 	ARG_UNUSED(ret);
 }
@@ -2063,7 +2198,10 @@ int arch_page_phys_get(void *virt, uintptr_t *phys)
 
 	if ((pte & MMU_P) != 0) {
 		if (phys != NULL) {
-			*phys = (uintptr_t)get_entry_phys(pte, PTE_LEVEL);
+			/* Large pages map more than the page at virt */
+			*phys = (uintptr_t)get_entry_phys(pte, PTE_LEVEL) +
+				(POINTER_TO_UINT(virt) &
+				 (get_entry_scope(level) - 1));
 		}
 		ret = 0;
 	} else {
@@ -2214,6 +2352,17 @@ enum arch_page_location arch_page_location_get(void *addr, uintptr_t *location)
 	}
 }
 
+#ifdef CONFIG_X86_MMU_HUGE_PAGES
+size_t arch_virt_region_align(uintptr_t phys, size_t size)
+{
+	if ((size >= HUGE_PAGE_SIZE) && ((phys % HUGE_PAGE_SIZE) == 0U)) {
+		return HUGE_PAGE_SIZE;
+	}
+
+	return CONFIG_MMU_PAGE_SIZE;
+}
+#endif /* CONFIG_X86_MMU_HUGE_PAGES */
+
 #ifdef CONFIG_X86_KPTI
 __pinned_func
 bool z_x86_kpti_is_access_ok(void *addr, pentry_t *ptables)
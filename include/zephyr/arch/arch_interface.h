@@ -495,6 +495,17 @@ static inline uint32_t arch_proc_id(void);
  */
 void arch_sched_ipi(void);
 
+/**
+ * Send an interrupt to the CPUs in @a cpu_bitmap
+ *
+ * This will invoke z_sched_ipi() on the CPUs whose bits are set in
+ * @a cpu_bitmap.  The bit of the calling CPU is ignored.  Only
+ * available when CONFIG_ARCH_HAS_DIRECTED_IPIS is selected.
+ *
+ * @param cpu_bitmap Bitmap of the CPUs to interrupt, bit N is CPU N
+ */
+void arch_sched_directed_ipi(uint32_t cpu_bitmap);
+
 
 int arch_smp_init(void);
 
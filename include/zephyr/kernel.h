@@ -257,6 +257,9 @@ void k_thread_foreach_unlocked(
  * Relevant stack creation flags include:
  * - @ref K_USER allocate a userspace thread (requires `CONFIG_USERSPACE=y`)
  *
+ * Pre-allocated stacks are taken from the smallest pool that fits @p size,
+ * the most recently released stack first.
+ *
  * @param size Stack size in bytes.
  * @param flags Stack creation flags, or 0.
  *
@@ -953,6 +956,59 @@ int k_thread_cpu_mask_disable(k_tid_t thread, int cpu);
 int k_thread_cpu_pin(k_tid_t thread, int cpu);
 #endif
 
+#if defined(CONFIG_CPU_DOMAINS) || defined(__DOXYGEN__)
+/** Domain hint of a thread that may run in any cache domain. */
+#define K_CPU_DOMAIN_ANY (-1)
+
+/**
+ * @brief Get the cache domain of a CPU
+ *
+ * CPUs sharing a cache, as described by the next-level-cache property
+ * of the devicetree cpus nodes, belong to the same domain.  Domains
+ * are numbered from zero.
+ *
+ * @note You should enable @kconfig{CONFIG_CPU_DOMAINS} in your project
+ * configuration.
+ *
+ * @param cpu CPU index
+ * @return Domain of the CPU, or -EINVAL if @a cpu is out of range
+ */
+int k_cpu_domain_get(int cpu);
+
+/**
+ * @brief Get the cache domain of the current CPU
+ *
+ * Unless the caller runs with interrupts locked or is pinned to a
+ * CPU, it may have migrated by the time the value is used, so treat
+ * it as a hint.
+ *
+ * @return Domain of the CPU the caller runs on
+ */
+int k_cpu_domain_current(void);
+
+/**
+ * @brief Get the number of cache domains
+ *
+ * @return Number of cache domains, at least one
+ */
+int k_cpu_domain_count(void);
+
+/**
+ * @brief Set the cache domain a thread prefers to run in
+ *
+ * With @kconfig{CONFIG_SCHED_PER_CPU_RUNQ}, a thread with a domain hint
+ * is queued on a CPU of that domain when it becomes runnable, and
+ * CPUs prefer stealing threads from peers in their own domain.  The
+ * hint never overrides priority order nor the thread's CPU mask.  The
+ * thread must not be currently runnable.
+ *
+ * @param thread Thread to operate upon
+ * @param domain Domain index, or K_CPU_DOMAIN_ANY to clear the hint
+ * @return Zero on success, otherwise error code
+ */
+int k_thread_domain_set(k_tid_t thread, int domain);
+#endif /* CONFIG_CPU_DOMAINS */
+
 /**
  * @brief Suspend a thread.
  *
@@ -1573,6 +1629,29 @@ void k_timer_init(struct k_timer *timer,
 __syscall void k_timer_start(struct k_timer *timer,
 			     k_timeout_t duration, k_timeout_t period);
 
+/**
+ * @brief Start a timer with slack.
+ *
+ * This routine behaves like k_timer_start(), but lets each expiry of the
+ * timer be delayed by up to @a slack.  A timer whose window is open when
+ * the system clock is announced for another reason expires along with
+ * it, so that timers with overlapping windows share a single wakeup from
+ * idle.  Periodic expiries keep their nominal stride, the delay of one
+ * expiry does not accumulate into the next.
+ *
+ * k_timer_remaining_get() and k_timer_expires_ticks() report the latest
+ * tick at which the timer may expire.
+ *
+ * Slack is ignored unless @kconfig{CONFIG_TIMEOUT_SLACK} is enabled.
+ *
+ * @param timer     Address of timer.
+ * @param duration  Initial timer duration.
+ * @param period    Timer period.
+ * @param slack     Maximum delay of each expiry, a relative timeout.
+ */
+__syscall void k_timer_start_slack(struct k_timer *timer, k_timeout_t duration,
+				   k_timeout_t period, k_timeout_t slack);
+
 /**
  * @brief Stop a timer.
  *
@@ -1841,6 +1920,11 @@ struct k_queue {
 
 	Z_DECL_POLL_EVENT
 
+#ifdef CONFIG_QUEUE_LOCKFREE
+	/* Lock-free append list, newest first, with Z_QUEUE_LF_* flags */
+	atomic_t lf_head;
+#endif /* CONFIG_QUEUE_LOCKFREE */
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_queue)
 };
 
@@ -1848,6 +1932,12 @@ struct k_queue {
  * @cond INTERNAL_HIDDEN
  */
 
+/* A thread is (or was) pending on the queue: appends must take the lock */
+#define Z_QUEUE_LF_WAITERS	BIT(0)
+/* The queue has been polled: appends must take the lock */
+#define Z_QUEUE_LF_POLLED	BIT(1)
+#define Z_QUEUE_LF_FLAGS	(Z_QUEUE_LF_WAITERS | Z_QUEUE_LF_POLLED)
+
 #define Z_QUEUE_INITIALIZER(obj) \
 	{ \
 	.data_q = SYS_SFLIST_STATIC_INIT(&obj.data_q), \
@@ -2077,6 +2167,12 @@ __syscall int k_queue_is_empty(struct k_queue *queue);
 
 static inline int z_impl_k_queue_is_empty(struct k_queue *queue)
 {
+#ifdef CONFIG_QUEUE_LOCKFREE
+	if ((atomic_get(&queue->lf_head) & ~(atomic_val_t)Z_QUEUE_LF_FLAGS) != 0) {
+		return 0;
+	}
+#endif /* CONFIG_QUEUE_LOCKFREE */
+
 	return (int)sys_sflist_is_empty(&queue->data_q);
 }
 
@@ -2210,6 +2306,18 @@ struct k_event {
 	_wait_q_t         wait_q;
 	uint32_t          events;
 	struct k_spinlock lock;
+#ifdef CONFIG_EVENTS_WAIT_INDEX
+	/* Waiters for a single event, by event number modulo the number
+	 * of queues. wait_q holds the other waiters.
+	 */
+	_wait_q_t         bit_wait_q[CONFIG_EVENTS_WAIT_BUCKETS];
+	/* Events awaited by the threads of wait_q, possibly more */
+	uint32_t          wait_mask;
+#endif
+#ifdef CONFIG_EVENTS_WAIT_SET
+	/* Threads waiting on several event objects */
+	sys_dlist_t       watchers;
+#endif
 
 	SYS_PORT_TRACING_TRACKING_FIELD(k_event)
 
@@ -2219,9 +2327,27 @@ struct k_event {
 
 };
 
+#ifdef CONFIG_EVENTS_WAIT_INDEX
+#define Z_EVENT_BIT_WAIT_Q_INIT(i, obj) Z_WAIT_Q_INIT(&(obj).bit_wait_q[i])
+#define Z_EVENT_WAIT_INDEX_INIT(obj) \
+	.bit_wait_q = { LISTIFY(CONFIG_EVENTS_WAIT_BUCKETS, \
+				Z_EVENT_BIT_WAIT_Q_INIT, (,), obj) },
+#else
+#define Z_EVENT_WAIT_INDEX_INIT(obj)
+#endif
+
+#ifdef CONFIG_EVENTS_WAIT_SET
+#define Z_EVENT_WAIT_SET_INIT(obj) \
+	.watchers = SYS_DLIST_STATIC_INIT(&(obj).watchers),
+#else
+#define Z_EVENT_WAIT_SET_INIT(obj)
+#endif
+
 #define Z_EVENT_INITIALIZER(obj) \
 	{ \
 	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
+	Z_EVENT_WAIT_INDEX_INIT(obj) \
+	Z_EVENT_WAIT_SET_INIT(obj) \
 	.events = 0 \
 	}
 
@@ -2345,6 +2471,44 @@ __syscall uint32_t k_event_wait(struct k_event *event, uint32_t events,
 __syscall uint32_t k_event_wait_all(struct k_event *event, uint32_t events,
 				    bool reset, k_timeout_t timeout);
 
+/**
+ * @brief Events awaited on one event object by k_event_wait_any_of_set()
+ */
+struct k_event_wait_desc {
+	/** Address of the event object */
+	struct k_event *event;
+	/** Set of desired events */
+	uint32_t events;
+	/** Set of matching events, on return */
+	uint32_t matched;
+};
+
+/**
+ * @brief Wait for any of the specified events on several event objects
+ *
+ * This routine waits until any of the desired events of any of the
+ * descriptors in @a descs have been delivered to their event object, or
+ * the maximum wait time @a timeout has expired. On return, the @a matched
+ * field of each descriptor holds the desired events present in its event
+ * object when the thread was woken up.
+ *
+ * @note @kconfig{CONFIG_EVENTS_WAIT_SET} must be selected for this
+ * function to be available.
+ *
+ * @param descs Array of wait descriptors
+ * @param num_descs Number of descriptors, at most
+ *                  @kconfig{CONFIG_EVENTS_WAIT_SET_MAX}
+ * @param timeout Waiting period for the desired events or one of the
+ *                special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Index of the first descriptor with matching events
+ * @retval -EAGAIN if no matching events were received within the
+ *                 specified time
+ * @retval -EINVAL if @a num_descs is 0 or too large
+ */
+__syscall int k_event_wait_any_of_set(struct k_event_wait_desc *descs,
+				      size_t num_descs, k_timeout_t timeout);
+
 /**
  * @brief Test the events currently tracked in the event object
  *
@@ -3647,6 +3811,50 @@ int k_work_schedule_for_queue(struct k_work_q *queue,
 int k_work_schedule(struct k_work_delayable *dwork,
 				   k_timeout_t delay);
 
+/** @brief Submit an idle work item to a queue after a delay, with slack.
+ *
+ * This behaves like k_work_schedule_for_queue(), but lets the submission
+ * be delayed by up to @p slack past @p delay so that it can share a
+ * wakeup from idle with other timeouts whose windows overlap.
+ * k_work_delayable_remaining_get() reports the latest tick at which the
+ * item may be submitted.
+ *
+ * Slack is ignored unless @kconfig{CONFIG_TIMEOUT_SLACK} is enabled.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue the queue on which the work item should be submitted after the
+ * delay.
+ *
+ * @param dwork pointer to the delayable work item.
+ *
+ * @param delay the time to wait before submitting the work item.
+ *
+ * @param slack the maximum additional delay, a relative timeout.
+ *
+ * @return as with k_work_schedule_for_queue().
+ */
+int k_work_schedule_for_queue_slack(struct k_work_q *queue,
+				    struct k_work_delayable *dwork,
+				    k_timeout_t delay, k_timeout_t slack);
+
+/** @brief Submit an idle work item to the system work queue after a
+ * delay, with slack.
+ *
+ * This is a thin wrapper around k_work_schedule_for_queue_slack(), with all
+ * the API characteristics of that function.
+ *
+ * @param dwork pointer to the delayable work item.
+ *
+ * @param delay the time to wait before submitting the work item.
+ *
+ * @param slack the maximum additional delay, a relative timeout.
+ *
+ * @return as with k_work_schedule_for_queue().
+ */
+int k_work_schedule_slack(struct k_work_delayable *dwork, k_timeout_t delay,
+			  k_timeout_t slack);
+
 /** @brief Reschedule a work item to a queue after a delay.
  *
  * Unlike k_work_schedule_for_queue() this function can change the deadline of
@@ -3940,6 +4148,12 @@ struct k_work_delayable {
 struct z_work_flusher {
 	struct k_work work;
 	struct k_sem sem;
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* The item being flushed: the flusher must not complete on one
+	 * worker while the item still runs on another.
+	 */
+	struct k_work *target;
+#endif /* CONFIG_WORKQUEUE_POOL */
 };
 
 /* Record used to wait for work to complete a cancellation.
@@ -3978,6 +4192,42 @@ struct k_work_sync {
 	};
 };
 
+#if defined(CONFIG_WORKQUEUE_POOL) || defined(__DOXYGEN__)
+/** @brief Threads and stacks for the additional workers of a work queue.
+ *
+ * Use K_WORK_QUEUE_WORKERS_DEFINE() to define one.
+ */
+struct k_work_queue_workers {
+	/** Worker threads. */
+	struct k_thread *threads;
+	/** First of the worker stacks. */
+	k_thread_stack_t *stacks;
+	/** Distance between consecutive stacks, in bytes. */
+	size_t stack_len;
+	/** Usable size of each stack, in bytes. */
+	size_t stack_size;
+	/** Number of threads and stacks. */
+	uint8_t count;
+};
+
+/** @brief Statically define threads and stacks for work queue workers.
+ *
+ * @param name Name of the struct k_work_queue_workers to define.
+ * @param n Number of workers, in addition to the work queue thread.
+ * @param size Stack size of each worker, in bytes.
+ */
+#define K_WORK_QUEUE_WORKERS_DEFINE(name, n, size)                           \
+	static K_KERNEL_STACK_ARRAY_DEFINE(_k_work_q_stacks_##name, n, size); \
+	static struct k_thread _k_work_q_threads_##name[n];                   \
+	static struct k_work_queue_workers name = {                           \
+		.threads = _k_work_q_threads_##name,                          \
+		.stacks = _k_work_q_stacks_##name[0],                         \
+		.stack_len = sizeof(_k_work_q_stacks_##name[0]),              \
+		.stack_size = K_KERNEL_STACK_SIZEOF(_k_work_q_stacks_##name[0]), \
+		.count = n,                                                   \
+	}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 /** @brief A structure holding optional configuration items for a work
  * queue.
  *
@@ -4004,6 +4254,31 @@ struct k_work_queue_config {
 	 * control.
 	 */
 	bool no_yield;
+
+#if defined(CONFIG_WORKQUEUE_POOL) || defined(__DOXYGEN__)
+	/** Total number of threads servicing the queue, including the
+	 * work queue thread itself.
+	 *
+	 * Values of 0 and 1 both give the historical single thread
+	 * queue.  Additional threads are taken from @c workers.  A
+	 * single work item never runs on two workers at the same time,
+	 * but distinct items submitted to the queue may run
+	 * concurrently and complete out of submission order.
+	 */
+	uint8_t num_workers;
+
+	/** Threads and stacks for the additional workers, as defined by
+	 * K_WORK_QUEUE_WORKERS_DEFINE().  Must provide at least
+	 * @c num_workers - 1 of them.
+	 */
+	struct k_work_queue_workers *workers;
+
+	/** Pin worker @c n to CPU @c n modulo the number of CPUs.
+	 *
+	 * Requires CONFIG_SCHED_CPU_MASK, ignored otherwise.
+	 */
+	bool pin_workers;
+#endif /* CONFIG_WORKQUEUE_POOL */
 };
 
 /** @brief A structure used to hold work until it can be processed. */
@@ -4026,6 +4301,17 @@ struct k_work_q {
 
 	/* Flags describing queue state. */
 	uint32_t flags;
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* Additional threads animating the work. */
+	struct k_work_queue_workers *workers;
+
+	/* Number of threads animating the work, including thread. */
+	uint8_t num_workers;
+
+	/* Number of threads running a work item. */
+	uint8_t busy;
+#endif /* CONFIG_WORKQUEUE_POOL */
 };
 
 /* Provide the implementation for inline functions declared above */
@@ -4569,6 +4855,34 @@ int k_msgq_cleanup(struct k_msgq *msgq);
  */
 __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout);
 
+/**
+ * @brief Send several messages to a message queue.
+ *
+ * This routine sends up to @a num_msgs messages, stored back to back at
+ * @a data, to message queue @a msgq in a single critical section.  Waiting
+ * receivers are handed their message directly, the rest are copied into
+ * the ring buffer with at most two contiguous copies, and pending threads
+ * and poll events are signaled once for the whole batch.
+ *
+ * The routine only waits when not even the first message can be sent,
+ * in which case it sends that single message once room is available.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Pointer to the messages.
+ * @param num_msgs Number of messages at @a data.
+ * @param timeout Non-negative waiting period to send the first message,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @return Number of messages sent, at least one unless @a num_msgs is 0.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_msgq_put_n(struct k_msgq *msgq, const void *data,
+			   uint32_t num_msgs, k_timeout_t timeout);
+
 /**
  * @brief Receive a message from a message queue.
  *
@@ -4591,6 +4905,38 @@ __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t time
  */
 __syscall int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout);
 
+/**
+ * @brief Receive several messages from a message queue.
+ *
+ * This routine receives up to @a num_msgs messages from message queue
+ * @a msgq in a "first in, first out" manner, storing them back to back at
+ * @a data, in a single critical section.  Messages are copied out of the
+ * ring buffer with at most two contiguous copies per pass, threads waiting
+ * to send refill the freed space, and they are rescheduled once for the
+ * whole batch.
+ *
+ * The routine only waits when the queue is empty, in which case it
+ * receives the next single message sent.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of area to hold up to @a num_msgs messages.
+ * @param num_msgs Maximum number of messages to receive.
+ * @param timeout Waiting period to receive the first message,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @return Number of messages received, at least one unless @a num_msgs
+ *         is 0.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_msgq_get_n(struct k_msgq *msgq, void *data, uint32_t num_msgs,
+			   k_timeout_t timeout);
+
 /**
  * @brief Peek/read a message from a message queue.
  *
@@ -4852,11 +5198,15 @@ struct k_pipe {
 	size_t         bytes_used;      /**< # bytes used in buffer */
 	size_t         read_index;      /**< Where in buffer to read from */
 	size_t         write_index;     /**< Where in buffer to write */
+	size_t         put_claimed;     /**< # bytes claimed for writing */
+	size_t         get_claimed;     /**< # bytes claimed for reading */
 	struct k_spinlock lock;		/**< Synchronization lock */
 
 	struct {
 		_wait_q_t      readers; /**< Reader wait queue */
 		_wait_q_t      writers; /**< Writer wait queue */
+		_wait_q_t      claim_readers; /**< Read claim wait queue */
+		_wait_q_t      claim_writers; /**< Write claim wait queue */
 	} wait_q;			/** Wait queue */
 
 	Z_DECL_POLL_EVENT
@@ -4882,10 +5232,14 @@ struct k_pipe {
 	.bytes_used = 0,                                            \
 	.read_index = 0,                                            \
 	.write_index = 0,                                           \
+	.put_claimed = 0,                                           \
+	.get_claimed = 0,                                           \
 	.lock = {},                                                 \
 	.wait_q = {                                                 \
 		.readers = Z_WAIT_Q_INIT(&obj.wait_q.readers),       \
-		.writers = Z_WAIT_Q_INIT(&obj.wait_q.writers)        \
+		.writers = Z_WAIT_Q_INIT(&obj.wait_q.writers),       \
+		.claim_readers = Z_WAIT_Q_INIT(&obj.wait_q.claim_readers), \
+		.claim_writers = Z_WAIT_Q_INIT(&obj.wait_q.claim_writers), \
 	},                                                          \
 	Z_POLL_EVENT_OBJ_INIT(obj)                                   \
 	.flags = 0,                                                 \
@@ -5047,6 +5401,103 @@ __syscall void k_pipe_flush(struct k_pipe *pipe);
  */
 __syscall void k_pipe_buffer_flush(struct k_pipe *pipe);
 
+/**
+ * @brief Claim contiguous space in a pipe's buffer for writing
+ *
+ * This routine gives the caller direct access to up to @a size bytes of free
+ * space in the pipe's ring buffer, starting at the current write position.
+ * The space is contiguous, so fewer bytes than requested may be claimed when
+ * the free space wraps around the end of the buffer. If the buffer is full,
+ * the routine waits for a reader to make room.
+ *
+ * The data placed in the claimed space becomes visible to readers once
+ * k_pipe_put_finish() is called. Only one write claim may be outstanding at
+ * a time; until it is finished, k_pipe_put() does not write to the pipe.
+ *
+ * The buffer is kernel memory, so this routine may only be called from
+ * supervisor mode.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Address of area to hold the start of the claimed space.
+ * @param size Maximum number of bytes to claim.
+ * @param timeout Waiting period to wait for free space,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of bytes claimed (greater than zero) on success.
+ * @retval -EINVAL invalid parameters supplied
+ * @retval -ENOTSUP the pipe has no buffer
+ * @retval -EBUSY another write claim is outstanding
+ * @retval -EIO Returned without waiting; the buffer is full.
+ * @retval -EAGAIN Waiting period timed out; the buffer is full.
+ */
+int k_pipe_put_claim(struct k_pipe *pipe, void **data, size_t size,
+		     k_timeout_t timeout);
+
+/**
+ * @brief Commit data written to a claimed area of a pipe's buffer
+ *
+ * This routine ends the write claim made by k_pipe_put_claim() and makes the
+ * first @a size bytes of the claimed space available to readers. Waiting
+ * readers are woken and poll events signaled as if the data had been written
+ * by k_pipe_put().
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes written, which may be zero.
+ *
+ * @retval 0 on success
+ * @retval -EINVAL no write claim is outstanding, or @a size exceeds the
+ *         claimed size
+ */
+int k_pipe_put_finish(struct k_pipe *pipe, size_t size);
+
+/**
+ * @brief Claim contiguous data in a pipe's buffer for reading
+ *
+ * This routine gives the caller direct access to up to @a size bytes of data
+ * in the pipe's ring buffer, starting at the current read position. The data
+ * is contiguous, so fewer bytes than requested may be claimed when it wraps
+ * around the end of the buffer. If the buffer is empty, the routine waits for
+ * a writer to provide data.
+ *
+ * The claimed data stays in the pipe until k_pipe_get_finish() is called.
+ * Only one read claim may be outstanding at a time; until it is finished,
+ * k_pipe_get() does not read from the pipe.
+ *
+ * The buffer is kernel memory, so this routine may only be called from
+ * supervisor mode.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Address of area to hold the start of the claimed data.
+ * @param size Maximum number of bytes to claim.
+ * @param timeout Waiting period to wait for data,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of bytes claimed (greater than zero) on success.
+ * @retval -EINVAL invalid parameters supplied
+ * @retval -ENOTSUP the pipe has no buffer
+ * @retval -EBUSY another read claim is outstanding
+ * @retval -EIO Returned without waiting; the buffer is empty.
+ * @retval -EAGAIN Waiting period timed out; the buffer is empty.
+ */
+int k_pipe_get_claim(struct k_pipe *pipe, void **data, size_t size,
+		     k_timeout_t timeout);
+
+/**
+ * @brief Release data read from a claimed area of a pipe's buffer
+ *
+ * This routine ends the read claim made by k_pipe_get_claim() and removes the
+ * first @a size bytes of the claimed data from the pipe. Waiting writers are
+ * woken as if the data had been read by k_pipe_get().
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes consumed, which may be zero.
+ *
+ * @retval 0 on success
+ * @retval -EINVAL no read claim is outstanding, or @a size exceeds the
+ *         claimed size
+ */
+int k_pipe_get_finish(struct k_pipe *pipe, size_t size);
+
 /** @} */
 
 /**
@@ -5064,6 +5515,7 @@ struct k_mem_slab_info {
 
 struct k_mem_slab {
 	_wait_q_t wait_q;
+	_wait_q_t batch_wait_q;
 	struct k_spinlock lock;
 	char *buffer;
 	char *free_list;
@@ -5080,6 +5532,7 @@ struct k_mem_slab {
 			       _slab_num_blocks)                      \
 	{                                                             \
 	.wait_q = Z_WAIT_Q_INIT(&(_slab).wait_q),                     \
+	.batch_wait_q = Z_WAIT_Q_INIT(&(_slab).batch_wait_q),         \
 	.lock = {},                                                   \
 	.buffer = _slab_buffer,                                       \
 	.free_list = NULL,                                            \
@@ -5210,6 +5663,52 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem,
  */
 void k_mem_slab_free(struct k_mem_slab *slab, void *mem);
 
+/**
+ * @brief Allocate multiple blocks from a memory slab.
+ *
+ * This routine allocates up to @a count memory blocks from a memory slab,
+ * taking the slab lock once for all blocks that are immediately available.
+ * Without waiting, as many blocks as are available are allocated.
+ * Otherwise either all @a count blocks are allocated or none: the caller
+ * waits for up to @a timeout until @a count blocks are free at once,
+ * without holding on to any of them meanwhile.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ * @note When CONFIG_MULTITHREADING=n any @a timeout is treated as K_NO_WAIT.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param slab Address of the memory slab.
+ * @param mem Array of at least @a count block addresses, filled in from
+ *        index 0.
+ * @param count Number of blocks requested.
+ * @param timeout Non-negative waiting period to wait for operation to complete.
+ *        Use K_NO_WAIT to return without waiting,
+ *        or K_FOREVER to wait as long as necessary.
+ *
+ * @return Number of blocks allocated, which may be less than @a count
+ *         only with K_NO_WAIT.
+ * @retval -ENOMEM Returned without waiting and no block was allocated.
+ * @retval -EAGAIN Waiting period timed out and no block was allocated.
+ * @retval -EINVAL @a count is larger than the number of blocks of the slab.
+ */
+int k_mem_slab_alloc_n(struct k_mem_slab *slab, void **mem, uint32_t count,
+		       k_timeout_t timeout);
+
+/**
+ * @brief Free multiple blocks allocated from a memory slab.
+ *
+ * This routine releases @a count memory blocks back to their memory slab
+ * under a single lock acquisition. Blocks are handed directly to threads
+ * waiting on the slab, if any.
+ *
+ * @param slab Address of the memory slab.
+ * @param mem Array of @a count block addresses, as returned by
+ *        k_mem_slab_alloc() or k_mem_slab_alloc_n().
+ * @param count Number of blocks to release.
+ */
+void k_mem_slab_free_n(struct k_mem_slab *slab, void **mem, uint32_t count);
+
 /**
  * @brief Get the number of used blocks in a memory slab.
  *
@@ -5289,6 +5788,216 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab);
 
 /** @} */
 
+#if defined(CONFIG_MEM_CACHE) || defined(__DOXYGEN__)
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+/* Objects of one size class cached by one CPU */
+struct k_mem_cache_mag {
+	/* Uncontended unless another CPU flushes this magazine */
+	struct k_spinlock lock;
+	uint16_t count;
+	void *objs[MAX(CONFIG_MEM_CACHE_PER_CPU_DEPTH, 1)];
+};
+
+/*
+ * Statistics of a memory cache, or of one of its size classes. For a size
+ * class, hits, misses and fallbacks count the allocations it served, and
+ * failures those for which it was the best fit.
+ */
+struct k_mem_cache_info {
+	/** Allocations served from a per-CPU cache */
+	uint32_t hits;
+	/** Allocations served from a slab */
+	uint32_t misses;
+	/** Allocations served by a larger class than the best fit */
+	uint32_t fallbacks;
+	/** Allocations that failed */
+	uint32_t failures;
+};
+
+struct k_mem_cache_class {
+	struct k_mem_slab *slab;
+#if CONFIG_MEM_CACHE_PER_CPU_DEPTH > 0
+	struct k_mem_cache_mag mags[CONFIG_MP_MAX_NUM_CPUS];
+	/* Threads about to wait or waiting on the slab */
+	atomic_t waiters;
+#endif
+
+#ifdef CONFIG_OBJ_CORE_STATS_MEM_CACHE
+	struct k_mem_cache_info cpu_info[CONFIG_MP_MAX_NUM_CPUS];
+	struct k_mem_cache_info info;
+#endif
+
+#ifdef CONFIG_OBJ_CORE_MEM_CACHE
+	struct k_obj_core obj_core;
+#endif
+};
+
+struct k_mem_cache {
+	struct k_mem_cache_class *classes;
+	uint8_t num_classes;
+	/* Index of the first class that may fit a request of
+	 * (2^(n-1), 2^n] bytes, for O(1) best fit lookups.
+	 */
+	uint8_t order_class[sizeof(size_t) * 8 + 1];
+	void (*ctor)(void *obj, size_t size);
+	void (*dtor)(void *obj, size_t size);
+
+#ifdef CONFIG_OBJ_CORE_STATS_MEM_CACHE
+	struct k_mem_cache_info cpu_info[CONFIG_MP_MAX_NUM_CPUS];
+	struct k_mem_cache_info info;
+#endif
+
+#ifdef CONFIG_OBJ_CORE_MEM_CACHE
+	struct k_obj_core obj_core;
+#endif
+};
+
+#define Z_MEM_CACHE_CLASS_INIT(_slab) { .slab = &(_slab) }
+
+#define Z_MEM_CACHE_INITIALIZER(_classes, _ctor, _dtor)            \
+	{                                                          \
+	.classes = _classes,                                       \
+	.num_classes = ARRAY_SIZE(_classes),                       \
+	.ctor = _ctor,                                             \
+	.dtor = _dtor,                                             \
+	}
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @defgroup mem_cache_apis Memory Cache APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief Statically define and initialize a memory cache.
+ *
+ * A memory cache hands out objects of variable size from a set of
+ * memory slabs, one per size class.  The slabs must have been defined
+ * with K_MEM_SLAB_DEFINE() or K_MEM_SLAB_DEFINE_STATIC() and be listed
+ * in increasing order of block size.
+ *
+ * @param name Name of the memory cache.
+ * @param cache_ctor Constructor called on objects taken from a slab, or NULL.
+ * @param cache_dtor Destructor called on objects returned to a slab, or NULL.
+ * @param ... Names of the memory slabs backing the size classes.
+ */
+#define K_MEM_CACHE_DEFINE(name, cache_ctor, cache_dtor, ...)                \
+	static struct k_mem_cache_class _k_mem_cache_classes_##name[] = {      \
+		FOR_EACH(Z_MEM_CACHE_CLASS_INIT, (,), __VA_ARGS__)             \
+	};                                                                     \
+	STRUCT_SECTION_ITERABLE(k_mem_cache, name) =                           \
+		Z_MEM_CACHE_INITIALIZER(_k_mem_cache_classes_##name,           \
+					cache_ctor, cache_dtor)
+
+/**
+ * @brief Initialize a memory cache.
+ *
+ * The @a classes array must point to initialized memory slabs, in
+ * increasing order of block size, and remain valid for the lifetime
+ * of the cache.
+ *
+ * Objects keep their constructed state while they are held in a
+ * per-CPU cache: @a ctor is only called on objects allocated from a
+ * slab and @a dtor only on objects given back to a slab.
+ *
+ * @param cache Address of the memory cache.
+ * @param classes Array of size classes.
+ * @param num_classes Number of entries in @a classes (at most 255).
+ * @param ctor Constructor called with an object and its class size, or NULL.
+ * @param dtor Destructor called with an object and its class size, or NULL.
+ *
+ * @retval 0 on success
+ * @retval -EINVAL invalid data supplied
+ */
+int k_mem_cache_init(struct k_mem_cache *cache,
+		     struct k_mem_cache_class *classes, size_t num_classes,
+		     void (*ctor)(void *obj, size_t size),
+		     void (*dtor)(void *obj, size_t size));
+
+/**
+ * @brief Allocate an object from a memory cache.
+ *
+ * The object comes from the smallest size class that fits @a size,
+ * preferably from the current CPU's cache of that class.  If that
+ * class is exhausted a larger class is used.  Only when every
+ * fitting class is exhausted does the caller wait, on the best fit
+ * class, for up to @a timeout.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param cache Address of the memory cache.
+ * @param size Number of bytes needed.
+ * @param timeout Waiting period, or one of the special values K_NO_WAIT
+ *                and K_FOREVER.
+ *
+ * @return Address of the object, or NULL on failure.
+ */
+void *k_mem_cache_alloc(struct k_mem_cache *cache, size_t size,
+			k_timeout_t timeout);
+
+/**
+ * @brief Free an object allocated from a memory cache.
+ *
+ * @param cache Address of the memory cache.
+ * @param obj Object returned by k_mem_cache_alloc(), or NULL.
+ */
+void k_mem_cache_free(struct k_mem_cache *cache, void *obj);
+
+/**
+ * @brief Return the objects cached by every CPU to their slabs.
+ *
+ * @param cache Address of the memory cache.
+ */
+void k_mem_cache_flush(struct k_mem_cache *cache);
+
+/**
+ * @brief Get the memory stats for a memory cache
+ *
+ * Objects held in per-CPU caches are reported as free.  These are the
+ * sums of the statistics of every size class, see
+ * k_mem_cache_class_runtime_stats_get().
+ *
+ * @param cache Address of the memory cache
+ * @param stats Pointer to memory into which to copy memory usage statistics
+ *
+ * @retval 0 Success
+ * @retval -EINVAL Any parameter points to NULL
+ */
+int k_mem_cache_runtime_stats_get(struct k_mem_cache *cache,
+				  struct sys_memory_stats *stats);
+
+/**
+ * @brief Get the memory stats for one size class of a memory cache
+ *
+ * Objects of the class held in per-CPU caches are reported as free.
+ * With CONFIG_OBJ_CORE_STATS_MEM_CACHE, these statistics, and the hit,
+ * miss, fallback and failure counts of the class, are also available
+ * through the object core of each entry of the cache's @a classes.
+ *
+ * @param cache Address of the memory cache
+ * @param cls Index of the size class, in increasing order of block size
+ * @param stats Pointer to memory into which to copy memory usage statistics
+ *
+ * @retval 0 Success
+ * @retval -EINVAL Any parameter points to NULL, or @a cls is out of range
+ */
+int k_mem_cache_class_runtime_stats_get(struct k_mem_cache *cache, size_t cls,
+					struct sys_memory_stats *stats);
+
+/** @} */
+
+#endif /* CONFIG_MEM_CACHE */
+
 /**
  * @addtogroup heap_apis
  * @{
@@ -5300,6 +6009,11 @@ struct k_heap {
 	struct sys_heap heap;
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
+#ifdef CONFIG_SYS_HEAP_CACHE
+	struct sys_heap_cache cache;
+	/* threads about to pend or pending on wait_q */
+	atomic_t waiters;
+#endif
 };
 
 /**
@@ -5826,6 +6540,158 @@ __syscall void k_poll_signal_check(struct k_poll_signal *sig,
 
 __syscall int k_poll_signal_raise(struct k_poll_signal *sig, int result);
 
+/* public - flags for k_poll_set_add() */
+
+/** Report the event once per signal rather than while its condition holds */
+#define K_POLL_SET_EDGE BIT(0)
+
+/**
+ * @brief Poll set entry
+ *
+ * Storage for one event of a poll set. Its content is private.
+ */
+struct k_poll_set_entry {
+	/** PRIVATE - DO NOT TOUCH */
+	struct k_poll_event event;
+
+	/** PRIVATE - DO NOT TOUCH */
+	sys_dnode_t ready_node;
+
+	/** PRIVATE - DO NOT TOUCH */
+	uint32_t flags;
+};
+
+/**
+ * @brief Poll set
+ *
+ * A set of poll events which stay registered with their objects across
+ * calls to k_poll_set_wait().
+ */
+struct k_poll_set {
+	/** PRIVATE - DO NOT TOUCH */
+	struct z_poller poller;
+
+	/** PRIVATE - DO NOT TOUCH */
+	_wait_q_t wait_q;
+
+	/** PRIVATE - DO NOT TOUCH */
+	sys_dlist_t ready;
+
+	/** PRIVATE - DO NOT TOUCH */
+	struct k_poll_set_entry *entries;
+
+	/** PRIVATE - DO NOT TOUCH */
+	int num_entries;
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#define Z_POLL_SET_INITIALIZER(obj, set_entries, set_num_entries) \
+	{ \
+	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
+	.ready = SYS_DLIST_STATIC_INIT(&obj.ready), \
+	.entries = set_entries, \
+	.num_entries = set_num_entries, \
+	}
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Statically define and initialize a poll set.
+ *
+ * The poll set can be accessed outside the module where it is defined using:
+ *
+ * @code extern struct k_poll_set <name>; @endcode
+ *
+ * @param name Name of the poll set.
+ * @param max_events Maximum number of events in the set.
+ */
+#define K_POLL_SET_DEFINE(name, max_events) \
+	static struct k_poll_set_entry _k_poll_set_entries_##name[max_events]; \
+	STRUCT_SECTION_ITERABLE(k_poll_set, name) = \
+		Z_POLL_SET_INITIALIZER(name, _k_poll_set_entries_##name, \
+				       max_events)
+
+/**
+ * @brief Initialize a poll set.
+ *
+ * @param set The poll set to initialize.
+ * @param entries Storage for the events of the set. It must not be
+ *                accessible from user mode.
+ * @param max_events Number of elements in @a entries.
+ */
+void k_poll_set_init(struct k_poll_set *set, struct k_poll_set_entry *entries,
+		     int max_events);
+
+/**
+ * @brief Add an event to a poll set.
+ *
+ * The event is registered with its object once, and stays registered until
+ * it is removed from the set. If the condition of the event is already met,
+ * the event is reported by the next k_poll_set_wait().
+ *
+ * By default an event is level triggered: every k_poll_set_wait() reports it
+ * for as long as its condition is met. With @ref K_POLL_SET_EDGE, it is
+ * reported once each time the object signals it.
+ *
+ * As with k_poll(), an object signals only one of the events registered with
+ * it at a time, and threads polling the object with k_poll() are notified
+ * before poll sets.
+ *
+ * @param set The poll set.
+ * @param type The type of event, one of the K_POLL_TYPE_xxx values other
+ *             than K_POLL_TYPE_IGNORE.
+ * @param obj Kernel object or poll signal.
+ * @param tag User tag reported with the event (8 bits).
+ * @param flags 0 or @ref K_POLL_SET_EDGE.
+ *
+ * @retval 0 The event was added.
+ * @retval -EINVAL Bad parameters.
+ * @retval -EEXIST The set already has an event of this type for @a obj.
+ * @retval -ENOMEM The set is full.
+ */
+__syscall int k_poll_set_add(struct k_poll_set *set, uint32_t type, void *obj,
+			     uint32_t tag, uint32_t flags);
+
+/**
+ * @brief Remove an event from a poll set.
+ *
+ * @param set The poll set.
+ * @param type The type of event given to k_poll_set_add().
+ * @param obj The object given to k_poll_set_add().
+ *
+ * @retval 0 The event was removed.
+ * @retval -ENOENT The set has no such event.
+ */
+__syscall int k_poll_set_remove(struct k_poll_set *set, uint32_t type,
+				void *obj);
+
+/**
+ * @brief Wait for events of a poll set to be ready
+ *
+ * This routine waits until at least one event of @a set is ready and returns
+ * the ready events only. The cost of a call depends on the number of ready
+ * events, not on the size of the set.
+ *
+ * Each event reported is written to @a events with its type, tag, object and
+ * state fields set. Events that did not fit are reported by the next call.
+ *
+ * @param set The poll set.
+ * @param events Array receiving the ready events.
+ * @param num_events Number of elements in @a events.
+ * @param timeout Waiting period for an event to be ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of events written to @a events (greater than zero).
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EINVAL Bad parameters.
+ */
+__syscall int k_poll_set_wait(struct k_poll_set *set,
+			      struct k_poll_event *events, int num_events,
+			      k_timeout_t timeout);
+
 /** @} */
 
 /**
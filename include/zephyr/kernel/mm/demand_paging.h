@@ -48,6 +48,17 @@ struct k_mem_paging_stats_t {
 		/** Number of page faults while in ISR */
 		unsigned long			in_isr;
 #endif /* !CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+
+#if defined(CONFIG_DEMAND_PAGING_READ_AHEAD) || defined(__DOXYGEN__)
+		/** Number of data pages read ahead of sequential page faults */
+		unsigned long			read_ahead;
+
+		/**
+		 * Number of page faults avoided, i.e. data pages read ahead
+		 * which were passed over by the sequential accesses
+		 */
+		unsigned long			avoided;
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
 	} pagefaults;
 
 	struct {
@@ -56,7 +67,38 @@ struct k_mem_paging_stats_t {
 
 		/** Number of dirty pages selected for eviction */
 		unsigned long			dirty;
+
+		/** Number of page frames examined to select them */
+		unsigned long			scanned;
+
+		/**
+		 * Number of examined page frames found recently accessed,
+		 * i.e. hits in the resident set, and passed over
+		 */
+		unsigned long			referenced;
 	} eviction;
+
+#if defined(CONFIG_DEMAND_PAGING_CLEANER) || defined(__DOXYGEN__)
+	struct {
+		/** Number of times the page cleaner was woken up */
+		unsigned long			runs;
+
+		/** Number of clean pages evicted by the page cleaner */
+		unsigned long			clean;
+
+		/**
+		 * Number of dirty pages written back and evicted by the
+		 * page cleaner
+		 */
+		unsigned long			dirty;
+
+		/**
+		 * Number of page faults which found no free page frame, and
+		 * evicted a page themselves
+		 */
+		unsigned long			misses;
+	} cleaner;
+#endif /* CONFIG_DEMAND_PAGING_CLEANER */
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 };
 
@@ -327,6 +369,29 @@ void k_mem_paging_backing_store_page_out(uintptr_t location);
  */
 void k_mem_paging_backing_store_page_in(uintptr_t location);
 
+#if defined(CONFIG_DEMAND_PAGING_READ_AHEAD) || defined(__DOXYGEN__)
+/**
+ * Copy a batch of data pages from the provided locations to page frames
+ *
+ * Used to read ahead sequential page faults and by k_mem_page_in(). The
+ * default implementation maps Z_SCRATCH_PAGE to each page frame in turn and
+ * calls k_mem_paging_backing_store_page_in(). Backing stores which can
+ * transfer several data pages at once, e.g. with a single DMA transfer or
+ * flash read, may override it.
+ *
+ * The same serialization rules as k_mem_paging_backing_store_page_in()
+ * apply. k_mem_paging_backing_store_page_finalize() is invoked for each
+ * data page afterwards.
+ *
+ * @param locations Location tokens of the data pages
+ * @param phys Physical addresses of the destination page frames
+ * @param count Number of data pages
+ */
+void k_mem_paging_backing_store_page_in_batch(const uintptr_t *locations,
+					      const uintptr_t *phys,
+					      size_t count);
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
+
 /**
  * Update internal accounting after a page-in
  *
@@ -365,6 +430,48 @@ void k_mem_paging_backing_store_page_finalize(struct z_page_frame *pf,
  */
 void k_mem_paging_backing_store_init(void);
 
+#if defined(CONFIG_BACKING_STORE_COMPRESSED) || defined(__DOXYGEN__)
+/**
+ * Compressed RAM backing store statistics.
+ */
+struct k_mem_paging_backing_store_compressed_stats {
+	/** Number of data pages currently stored */
+	unsigned long			pages;
+
+	/** Number of those stored as a page filled with a single byte */
+	unsigned long			same_filled;
+
+	/** Number of those stored uncompressed, as they did not compress */
+	unsigned long			incompressible;
+
+	/**
+	 * Number of pool bytes holding them, to be compared with
+	 * pages * CONFIG_MMU_PAGE_SIZE for the compression ratio
+	 */
+	unsigned long			stored_bytes;
+
+	/** Number of data pages paged out since system startup */
+	unsigned long			page_outs;
+
+	/** Number of data pages paged in since system startup */
+	unsigned long			page_ins;
+
+	/** Total hardware cycles spent paging in data pages */
+	uint64_t			page_in_cycles;
+
+	/** Most hardware cycles spent paging in a single data page */
+	uint32_t			page_in_cycles_max;
+};
+
+/**
+ * Get the statistics of the compressed RAM backing store
+ *
+ * @param[out] stats Statistics struct to be filled.
+ */
+void k_mem_paging_backing_store_compressed_stats_get(
+	struct k_mem_paging_backing_store_compressed_stats *stats);
+#endif /* CONFIG_BACKING_STORE_COMPRESSED */
+
 /** @} */
 
 #ifdef __cplusplus
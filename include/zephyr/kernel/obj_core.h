@@ -45,6 +45,10 @@
 #define K_OBJ_TYPE_MBOX_ID       K_OBJ_TYPE_ID_GEN("MBOX")
 /** Memory slab object type */
 #define K_OBJ_TYPE_MEM_SLAB_ID   K_OBJ_TYPE_ID_GEN("SLAB")
+/** Memory cache object type */
+#define K_OBJ_TYPE_MEM_CACHE_ID  K_OBJ_TYPE_ID_GEN("MCCH")
+/** Memory cache size class object type */
+#define K_OBJ_TYPE_MEM_CACHE_CLASS_ID  K_OBJ_TYPE_ID_GEN("MCCL")
 /** Message queue object type */
 #define K_OBJ_TYPE_MSGQ_ID       K_OBJ_TYPE_ID_GEN("MSGQ")
 /** Mutex object type */
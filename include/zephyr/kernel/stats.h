@@ -9,6 +9,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <zephyr/sys/atomic_types.h>
 
 /**
  * Structure used to track internal statistics about both thread
@@ -28,6 +29,8 @@ struct k_cycle_stats {
 	/** @} */
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 	bool      track_usage;  /**< true if gathering usage stats */
+	atomic_t  seq;          /**< update sequence, odd while being updated */
+	atomic_t  req;          /**< pending enable, disable and reset requests */
 };
 
 #endif /* ZEPHYR_INCLUDE_KERNEL_STATS_H_ */
@@ -117,6 +117,16 @@ struct _thread_base {
 	/* Recursive count of irq_lock() calls */
 	uint8_t global_lock_count;
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	/* CPU whose run queue holds the thread while it is queued */
+	uint8_t runq_cpu;
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+
+#ifdef CONFIG_CPU_DOMAINS
+	/* Cache domain the thread prefers to run in, or -1 */
+	int8_t domain;
+#endif /* CONFIG_CPU_DOMAINS */
+
 #endif /* CONFIG_SMP */
 
 #ifdef CONFIG_SCHED_CPU_MASK
@@ -228,8 +238,20 @@ typedef struct k_thread_runtime_stats {
 	uint64_t idle_cycles;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+#ifdef CONFIG_SCHED_IPI_STATS
+	/*
+	 * Always zero for individual threads. For CPUs, the number of
+	 * scheduler IPIs sent to other CPUs and the number of CPUs that
+	 * did not have to be interrupted compared to a broadcast.
+	 */
+
+	uint64_t ipis_sent;
+	uint64_t ipis_avoided;
+#endif /* CONFIG_SCHED_IPI_STATS */
+
 #if defined(__cplusplus) && !defined(CONFIG_SCHED_THREAD_USAGE) &&                                 \
-	!defined(CONFIG_SCHED_THREAD_USAGE_ANALYSIS) && !defined(CONFIG_SCHED_THREAD_USAGE_ALL)
+	!defined(CONFIG_SCHED_THREAD_USAGE_ANALYSIS) && !defined(CONFIG_SCHED_THREAD_USAGE_ALL) && \
+	!defined(CONFIG_SCHED_IPI_STATS)
 	/* If none of the above Kconfig values are defined, this struct will have a size 0 in C
 	 * which is not allowed in C++ (it'll have a size 1). To prevent this, we add a 1 byte dummy
 	 * variable when the struct would otherwise be empty.
@@ -147,6 +147,16 @@ struct _ready_q {
 #elif defined(CONFIG_SCHED_MULTIQ)
 	struct _priq_mq runq;
 #endif
+
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	/* number of threads in runq, used to find the busiest CPU */
+	uint32_t nr_queued;
+
+	/* highest priority (lowest value) queued in runq, INT_MAX if empty,
+	 * so that peers can skip the queue without walking it
+	 */
+	int top_prio;
+#endif
 };
 
 typedef struct _ready_q _ready_q_t;
@@ -164,7 +174,7 @@ struct _cpu {
 	/* one assigned idle thread per CPU */
 	struct k_thread *idle_thread;
 
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#ifdef CONFIG_SCHED_CPU_READY_Q
 	struct _ready_q ready_q;
 #endif
 
@@ -199,6 +209,14 @@ struct _cpu {
 #endif
 #endif
 
+#ifdef CONFIG_SCHED_IPI_STATS
+	/* scheduler IPIs sent by this CPU, and peers spared from one */
+	struct {
+		atomic_t sent;
+		atomic_t avoided;
+	} ipi_stats;
+#endif
+
 #ifdef CONFIG_OBJ_CORE_SYSTEM
 	struct k_obj_core  obj_core;
 #endif
@@ -220,10 +238,15 @@ struct z_kernel {
 	 * ready queue: can be big, keep after small fields, since some
 	 * assembly (e.g. ARC) are limited in the encoding of the offset
 	 */
-#ifndef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#ifndef CONFIG_SCHED_CPU_READY_Q
 	struct _ready_q ready_q;
 #endif
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	/* CPUs whose run queue is not empty */
+	uint32_t runq_busy;
+#endif
+
 #ifdef CONFIG_FPU_SHARING
 	/*
 	 * A 'current_sse' field does not exist in addition to the 'current_fp'
@@ -250,8 +273,8 @@ struct z_kernel {
 #endif
 
 #if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
-	/* Need to signal an IPI at the next scheduling point */
-	bool pending_ipi;
+	/* Identify CPUs to send IPIs to at the next scheduling point */
+	atomic_t pending_ipi;
 #endif
 };
 
@@ -312,6 +335,12 @@ struct _timeout {
 #else
 	int32_t dticks;
 #endif
+#ifdef CONFIG_TIMEOUT_SLACK
+	/* Ticks the expiry may be delayed by to share a wakeup */
+	uint32_t slack;
+	/* Ticks past the nominal expiry at which it last fired */
+	uint32_t late;
+#endif /* CONFIG_TIMEOUT_SLACK */
 };
 
 typedef void (*k_thread_timeslice_fn_t)(struct k_thread *thread, void *data);
@@ -77,8 +77,24 @@ enum shared_multi_heap_attr {
 	SMH_REG_ATTR_NUM,
 };
 
+#if defined(CONFIG_CPU_DOMAINS) || defined(__DOXYGEN__)
+/**
+ * @brief Attribute of a cacheable region local to a CPU cache domain
+ *
+ * Regions added with this attribute are used by @ref
+ * shared_multi_heap_alloc_local for threads running in @a domain.
+ *
+ * @param domain cache domain index, see k_cpu_domain_get().
+ */
+#define SMH_REG_ATTR_DOMAIN(domain) \
+	((enum shared_multi_heap_attr)(SMH_REG_ATTR_NUM + (domain)))
+
+/** Maximum number of standard and per-domain attributes. */
+#define MAX_SHARED_MULTI_HEAP_ATTR (SMH_REG_ATTR_NUM + CONFIG_MP_MAX_NUM_CPUS)
+#else
 /** Maximum number of standard attributes. */
 #define MAX_SHARED_MULTI_HEAP_ATTR SMH_REG_ATTR_NUM
+#endif /* CONFIG_CPU_DOMAINS */
 
 /**
  * @brief SMH region struct
@@ -145,6 +161,22 @@ void *shared_multi_heap_alloc(enum shared_multi_heap_attr attr, size_t bytes);
 void *shared_multi_heap_aligned_alloc(enum shared_multi_heap_attr attr,
 				      size_t align, size_t bytes);
 
+/**
+ * @brief Allocate memory local to the current CPU cache domain
+ *
+ * Allocates a block of cacheable memory from the regions added with
+ * @ref SMH_REG_ATTR_DOMAIN for the domain of the calling CPU, and
+ * falls back to the @ref SMH_REG_ATTR_CACHEABLE regions when those are
+ * exhausted or missing.  Without @kconfig{CONFIG_CPU_DOMAINS} this is
+ * the same as allocating with @ref SMH_REG_ATTR_CACHEABLE.
+ *
+ * @param bytes		requested size of the allocation in bytes.
+ *
+ * @retval ptr		a valid pointer to heap memory.
+ * @retval err		NULL if no memory is available.
+ */
+void *shared_multi_heap_alloc_local(size_t bytes);
+
 /**
  * @brief Free memory from the shared multi-heap pool
  *
@@ -17,6 +17,7 @@
 
 #include <zephyr/arch/cpu.h>
 #include <zephyr/sys/atomic.h>
+#include <zephyr/sys/barrier.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/sys/time_units.h>
 
@@ -35,6 +36,16 @@ struct z_spinlock_key {
 	int key;
 };
 
+#if defined(CONFIG_SMP) && defined(CONFIG_MCS_SPINLOCKS)
+/* Queue node of an MCS spinlock waiter, see kernel/spinlock_mcs.c */
+struct z_spinlock_mcs_node {
+	atomic_ptr_t next;
+	atomic_t wait;
+	uint16_t cpu;
+	uint16_t idx;
+};
+#endif /* CONFIG_SMP && CONFIG_MCS_SPINLOCKS */
+
 /**
  * @brief Kernel Spin Lock
  *
@@ -61,6 +72,17 @@ struct k_spinlock {
 	 */
 	atomic_t owner;
 	atomic_t tail;
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	/*
+	 * MCS spinlocks queue the contending CPUs in a linked list of
+	 * per-CPU nodes. Each CPU spins on a flag in its own node until
+	 * its predecessor hands the lock over, so a release only touches
+	 * the cache line of the next waiter.
+	 * The lock points to the tail of the queue, and to the node of
+	 * the current holder so that it can be found at unlock time.
+	 */
+	atomic_ptr_t tail;
+	struct z_spinlock_mcs_node *holder;
 #else
 	atomic_t locked;
 #endif /* CONFIG_TICKET_SPINLOCKS */
@@ -116,6 +138,12 @@ bool z_spin_lock_mem_coherent(struct k_spinlock *l);
 
 #endif /* CONFIG_SPIN_VALIDATE */
 
+#if defined(CONFIG_SMP) && defined(CONFIG_MCS_SPINLOCKS)
+void z_spin_lock_mcs(struct k_spinlock *l);
+bool z_spin_trylock_mcs(struct k_spinlock *l);
+void z_spin_unlock_mcs(struct k_spinlock *l);
+#endif /* CONFIG_SMP && CONFIG_MCS_SPINLOCKS */
+
 /**
  * @brief Spinlock key type
  *
@@ -202,6 +230,8 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 	while (atomic_get(&l->owner) != ticket) {
 		arch_spin_relax();
 	}
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	z_spin_lock_mcs(l);
 #else
 	while (!atomic_cas(&l->locked, 0, 1)) {
 		arch_spin_relax();
@@ -257,6 +287,10 @@ static ALWAYS_INLINE int k_spin_trylock(struct k_spinlock *l, k_spinlock_key_t *
 	if (!atomic_cas(&l->tail, ticket_val, ticket_val + 1)) {
 		goto busy;
 	}
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	if (!z_spin_trylock_mcs(l)) {
+		goto busy;
+	}
 #else
 	if (!atomic_cas(&l->locked, 0, 1)) {
 		goto busy;
@@ -317,6 +351,9 @@ static ALWAYS_INLINE void k_spin_unlock(struct k_spinlock *l,
 #ifdef CONFIG_TICKET_SPINLOCKS
 	/* Give the spinlock to the next CPU in a FIFO */
 	atomic_inc(&l->owner);
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	/* Hand the spinlock over to the next queued CPU, if any */
+	z_spin_unlock_mcs(l);
 #else
 	/* Strictly we don't need atomic_clear() here (which is an
 	 * exchange operation that returns the old value).  We are always
@@ -349,6 +386,8 @@ static ALWAYS_INLINE bool z_spin_is_locked(struct k_spinlock *l)
 	atomic_val_t ticket_val = atomic_get(&l->owner);
 
 	return !atomic_cas(&l->tail, ticket_val, ticket_val);
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	return atomic_ptr_get(&l->tail) != NULL;
 #else
 	return l->locked;
 #endif /* CONFIG_TICKET_SPINLOCKS */
@@ -365,6 +404,8 @@ static ALWAYS_INLINE void k_spin_release(struct k_spinlock *l)
 #ifdef CONFIG_SMP
 #ifdef CONFIG_TICKET_SPINLOCKS
 	atomic_inc(&l->owner);
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	z_spin_unlock_mcs(l);
 #else
 	atomic_clear(&l->locked);
 #endif /* CONFIG_TICKET_SPINLOCKS */
@@ -439,6 +480,272 @@ static ALWAYS_INLINE void z_spin_onexit(__maybe_unused k_spinlock_key_t *k)
 	for (k_spinlock_key_t __i K_SPINLOCK_ONEXIT = {}, __key = k_spin_lock(lck); !__i.key;      \
 	     k_spin_unlock(lck, __key), __i.key = 1)
 
+/**
+ * @brief Kernel Reader-Writer Spin Lock
+ *
+ * Like a @ref k_spinlock, except that any number of CPUs may hold it for
+ * reading at the same time, while a CPU holding it for writing excludes
+ * all other holders. A CPU waiting to write keeps new readers out, so
+ * that writers cannot be starved by a continuous flow of readers.
+ */
+struct k_rwspinlock {
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#ifdef CONFIG_SMP
+	/* Number of readers, plus Z_RWSPINLOCK_WRITER when a writer
+	 * holds or waits for the lock
+	 */
+	atomic_t state;
+#endif /* CONFIG_SMP */
+
+#ifdef CONFIG_SPIN_VALIDATE
+	/* Thread and CPU holding the lock for writing, as for k_spinlock */
+	uintptr_t thread_cpu;
+#endif /* CONFIG_SPIN_VALIDATE */
+
+#if defined(CONFIG_CPP) && !defined(CONFIG_SMP) && \
+	!defined(CONFIG_SPIN_VALIDATE)
+	/* See k_spinlock */
+	char dummy;
+#endif
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+#define Z_RWSPINLOCK_WRITER ((atomic_val_t)1 << (ATOMIC_BITS - 2))
+
+#ifdef CONFIG_SPIN_VALIDATE
+bool z_rwspin_lock_valid(struct k_rwspinlock *l);
+bool z_rwspin_write_unlock_valid(struct k_rwspinlock *l);
+void z_rwspin_write_set_owner(struct k_rwspinlock *l);
+#endif /* CONFIG_SPIN_VALIDATE */
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Lock a reader-writer spinlock for reading
+ *
+ * Interrupts are masked on the current CPU until the lock is released,
+ * as for k_spin_lock(). Other CPUs may hold the lock for reading at the
+ * same time. Read locks on the same lock must not be nested: a writer
+ * queued in between would deadlock.
+ *
+ * @param l A pointer to the lock
+ * @return A key value that must be passed to k_rwspin_read_unlock()
+ */
+static ALWAYS_INLINE k_spinlock_key_t k_rwspin_read_lock(struct k_rwspinlock *l)
+{
+	ARG_UNUSED(l);
+	k_spinlock_key_t k;
+
+	k.key = arch_irq_lock();
+
+#ifdef CONFIG_SPIN_VALIDATE
+	__ASSERT(z_rwspin_lock_valid(l), "Invalid rwspinlock %p", l);
+#endif /* CONFIG_SPIN_VALIDATE */
+#ifdef CONFIG_SMP
+	for (;;) {
+		atomic_val_t state = atomic_get(&l->state);
+
+		if (((state & Z_RWSPINLOCK_WRITER) == 0) &&
+		    atomic_cas(&l->state, state, state + 1)) {
+			break;
+		}
+		arch_spin_relax();
+	}
+#endif /* CONFIG_SMP */
+
+	return k;
+}
+
+/**
+ * @brief Unlock a reader-writer spinlock locked for reading
+ *
+ * @param l A pointer to the lock
+ * @param key The value returned from k_rwspin_read_lock()
+ */
+static ALWAYS_INLINE void k_rwspin_read_unlock(struct k_rwspinlock *l,
+					      k_spinlock_key_t key)
+{
+	ARG_UNUSED(l);
+#ifdef CONFIG_SMP
+	(void)atomic_dec(&l->state);
+#endif /* CONFIG_SMP */
+	arch_irq_unlock(key.key);
+}
+
+/**
+ * @brief Lock a reader-writer spinlock for writing
+ *
+ * Waits until no other CPU holds the lock, then returns with exclusive
+ * ownership and interrupts masked, as for k_spin_lock().
+ *
+ * @param l A pointer to the lock
+ * @return A key value that must be passed to k_rwspin_write_unlock()
+ */
+static ALWAYS_INLINE k_spinlock_key_t k_rwspin_write_lock(struct k_rwspinlock *l)
+{
+	ARG_UNUSED(l);
+	k_spinlock_key_t k;
+
+	k.key = arch_irq_lock();
+
+#ifdef CONFIG_SPIN_VALIDATE
+	__ASSERT(z_rwspin_lock_valid(l), "Invalid rwspinlock %p", l);
+#endif /* CONFIG_SPIN_VALIDATE */
+#ifdef CONFIG_SMP
+	/* Claim the writer flag first, which keeps new readers out... */
+	for (;;) {
+		atomic_val_t state = atomic_get(&l->state);
+
+		if (((state & Z_RWSPINLOCK_WRITER) == 0) &&
+		    atomic_cas(&l->state, state, state | Z_RWSPINLOCK_WRITER)) {
+			break;
+		}
+		arch_spin_relax();
+	}
+
+	/* ...then wait for the current ones to leave */
+	while (atomic_get(&l->state) != Z_RWSPINLOCK_WRITER) {
+		arch_spin_relax();
+	}
+#endif /* CONFIG_SMP */
+#ifdef CONFIG_SPIN_VALIDATE
+	z_rwspin_write_set_owner(l);
+#endif /* CONFIG_SPIN_VALIDATE */
+
+	return k;
+}
+
+/**
+ * @brief Unlock a reader-writer spinlock locked for writing
+ *
+ * @param l A pointer to the lock
+ * @param key The value returned from k_rwspin_write_lock()
+ */
+static ALWAYS_INLINE void k_rwspin_write_unlock(struct k_rwspinlock *l,
+					       k_spinlock_key_t key)
+{
+	ARG_UNUSED(l);
+#ifdef CONFIG_SPIN_VALIDATE
+	__ASSERT(z_rwspin_write_unlock_valid(l), "Not my rwspinlock %p", l);
+#endif /* CONFIG_SPIN_VALIDATE */
+#ifdef CONFIG_SMP
+	/* Readers do not touch the state while the writer flag is set */
+	atomic_clear(&l->state);
+#endif /* CONFIG_SMP */
+	arch_irq_unlock(key.key);
+}
+
+/**
+ * @brief Kernel Sequence Lock
+ *
+ * A sequence lock lets readers proceed without writing to any shared
+ * memory: a reader takes a snapshot of the protected data between
+ * k_seqlock_read_begin() and k_seqlock_read_retry(), and starts over if
+ * a writer modified the data in the meantime. Writers are serialized by
+ * a spinlock.
+ *
+ * This suits small, frequently read and rarely written data. Readers may
+ * observe inconsistent values before the retry check and must not act on
+ * them, in particular they must not follow pointers read from the
+ * protected data.
+ */
+struct k_seqlock {
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+	struct k_spinlock lock;
+	/* Odd while a writer is updating the data */
+	atomic_t seq;
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+};
+
+/**
+ * @brief Begin a read section of a sequence lock
+ *
+ * Waits for any update in progress to complete.
+ *
+ * @param sl A pointer to the sequence lock
+ * @return Sequence value to pass to k_seqlock_read_retry()
+ */
+static ALWAYS_INLINE uint32_t k_seqlock_read_begin(struct k_seqlock *sl)
+{
+	atomic_val_t seq;
+
+	while (((seq = atomic_get(&sl->seq)) & 1) != 0) {
+		arch_spin_relax();
+	}
+
+	/* Order the data reads after the sequence read */
+	barrier_dmem_fence_full();
+
+	return (uint32_t)seq;
+}
+
+/**
+ * @brief End a read section of a sequence lock
+ *
+ * @param sl A pointer to the sequence lock
+ * @param seq The value returned by k_seqlock_read_begin()
+ * @retval true The data was modified during the read section, which
+ *         must be done again.
+ * @retval false The data read during the read section is consistent.
+ */
+static ALWAYS_INLINE bool k_seqlock_read_retry(struct k_seqlock *sl, uint32_t seq)
+{
+	/* Order the data reads before the sequence check */
+	barrier_dmem_fence_full();
+
+	return (uint32_t)atomic_get(&sl->seq) != seq;
+}
+
+/**
+ * @brief Lock a sequence lock for writing
+ *
+ * Behaves like k_spin_lock() on the lock serializing the writers, and
+ * makes the concurrent read sections retry.
+ *
+ * @param sl A pointer to the sequence lock
+ * @return A key value that must be passed to k_seqlock_write_unlock()
+ */
+static ALWAYS_INLINE k_spinlock_key_t k_seqlock_write_lock(struct k_seqlock *sl)
+{
+	k_spinlock_key_t key = k_spin_lock(&sl->lock);
+
+	(void)atomic_inc(&sl->seq);
+	/* Order the sequence update before the data updates */
+	barrier_dmem_fence_full();
+
+	return key;
+}
+
+/**
+ * @brief Unlock a sequence lock locked for writing
+ *
+ * @param sl A pointer to the sequence lock
+ * @param key The value returned from k_seqlock_write_lock()
+ */
+static ALWAYS_INLINE void k_seqlock_write_unlock(struct k_seqlock *sl,
+						 k_spinlock_key_t key)
+{
+	/* Order the data updates before the sequence update */
+	barrier_dmem_fence_full();
+	(void)atomic_inc(&sl->seq);
+
+	k_spin_unlock(&sl->lock, key);
+}
+
 /** @} */
 
 #ifdef __cplusplus
@@ -25,6 +25,11 @@ struct sys_memory_stats {
 	size_t  free_bytes;
 	size_t  allocated_bytes;
 	size_t  max_allocated_bytes;
+#ifdef CONFIG_SYS_HEAP_CACHE
+	size_t  cached_bytes;
+	size_t  cache_hits;
+	size_t  cache_misses;
+#endif
 };
 
 #ifdef __cplusplus
@@ -10,6 +10,9 @@
 #include <stdbool.h>
 #include <zephyr/types.h>
 #include <zephyr/sys/mem_stats.h>
+#ifdef CONFIG_SYS_HEAP_CACHE
+#include <zephyr/spinlock.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -57,8 +60,45 @@ struct sys_heap {
 	struct z_heap *heap;
 	void *init_mem;
 	size_t init_bytes;
+#ifdef CONFIG_SYS_HEAP_CACHE
+	struct sys_heap_cache *cache;
+#endif
+};
+
+#ifdef CONFIG_SYS_HEAP_CACHE
+
+/* Smallest size class of the per-CPU heap cache, in bytes.  Class N
+ * holds blocks of at least (SYS_HEAP_CACHE_MIN_SIZE << N) bytes.
+ */
+#define SYS_HEAP_CACHE_MIN_SIZE 16
+
+/* A stack of free blocks of one size class, owned by one CPU */
+struct sys_heap_magazine {
+	uint16_t count;
+	void *objs[CONFIG_SYS_HEAP_CACHE_DEPTH];
+};
+
+struct sys_heap_cache_cpu {
+	/* Uncontended unless another CPU flushes these magazines */
+	struct k_spinlock lock;
+	struct sys_heap_magazine mags[CONFIG_SYS_HEAP_CACHE_CLASSES];
+	size_t cached_bytes;
+	uint32_t hits;
+	uint32_t misses;
+};
+
+/* Per-CPU magazine cache layered on top of a sys_heap.  Like the heap
+ * itself it is not synchronized against other users of the heap: the
+ * owner provides the heap lock for the *_locked operations.
+ */
+struct sys_heap_cache {
+	struct sys_heap *heap;
+	size_t align;
+	struct sys_heap_cache_cpu cpus[CONFIG_MP_MAX_NUM_CPUS];
 };
 
+#endif /* CONFIG_SYS_HEAP_CACHE */
+
 struct z_heap_stress_result {
 	uint32_t total_allocs;
 	uint32_t successful_allocs;
@@ -71,6 +111,9 @@ struct z_heap_stress_result {
 /**
  * @brief Get the runtime statistics of a sys_heap
  *
+ * With CONFIG_SYS_HEAP_CACHE, blocks held in the per-CPU caches of the
+ * heap are reported as free and accounted for in the cache fields.
+ *
  * @param heap Pointer to specified sys_heap
  * @param stats_t Pointer to struct to copy statistics into
  * @return -EINVAL if null pointers, otherwise 0
@@ -195,6 +238,86 @@ void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
  */
 size_t sys_heap_usable_size(struct sys_heap *heap, void *mem);
 
+#if defined(CONFIG_SYS_HEAP_CACHE) || defined(__DOXYGEN__)
+
+/** @brief Attach a per-CPU allocation cache to a sys_heap
+ *
+ * Small blocks freed through the cache are kept in per-CPU stacks
+ * ("magazines"), one per power-of-two size class, and handed out
+ * again without touching the heap or its lock.  Magazines are
+ * refilled from and flushed to the heap in batches.
+ *
+ * @param cache Cache to initialize
+ * @param heap Initialized heap the cache allocates from
+ * @param align Alignment of the blocks served by the cache, which
+ *              must be the alignment the owner uses by default
+ */
+void sys_heap_cache_init(struct sys_heap_cache *cache, struct sys_heap *heap,
+			 size_t align);
+
+/** @brief Allocate a block from the current CPU's cache
+ *
+ * Can be called without the heap lock.  This does not flush any cache
+ * when the current CPU's magazine is empty.
+ *
+ * @param cache Cache from which to allocate
+ * @param align Requested alignment
+ * @param bytes Number of bytes requested
+ * @return A cached block, or NULL if the caller must call
+ *         sys_heap_cache_alloc_locked()
+ */
+void *sys_heap_cache_alloc(struct sys_heap_cache *cache, size_t align,
+			   size_t bytes);
+
+/** @brief Allocate a block from the heap and refill the cache
+ *
+ * Must be called with the heap lock held.  Cacheable requests are
+ * rounded up to their size class and a batch of extra blocks of that
+ * class is moved into the current CPU's magazine.  If the heap is
+ * exhausted the magazines of every CPU are flushed, as with
+ * sys_heap_cache_flush_locked(), and the allocation retried.
+ *
+ * @param cache Cache from which to allocate
+ * @param align Requested alignment, as for sys_heap_aligned_alloc()
+ * @param bytes Number of bytes requested
+ * @return Pointer to memory the caller can now use, or NULL
+ */
+void *sys_heap_cache_alloc_locked(struct sys_heap_cache *cache, size_t align,
+				  size_t bytes);
+
+/** @brief Free a block into the current CPU's cache
+ *
+ * Can be called without the heap lock.
+ *
+ * @param cache Cache to which to return the memory
+ * @param mem A pointer previously returned from the cache or its heap
+ * @return true if the block was cached, false if the caller must call
+ *         sys_heap_cache_free_locked()
+ */
+bool sys_heap_cache_free(struct sys_heap_cache *cache, void *mem);
+
+/** @brief Free a block, flushing a batch of the cache to the heap
+ *
+ * Must be called with the heap lock held.
+ *
+ * @param cache Cache to which to return the memory
+ * @param mem A pointer previously returned from the cache or its heap
+ */
+void sys_heap_cache_free_locked(struct sys_heap_cache *cache, void *mem);
+
+/** @brief Return all blocks cached by every CPU to the heap
+ *
+ * Must be called with the heap lock held.  The magazines of each CPU
+ * are emptied in turn under that CPU's cache lock, which holds off
+ * cached allocations and frees on that CPU meanwhile, and costs a
+ * cross-CPU cache line transfer for each lock and magazine.
+ *
+ * @param cache Cache to flush
+ */
+void sys_heap_cache_flush_locked(struct sys_heap_cache *cache);
+
+#endif /* CONFIG_SYS_HEAP_CACHE */
+
 /** @brief Validate heap integrity
  *
  * Validates the internal integrity of a sys_heap.  Intended for unit
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Submission of several system calls with a single privilege elevation
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_
+#define ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_
+
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup syscall_batch_apis System Call Batching APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/** Number of marshalled arguments of a system call */
+#define K_SYSCALL_BATCH_ARGS 6
+
+/**
+ * @brief One system call of a batch
+ *
+ * The arguments are laid out as the generated system call stubs pass them
+ * to the kernel: 64-bit arguments take two slots on 32-bit targets, a
+ * 64-bit return value is written through an extra pointer argument and
+ * system calls with more than six arguments take a pointer to the
+ * remaining ones in the last slot.
+ */
+struct k_syscall_batch_entry {
+	/** System call ID, one of the K_SYSCALL_* values */
+	uint32_t id;
+	/** Return value of the system call, set on submission */
+	uintptr_t result;
+	/** Marshalled arguments */
+	uintptr_t args[K_SYSCALL_BATCH_ARGS];
+};
+
+/**
+ * @brief Submission buffer of a user thread
+ *
+ * The entry array must be writable by the thread submitting it.
+ */
+struct k_syscall_batch {
+	/** Entry array */
+	struct k_syscall_batch_entry *entries;
+	/** Number of entries in the array */
+	uint32_t size;
+	/** Number of entries queued for the next submission */
+	uint32_t count;
+};
+
+/**
+ * @brief Execute a batch of system calls
+ *
+ * Runs the system calls described by @a entries in order, as if the
+ * calling thread had made them one after the other, and stores the return
+ * value of each of them in its entry. Each system call verifies its own
+ * arguments; the calling thread is terminated on the first one that fails
+ * verification, or on an invalid system call ID.
+ *
+ * Batching only saves privilege elevations, supervisor threads should
+ * make their calls directly.
+ *
+ * @param entries Array of system calls to execute.
+ * @param num_entries Number of entries in the array.
+ *
+ * @return Number of system calls executed.
+ * @retval -ENOTSUP Called from supervisor mode.
+ */
+__syscall int k_syscall_batch_submit(struct k_syscall_batch_entry *entries,
+				     uint32_t num_entries);
+
+/**
+ * @brief Initialize a submission buffer
+ *
+ * @param batch Submission buffer.
+ * @param entries Entry array, writable by the submitting thread.
+ * @param num_entries Number of entries in the array.
+ */
+static inline void k_syscall_batch_init(struct k_syscall_batch *batch,
+					struct k_syscall_batch_entry *entries,
+					uint32_t num_entries)
+{
+	batch->entries = entries;
+	batch->size = num_entries;
+	batch->count = 0U;
+}
+
+/**
+ * @brief Queue a system call
+ *
+ * The arguments of the returned entry are zeroed, the caller fills them
+ * in. The entry holds the return value of the system call after
+ * k_syscall_batch_flush(), until the next call is queued in its place.
+ *
+ * @param batch Submission buffer.
+ * @param id System call ID.
+ *
+ * @return Queued entry, or NULL if the buffer is full.
+ */
+static inline struct k_syscall_batch_entry *
+k_syscall_batch_add(struct k_syscall_batch *batch, uint32_t id)
+{
+	struct k_syscall_batch_entry *entry;
+
+	if (batch->count >= batch->size) {
+		return NULL;
+	}
+
+	entry = &batch->entries[batch->count++];
+	entry->id = id;
+	entry->result = 0U;
+	for (int i = 0; i < K_SYSCALL_BATCH_ARGS; i++) {
+		entry->args[i] = 0U;
+	}
+
+	return entry;
+}
+
+/**
+ * @brief Execute the queued system calls and empty the buffer
+ *
+ * @param batch Submission buffer.
+ *
+ * @return See k_syscall_batch_submit().
+ */
+static inline int k_syscall_batch_flush(struct k_syscall_batch *batch)
+{
+	uint32_t count = batch->count;
+
+	batch->count = 0U;
+
+	return k_syscall_batch_submit(batch->entries, count);
+}
+
+/**
+ * @brief Marshal a timeout into the argument slots of an entry
+ *
+ * @param args First argument slot of the timeout.
+ *
+ * @return Number of slots used.
+ */
+static inline int k_syscall_batch_timeout(uintptr_t *args, k_timeout_t timeout)
+{
+	union {
+		uintptr_t x[DIV_ROUND_UP(sizeof(k_timeout_t), sizeof(uintptr_t))];
+		k_timeout_t val;
+	} parm = { .x = { 0 } };
+
+	parm.val = timeout;
+	for (int i = 0; i < ARRAY_SIZE(parm.x); i++) {
+		args[i] = parm.x[i];
+	}
+
+	return ARRAY_SIZE(parm.x);
+}
+
+/**
+ * @brief Queue a k_sem_give() call
+ *
+ * @return Queued entry, or NULL if the buffer is full.
+ */
+static inline struct k_syscall_batch_entry *
+k_syscall_batch_sem_give(struct k_syscall_batch *batch, struct k_sem *sem)
+{
+	struct k_syscall_batch_entry *entry =
+		k_syscall_batch_add(batch, K_SYSCALL_K_SEM_GIVE);
+
+	if (entry != NULL) {
+		entry->args[0] = (uintptr_t)sem;
+	}
+
+	return entry;
+}
+
+/**
+ * @brief Queue a k_msgq_put() call
+ *
+ * @return Queued entry, or NULL if the buffer is full.
+ */
+static inline struct k_syscall_batch_entry *
+k_syscall_batch_msgq_put(struct k_syscall_batch *batch, struct k_msgq *msgq,
+			 const void *data, k_timeout_t timeout)
+{
+	struct k_syscall_batch_entry *entry =
+		k_syscall_batch_add(batch, K_SYSCALL_K_MSGQ_PUT);
+
+	if (entry != NULL) {
+		entry->args[0] = (uintptr_t)msgq;
+		entry->args[1] = (uintptr_t)data;
+		(void)k_syscall_batch_timeout(&entry->args[2], timeout);
+	}
+
+	return entry;
+}
+
+/**
+ * @brief Queue a k_poll_signal_raise() call
+ *
+ * @return Queued entry, or NULL if the buffer is full.
+ */
+static inline struct k_syscall_batch_entry *
+k_syscall_batch_poll_signal_raise(struct k_syscall_batch *batch,
+				  struct k_poll_signal *sig, int result)
+{
+	struct k_syscall_batch_entry *entry =
+		k_syscall_batch_add(batch, K_SYSCALL_K_POLL_SIGNAL_RAISE);
+
+	if (entry != NULL) {
+		entry->args[0] = (uintptr_t)sig;
+		entry->args[1] = (uintptr_t)result;
+	}
+
+	return entry;
+}
+
+/** @} */
+
+#include <syscalls/syscall_batch.h>
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_ */
@@ -199,6 +199,20 @@ uint32_t sys_clock_tick_get_32(void);
  */
 int64_t sys_clock_tick_get(void);
 
+#if defined(CONFIG_TIMEOUT_SLACK) || defined(__DOXYGEN__)
+/**
+ * @brief Return the number of merged timer wakeups
+ *
+ * Counts the timeouts that expired ahead of their deadline, within
+ * their slack, because the system clock was announced for another
+ * reason.  On a tickless system each of them is a wakeup from idle
+ * that did not need to happen.
+ *
+ * @return the number of timeouts expired within their slack window
+ */
+uint32_t sys_clock_merged_wakeups_get(void);
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 #ifndef CONFIG_SYS_CLOCK_EXISTS
 #define sys_clock_tick_get() (0)
 #define sys_clock_tick_get_32() (0)
@@ -1419,6 +1419,50 @@
  */
 #define sys_port_trace_k_msgq_get_exit(msgq, timeout, ret)
 
+/**
+ * @brief Trace Message Queue batch put attempt entry
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_msgq_put_n_enter(msgq, timeout)
+
+/**
+ * @brief Trace Message Queue batch put attempt blocking
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_msgq_put_n_blocking(msgq, timeout)
+
+/**
+ * @brief Trace Message Queue batch put attempt outcome
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ * @param ret Return value
+ */
+#define sys_port_trace_k_msgq_put_n_exit(msgq, timeout, ret)
+
+/**
+ * @brief Trace Message Queue batch get attempt entry
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_msgq_get_n_enter(msgq, timeout)
+
+/**
+ * @brief Trace Message Queue batch get attempt blocking
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_msgq_get_n_blocking(msgq, timeout)
+
+/**
+ * @brief Trace Message Queue batch get attempt outcome
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ * @param ret Return value
+ */
+#define sys_port_trace_k_msgq_get_n_exit(msgq, timeout, ret)
+
 /**
  * @brief Trace Message Queue peek
  * @param msgq Message Queue object
@@ -1633,6 +1677,76 @@
  */
 #define sys_port_trace_k_pipe_get_exit(pipe, timeout, ret)
 
+/**
+ * @brief Trace Pipe put claim attempt entry
+ * @param pipe Pipe object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_pipe_put_claim_enter(pipe, timeout)
+
+/**
+ * @brief Trace Pipe put claim attempt blocking
+ * @param pipe Pipe object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_pipe_put_claim_blocking(pipe, timeout)
+
+/**
+ * @brief Trace Pipe put claim attempt outcome
+ * @param pipe Pipe object
+ * @param timeout Timeout period
+ * @param ret Return value
+ */
+#define sys_port_trace_k_pipe_put_claim_exit(pipe, timeout, ret)
+
+/**
+ * @brief Trace Pipe put claim finish entry
+ * @param pipe Pipe object
+ */
+#define sys_port_trace_k_pipe_put_finish_enter(pipe)
+
+/**
+ * @brief Trace Pipe put claim finish outcome
+ * @param pipe Pipe object
+ * @param ret Return value
+ */
+#define sys_port_trace_k_pipe_put_finish_exit(pipe, ret)
+
+/**
+ * @brief Trace Pipe get claim attempt entry
+ * @param pipe Pipe object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_pipe_get_claim_enter(pipe, timeout)
+
+/**
+ * @brief Trace Pipe get claim attempt blocking
+ * @param pipe Pipe object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_pipe_get_claim_blocking(pipe, timeout)
+
+/**
+ * @brief Trace Pipe get claim attempt outcome
+ * @param pipe Pipe object
+ * @param timeout Timeout period
+ * @param ret Return value
+ */
+#define sys_port_trace_k_pipe_get_claim_exit(pipe, timeout, ret)
+
+/**
+ * @brief Trace Pipe get claim finish entry
+ * @param pipe Pipe object
+ */
+#define sys_port_trace_k_pipe_get_finish_enter(pipe)
+
+/**
+ * @brief Trace Pipe get claim finish outcome
+ * @param pipe Pipe object
+ * @param ret Return value
+ */
+#define sys_port_trace_k_pipe_get_finish_exit(pipe, ret)
+
 /** @} */ /* end of subsys_tracing_apis_pipe */
 
 /**
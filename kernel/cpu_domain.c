@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/kernel.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/init.h>
+#include <ksched.h>
+#include <zephyr/spinlock.h>
+
+extern struct k_spinlock _sched_spinlock;
+
+BUILD_ASSERT(CONFIG_MP_MAX_NUM_CPUS <= INT8_MAX, "Too many CPUs for domain ids");
+
+uint8_t z_cpu_domains[CONFIG_MP_MAX_NUM_CPUS];
+static uint8_t num_domains = 1;
+
+#if (CONFIG_CPU_DOMAIN_SIZE == 0) && DT_NODE_EXISTS(DT_PATH(cpus))
+/* Devicetree ordinal of the cache shared by a CPU node, -1 if the node
+ * does not name one.  Children of /cpus without a reg property (cache
+ * and power state nodes) are not CPUs and are skipped.
+ */
+#define CPU_CACHE_ORD(node_id)						\
+	COND_CODE_1(DT_NODE_HAS_PROP(node_id, reg), (			\
+		if (n < CONFIG_MP_MAX_NUM_CPUS) {			\
+			ord[n++] = COND_CODE_1(				\
+				DT_NODE_HAS_PROP(node_id, next_level_cache), \
+				(DT_DEP_ORD(DT_PHANDLE(node_id,		\
+						       next_level_cache))), \
+				(-1));					\
+		}), ())
+
+static void cpu_domains_from_dt(void)
+{
+	int ord[CONFIG_MP_MAX_NUM_CPUS];
+	int n = 0;
+
+	DT_FOREACH_CHILD_STATUS_OKAY(DT_PATH(cpus), CPU_CACHE_ORD)
+
+	/* CPUs sharing a cache share a domain, numbered in order of
+	 * first appearance.  CPUs the devicetree does not describe
+	 * fall into domain 0.
+	 */
+	for (int i = 0; i < n; i++) {
+		int j;
+
+		for (j = 0; j < i; j++) {
+			if (ord[j] == ord[i]) {
+				break;
+			}
+		}
+
+		if (j < i) {
+			z_cpu_domains[i] = z_cpu_domains[j];
+		} else if (i > 0) {
+			z_cpu_domains[i] = num_domains++;
+		}
+	}
+}
+#endif /* (CONFIG_CPU_DOMAIN_SIZE == 0) && DT_NODE_EXISTS(DT_PATH(cpus)) */
+
+static int cpu_domains_init(void)
+{
+#if CONFIG_CPU_DOMAIN_SIZE > 0
+	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		z_cpu_domains[i] = i / CONFIG_CPU_DOMAIN_SIZE;
+	}
+	num_domains = DIV_ROUND_UP(arch_num_cpus(), CONFIG_CPU_DOMAIN_SIZE);
+#elif DT_NODE_EXISTS(DT_PATH(cpus))
+	cpu_domains_from_dt();
+#endif /* CONFIG_CPU_DOMAIN_SIZE > 0 */
+
+	return 0;
+}
+
+SYS_INIT(cpu_domains_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
+
+int k_cpu_domain_get(int cpu)
+{
+	if ((cpu < 0) || (cpu >= arch_num_cpus())) {
+		return -EINVAL;
+	}
+
+	return z_cpu_domains[cpu];
+}
+
+int k_cpu_domain_current(void)
+{
+	unsigned int key = arch_irq_lock();
+	int domain = z_cpu_domains[arch_curr_cpu()->id];
+
+	arch_irq_unlock(key);
+
+	return domain;
+}
+
+int k_cpu_domain_count(void)
+{
+	return num_domains;
+}
+
+int k_thread_domain_set(k_tid_t thread, int domain)
+{
+	int ret = 0;
+
+	if ((domain != K_CPU_DOMAIN_ANY) &&
+	    ((domain < 0) || (domain >= num_domains))) {
+		return -EINVAL;
+	}
+
+	K_SPINLOCK(&_sched_spinlock) {
+		if (z_is_thread_prevented_from_running(thread)) {
+			thread->base.domain = domain;
+		} else {
+			ret = -EINVAL;
+		}
+	}
+
+	return ret;
+}
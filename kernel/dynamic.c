@@ -10,26 +10,99 @@
 #include <ksched.h>
 #include <zephyr/kernel/thread_stack.h>
 #include <zephyr/logging/log.h>
-#include <zephyr/sys/bitarray.h>
 #include <zephyr/sys/kobject.h>
 #include <zephyr/internal/syscall_handler.h>
 
 LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
 
-#if CONFIG_DYNAMIC_THREAD_POOL_SIZE > 0
-#define BA_SIZE CONFIG_DYNAMIC_THREAD_POOL_SIZE
-#else
-#define BA_SIZE 1
-#endif /* CONFIG_DYNAMIC_THREAD_POOL_SIZE > 0 */
-
 struct dyn_cb_data {
 	k_tid_t tid;
 	k_thread_stack_t *stack;
 };
 
+/* State of one stack of the pools */
+struct dyn_stack_slot {
+	/* Thread created on the stack and not dead yet, if any */
+	struct k_thread *owner;
+	bool allocated;
+#ifdef CONFIG_INIT_STACKS
+	/* Buffer of the last thread created on the stack, and size of its
+	 * low end that still holds the stack fill pattern
+	 */
+	uintptr_t buf_start;
+	size_t buf_size;
+	size_t clean;
+#endif /* CONFIG_INIT_STACKS */
+};
+
+/* A pool of stacks of the same size. Free stacks are kept on a LIFO of
+ * indexes, so that allocation and release are constant time and that
+ * the most recently used, cache-hot stacks are handed out first.
+ */
+struct dyn_stack_class {
+	char *base;
+	size_t stride;
+	size_t stack_size;
+	uint16_t num_stacks;
+	/* Stacks handed out at least once, the others are all free */
+	uint16_t num_used;
+	uint16_t num_free;
+	uint16_t *free;
+	struct dyn_stack_slot *slots;
+};
+
+#define DYN_POOL_LEN(n) MAX((n), 1)
+#define DYN_POOL_STACKS (CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE + \
+			 CONFIG_DYNAMIC_THREAD_POOL_SIZE)
+
+static K_THREAD_STACK_ARRAY_DEFINE(dynamic_stack_small,
+				   CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE,
+				   CONFIG_DYNAMIC_THREAD_SMALL_STACK_SIZE);
+static uint16_t dyn_free_small[DYN_POOL_LEN(CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE)];
+static struct dyn_stack_slot dyn_slots_small[DYN_POOL_LEN(CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE)];
+
 static K_THREAD_STACK_ARRAY_DEFINE(dynamic_stack, CONFIG_DYNAMIC_THREAD_POOL_SIZE,
 				   CONFIG_DYNAMIC_THREAD_STACK_SIZE);
-SYS_BITARRAY_DEFINE_STATIC(dynamic_ba, BA_SIZE);
+static uint16_t dyn_free[DYN_POOL_LEN(CONFIG_DYNAMIC_THREAD_POOL_SIZE)];
+static struct dyn_stack_slot dyn_slots[DYN_POOL_LEN(CONFIG_DYNAMIC_THREAD_POOL_SIZE)];
+
+/* By increasing stack size */
+static struct dyn_stack_class dyn_classes[] = {
+	{
+		.base = (char *)dynamic_stack_small,
+		.stride = sizeof(dynamic_stack_small[0]),
+		.stack_size = CONFIG_DYNAMIC_THREAD_SMALL_STACK_SIZE,
+		.num_stacks = CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE,
+		.free = dyn_free_small,
+		.slots = dyn_slots_small,
+	},
+	{
+		.base = (char *)dynamic_stack,
+		.stride = sizeof(dynamic_stack[0]),
+		.stack_size = CONFIG_DYNAMIC_THREAD_STACK_SIZE,
+		.num_stacks = CONFIG_DYNAMIC_THREAD_POOL_SIZE,
+		.free = dyn_free,
+		.slots = dyn_slots,
+	},
+};
+
+static struct k_spinlock dyn_lock;
+
+/* Find the pool stack containing an address */
+static struct dyn_stack_class *stack_class_find(uintptr_t addr, size_t *idx)
+{
+	ARRAY_FOR_EACH_PTR(dyn_classes, cls) {
+		uintptr_t base = (uintptr_t)cls->base;
+
+		if ((addr >= base) &&
+		    (addr < (base + (cls->num_stacks * cls->stride)))) {
+			*idx = (addr - base) / cls->stride;
+			return cls;
+		}
+	}
+
+	return NULL;
+}
 
 static k_thread_stack_t *z_thread_stack_alloc_dyn(size_t align, size_t size)
 {
@@ -38,29 +111,147 @@ static k_thread_stack_t *z_thread_stack_alloc_dyn(size_t align, size_t size)
 
 static k_thread_stack_t *z_thread_stack_alloc_pool(size_t size)
 {
-	int rv;
-	size_t offset;
-	k_thread_stack_t *stack;
+	k_thread_stack_t *stack = NULL;
+	k_spinlock_key_t key = k_spin_lock(&dyn_lock);
 
-	if (size > CONFIG_DYNAMIC_THREAD_STACK_SIZE) {
-		LOG_DBG("stack size %zu is > pool stack size %d", size,
-			CONFIG_DYNAMIC_THREAD_STACK_SIZE);
-		return NULL;
-	}
+	/* Smallest class that fits and has a free stack */
+	ARRAY_FOR_EACH_PTR(dyn_classes, cls) {
+		size_t idx;
 
-	rv = sys_bitarray_alloc(&dynamic_ba, 1, &offset);
-	if (rv < 0) {
-		LOG_DBG("unable to allocate stack from pool");
-		return NULL;
+		if (size > cls->stack_size) {
+			continue;
+		}
+
+		if (cls->num_free > 0) {
+			idx = cls->free[--cls->num_free];
+		} else if (cls->num_used < cls->num_stacks) {
+			idx = cls->num_used++;
+		} else {
+			continue;
+		}
+
+		__ASSERT_NO_MSG(!cls->slots[idx].allocated);
+		cls->slots[idx].allocated = true;
+		cls->slots[idx].owner = NULL;
+		stack = (k_thread_stack_t *)(cls->base + (idx * cls->stride));
+		break;
 	}
 
-	__ASSERT_NO_MSG(offset < CONFIG_DYNAMIC_THREAD_POOL_SIZE);
+	k_spin_unlock(&dyn_lock, key);
 
-	stack = (k_thread_stack_t *)&dynamic_stack[offset];
+	if (stack == NULL) {
+		LOG_DBG("unable to allocate stack of size %zu from pool", size);
+	}
 
 	return stack;
 }
 
+static int z_thread_stack_free_pool(struct dyn_stack_class *cls, size_t idx,
+				    k_thread_stack_t *stack)
+{
+	struct dyn_stack_slot *slot = &cls->slots[idx];
+	k_spinlock_key_t key = k_spin_lock(&dyn_lock);
+
+	if (((char *)stack != (cls->base + (idx * cls->stride))) ||
+	    !slot->allocated) {
+		k_spin_unlock(&dyn_lock, key);
+		LOG_ERR("stack %p is not allocated!", stack);
+		return -EINVAL;
+	}
+
+	if (slot->owner != NULL) {
+		k_spin_unlock(&dyn_lock, key);
+		LOG_ERR("tid %p is in use!", slot->owner);
+		return -EBUSY;
+	}
+
+	slot->allocated = false;
+	k_spin_unlock(&dyn_lock, key);
+
+#ifdef CONFIG_INIT_STACKS
+	/* Measure the high water mark now, so that the next thread only
+	 * has to refill the part of the stack that was actually used.
+	 */
+	size_t unused;
+
+	slot->clean = 0;
+	if ((slot->buf_size != 0) &&
+	    (z_stack_space_get((const uint8_t *)slot->buf_start, slot->buf_size,
+			       &unused) == 0)) {
+		slot->clean = unused;
+		if (IS_ENABLED(CONFIG_STACK_SENTINEL)) {
+			slot->clean += 4;
+		}
+	}
+#endif /* CONFIG_INIT_STACKS */
+
+	key = k_spin_lock(&dyn_lock);
+	cls->free[cls->num_free++] = idx;
+	k_spin_unlock(&dyn_lock, key);
+
+	return 0;
+}
+
+void z_thread_stack_pool_attach(struct k_thread *thread, k_thread_stack_t *stack)
+{
+	struct dyn_stack_class *cls;
+	k_spinlock_key_t key;
+	size_t idx;
+
+	cls = stack_class_find((uintptr_t)stack, &idx);
+	if (cls == NULL) {
+		return;
+	}
+
+	key = k_spin_lock(&dyn_lock);
+	cls->slots[idx].owner = thread;
+#ifdef CONFIG_INIT_STACKS
+	cls->slots[idx].buf_start = thread->stack_info.start;
+	cls->slots[idx].buf_size = thread->stack_info.size;
+#endif /* CONFIG_INIT_STACKS */
+	k_spin_unlock(&dyn_lock, key);
+}
+
+void z_thread_stack_pool_detach(struct k_thread *thread)
+{
+	struct dyn_stack_class *cls;
+	k_spinlock_key_t key;
+	size_t idx;
+
+	cls = stack_class_find(thread->stack_info.start, &idx);
+	if (cls == NULL) {
+		return;
+	}
+
+	key = k_spin_lock(&dyn_lock);
+	if (cls->slots[idx].owner == thread) {
+		cls->slots[idx].owner = NULL;
+	}
+	k_spin_unlock(&dyn_lock, key);
+}
+
+#ifdef CONFIG_INIT_STACKS
+size_t z_thread_stack_pool_clean_size(k_thread_stack_t *stack, const char *buf_start)
+{
+	struct dyn_stack_class *cls;
+	k_spinlock_key_t key;
+	size_t idx, clean;
+
+	cls = stack_class_find((uintptr_t)stack, &idx);
+	if (cls == NULL) {
+		return 0;
+	}
+
+	key = k_spin_lock(&dyn_lock);
+	clean = (cls->slots[idx].buf_start == (uintptr_t)buf_start) ?
+		cls->slots[idx].clean : 0;
+	cls->slots[idx].clean = 0;
+	k_spin_unlock(&dyn_lock, key);
+
+	return clean;
+}
+#endif /* CONFIG_INIT_STACKS */
+
 static k_thread_stack_t *stack_alloc_dyn(size_t size, int flags)
 {
 	if ((flags & K_USER) == K_USER) {
@@ -84,11 +275,11 @@ k_thread_stack_t *z_impl_k_thread_stack_alloc(size_t size, int flags)
 
 	if (IS_ENABLED(CONFIG_DYNAMIC_THREAD_PREFER_ALLOC)) {
 		stack = stack_alloc_dyn(size, flags);
-		if (stack == NULL && CONFIG_DYNAMIC_THREAD_POOL_SIZE > 0) {
+		if (stack == NULL && DYN_POOL_STACKS > 0) {
 			stack = z_thread_stack_alloc_pool(size);
 		}
 	} else if (IS_ENABLED(CONFIG_DYNAMIC_THREAD_PREFER_POOL)) {
-		if (CONFIG_DYNAMIC_THREAD_POOL_SIZE > 0) {
+		if (DYN_POOL_STACKS > 0) {
 			stack = z_thread_stack_alloc_pool(size);
 		}
 
@@ -123,6 +314,17 @@ int z_impl_k_thread_stack_free(k_thread_stack_t *stack)
 {
 	struct dyn_cb_data data = {.stack = stack};
 
+	if (DYN_POOL_STACKS > 0) {
+		struct dyn_stack_class *cls;
+		size_t idx;
+
+		/* Pool stacks know which thread uses them */
+		cls = stack_class_find((uintptr_t)stack, &idx);
+		if (cls != NULL) {
+			return z_thread_stack_free_pool(cls, idx, stack);
+		}
+	}
+
 	/* Get a possible tid associated with stack */
 	k_thread_foreach(dyn_cb, &data);
 
@@ -134,17 +336,6 @@ int z_impl_k_thread_stack_free(k_thread_stack_t *stack)
 		}
 	}
 
-	if (CONFIG_DYNAMIC_THREAD_POOL_SIZE > 0) {
-		if (IS_ARRAY_ELEMENT(dynamic_stack, stack)) {
-			if (sys_bitarray_free(&dynamic_ba, 1, ARRAY_INDEX(dynamic_stack, stack))) {
-				LOG_ERR("stack %p is not allocated!", stack);
-				return -EINVAL;
-			}
-
-			return 0;
-		}
-	}
-
 	if (IS_ENABLED(CONFIG_DYNAMIC_THREAD_ALLOC)) {
 #ifdef CONFIG_USERSPACE
 		if (k_object_find(stack)) {
@@ -13,7 +13,8 @@
  * are posted to an event object, all threads waiting on that event object are
  * processed to determine if there is a match. All threads that whose wait
  * conditions match the current set of events now belonging to the event object
- * are awakened.
+ * are awakened. With CONFIG_EVENTS_WAIT_INDEX, only the threads waiting for one
+ * of the newly delivered events are processed.
  *
  * Threads waiting on an event object have the option of either waking once
  * any or all of the events it desires have been posted to the event object.
@@ -23,6 +24,7 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/kernel_structs.h>
+#include <string.h>
 
 #include <zephyr/toolchain.h>
 #include <zephyr/sys/dlist.h>
@@ -30,6 +32,7 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/math_extras.h>
 /* private kernel APIs */
 #include <wait_q.h>
 #include <ksched.h>
@@ -43,8 +46,26 @@
 struct event_walk_data {
 	struct k_thread  *head;
 	uint32_t events;
+	uint32_t wait_mask;
 };
 
+#ifdef CONFIG_EVENTS_WAIT_SET
+/* A thread waiting on several event objects */
+struct event_set_waiter {
+	struct k_spinlock lock;
+	_wait_q_t wait_q;
+	bool fired;
+};
+
+/* Registration of an event_set_waiter on one event object */
+struct event_watcher {
+	sys_dnode_t node;
+	struct event_set_waiter *waiter;
+	uint32_t events;
+	uint32_t matched;
+};
+#endif /* CONFIG_EVENTS_WAIT_SET */
+
 #ifdef CONFIG_OBJ_CORE_EVENT
 static struct k_obj_type obj_type_event;
 #endif /* CONFIG_OBJ_CORE_EVENT */
@@ -58,6 +79,17 @@ void z_impl_k_event_init(struct k_event *event)
 
 	z_waitq_init(&event->wait_q);
 
+#ifdef CONFIG_EVENTS_WAIT_INDEX
+	ARRAY_FOR_EACH(event->bit_wait_q, i) {
+		z_waitq_init(&event->bit_wait_q[i]);
+	}
+	event->wait_mask = 0;
+#endif /* CONFIG_EVENTS_WAIT_INDEX */
+
+#ifdef CONFIG_EVENTS_WAIT_SET
+	sys_dlist_init(&event->watchers);
+#endif /* CONFIG_EVENTS_WAIT_SET */
+
 	k_object_init(event);
 
 #ifdef CONFIG_OBJ_CORE_EVENT
@@ -123,11 +155,91 @@ static int event_walk_op(struct k_thread *thread, void *data)
 		thread->next_event_link = event_data->head;
 		event_data->head = thread;
 		z_abort_timeout(&thread->base.timeout);
+	} else {
+		event_data->wait_mask |= thread->events;
 	}
 
 	return 0;
 }
 
+#ifdef CONFIG_EVENTS_WAIT_INDEX
+/*
+ * Walk the threads that may be woken up by a post. A waiting thread's
+ * conditions are not met, and clearing events cannot meet them: only
+ * the threads waiting for one of the newly set events need a look.
+ */
+static void event_walk(struct k_event *event, struct event_walk_data *data,
+		       uint32_t new_events)
+{
+	uint32_t buckets = 0;
+
+	if ((new_events & event->wait_mask) != 0U) {
+		data->wait_mask = 0;
+		z_sched_waitq_walk(&event->wait_q, event_walk_op, data);
+		/* Threads which timed out since the last walk are gone */
+		event->wait_mask = data->wait_mask;
+	}
+
+	while (new_events != 0U) {
+		int bit = u32_count_trailing_zeros(new_events);
+
+		buckets |= BIT(bit % CONFIG_EVENTS_WAIT_BUCKETS);
+		new_events &= ~BIT(bit);
+	}
+
+	while (buckets != 0U) {
+		int bucket = u32_count_trailing_zeros(buckets);
+
+		z_sched_waitq_walk(&event->bit_wait_q[bucket], event_walk_op,
+				   data);
+		buckets &= ~BIT(bucket);
+	}
+}
+
+static _wait_q_t *event_wait_q_get(struct k_event *event, uint32_t events)
+{
+	if (IS_POWER_OF_TWO(events)) {
+		return &event->bit_wait_q[u32_count_trailing_zeros(events) %
+					  CONFIG_EVENTS_WAIT_BUCKETS];
+	}
+
+	event->wait_mask |= events;
+
+	return &event->wait_q;
+}
+#endif /* CONFIG_EVENTS_WAIT_INDEX */
+
+#ifdef CONFIG_EVENTS_WAIT_SET
+static void event_watchers_fire(struct k_event *event, uint32_t events,
+				uint32_t new_events)
+{
+	struct event_watcher *watcher;
+
+	/* As with waiting threads, only newly set events can meet the
+	 * conditions of a watcher
+	 */
+	SYS_DLIST_FOR_EACH_CONTAINER(&event->watchers, watcher, node) {
+		struct event_set_waiter *waiter = watcher->waiter;
+		struct k_thread *thread;
+		k_spinlock_key_t key;
+
+		if ((watcher->events & new_events) == 0U) {
+			continue;
+		}
+
+		key = k_spin_lock(&waiter->lock);
+		watcher->matched = events & watcher->events;
+		waiter->fired = true;
+		thread = z_unpend_first_thread(&waiter->wait_q);
+		if (thread != NULL) {
+			arch_thread_return_value_set(thread, 0);
+			z_ready_thread(thread);
+		}
+		k_spin_unlock(&waiter->lock, key);
+	}
+}
+#endif /* CONFIG_EVENTS_WAIT_SET */
+
 static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 				  uint32_t events_mask)
 {
@@ -137,6 +249,7 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 	uint32_t previous_events;
 
 	data.head = NULL;
+	data.wait_mask = 0;
 	key = k_spin_lock(&event->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_event, post, event, events,
@@ -145,6 +258,9 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 	previous_events = event->events & events_mask;
 	events = (event->events & ~events_mask) |
 		 (events & events_mask);
+#if defined(CONFIG_EVENTS_WAIT_INDEX) || defined(CONFIG_EVENTS_WAIT_SET)
+	uint32_t new_events = events & ~event->events;
+#endif /* CONFIG_EVENTS_WAIT_INDEX || CONFIG_EVENTS_WAIT_SET */
 	event->events = events;
 	data.events = events;
 	/*
@@ -157,7 +273,11 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 	 * 3. Ready each of the threads in the linked list
 	 */
 
+#ifdef CONFIG_EVENTS_WAIT_INDEX
+	event_walk(event, &data, new_events);
+#else
 	z_sched_waitq_walk(&event->wait_q, event_walk_op, &data);
+#endif /* CONFIG_EVENTS_WAIT_INDEX */
 
 	if (data.head != NULL) {
 		thread = data.head;
@@ -171,6 +291,10 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 		} while (thread != NULL);
 	}
 
+#ifdef CONFIG_EVENTS_WAIT_SET
+	event_watchers_fire(event, events, new_events);
+#endif /* CONFIG_EVENTS_WAIT_SET */
+
 	z_reschedule(&event->lock, key);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_event, post, event, events,
@@ -243,6 +367,7 @@ static uint32_t k_event_wait_internal(struct k_event *event, uint32_t events,
 	uint32_t  rv = 0;
 	unsigned int  wait_condition;
 	struct k_thread  *thread;
+	_wait_q_t  *wait_q;
 
 	__ASSERT(((arch_is_in_isr() == false) ||
 		  K_TIMEOUT_EQ(timeout, K_NO_WAIT)), "");
@@ -288,10 +413,16 @@ static uint32_t k_event_wait_internal(struct k_event *event, uint32_t events,
 	thread->events = events;
 	thread->event_options = options;
 
+#ifdef CONFIG_EVENTS_WAIT_INDEX
+	wait_q = event_wait_q_get(event, events);
+#else
+	wait_q = &event->wait_q;
+#endif /* CONFIG_EVENTS_WAIT_INDEX */
+
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_event, wait, event, events,
 					   options, timeout);
 
-	if (z_pend_curr(&event->lock, key, &event->wait_q, timeout) == 0) {
+	if (z_pend_curr(&event->lock, key, wait_q, timeout) == 0) {
 		/* Retrieve the set of events that woke the thread */
 		rv = thread->events;
 	}
@@ -345,6 +476,110 @@ uint32_t z_vrfy_k_event_wait_all(struct k_event *event, uint32_t events,
 #include <syscalls/k_event_wait_all_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_EVENTS_WAIT_SET
+int z_impl_k_event_wait_any_of_set(struct k_event_wait_desc *descs,
+				   size_t num_descs, k_timeout_t timeout)
+{
+	struct event_watcher watchers[CONFIG_EVENTS_WAIT_SET_MAX];
+	struct event_set_waiter waiter = {};
+	size_t num_watched = 0;
+	k_spinlock_key_t key;
+	int ret = -EAGAIN;
+
+	__ASSERT(((arch_is_in_isr() == false) ||
+		  K_TIMEOUT_EQ(timeout, K_NO_WAIT)), "");
+
+	if ((num_descs == 0) || (num_descs > CONFIG_EVENTS_WAIT_SET_MAX)) {
+		return -EINVAL;
+	}
+
+	z_waitq_init(&waiter.wait_q);
+
+	for (size_t i = 0; i < num_descs; i++) {
+		descs[i].matched = 0;
+	}
+
+	/* Watch each event object, unless its events are already there */
+	for (size_t i = 0; i < num_descs; i++) {
+		struct k_event *event = descs[i].event;
+
+		key = k_spin_lock(&event->lock);
+
+		descs[i].matched = event->events & descs[i].events;
+		if (descs[i].matched != 0U) {
+			k_spin_unlock(&event->lock, key);
+			ret = i;
+			break;
+		}
+
+		watchers[i].waiter = &waiter;
+		watchers[i].events = descs[i].events;
+		watchers[i].matched = 0;
+		sys_dlist_append(&event->watchers, &watchers[i].node);
+		num_watched++;
+
+		k_spin_unlock(&event->lock, key);
+	}
+
+	if ((ret < 0) && !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		key = k_spin_lock(&waiter.lock);
+		if (waiter.fired) {
+			k_spin_unlock(&waiter.lock, key);
+		} else {
+			(void)z_pend_curr(&waiter.lock, key, &waiter.wait_q,
+					  timeout);
+		}
+	}
+
+	/* Events may still be posted while the watchers are removed */
+	for (size_t i = 0; i < num_watched; i++) {
+		struct k_event *event = descs[i].event;
+
+		key = k_spin_lock(&event->lock);
+		sys_dlist_remove(&watchers[i].node);
+		k_spin_unlock(&event->lock, key);
+
+		descs[i].matched = watchers[i].matched;
+		if ((ret < 0) && (descs[i].matched != 0U)) {
+			ret = i;
+		}
+	}
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+int z_vrfy_k_event_wait_any_of_set(struct k_event_wait_desc *descs,
+				   size_t num_descs, k_timeout_t timeout)
+{
+	struct k_event_wait_desc copy[CONFIG_EVENTS_WAIT_SET_MAX];
+	int ret;
+
+	if ((num_descs == 0) || (num_descs > CONFIG_EVENTS_WAIT_SET_MAX)) {
+		return -EINVAL;
+	}
+
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(descs, num_descs,
+					    sizeof(struct k_event_wait_desc)));
+
+	/* Work on a copy the caller cannot change behind our back */
+	memcpy(copy, descs, num_descs * sizeof(struct k_event_wait_desc));
+	for (size_t i = 0; i < num_descs; i++) {
+		K_OOPS(K_SYSCALL_OBJ(copy[i].event, K_OBJ_EVENT));
+	}
+
+	ret = z_impl_k_event_wait_any_of_set(copy, num_descs, timeout);
+
+	for (size_t i = 0; i < num_descs; i++) {
+		descs[i].matched = copy[i].matched;
+	}
+
+	return ret;
+}
+#include <syscalls/k_event_wait_any_of_set_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+#endif /* CONFIG_EVENTS_WAIT_SET */
+
 #ifdef CONFIG_OBJ_CORE_EVENT
 static int init_event_obj_core_list(void)
 {
@@ -160,6 +160,22 @@ extern uint8_t *z_priv_stack_find(k_thread_stack_t *stack);
 /* Calculate stack usage. */
 int z_stack_space_get(const uint8_t *stack_start, size_t size, size_t *unused_ptr);
 
+#ifdef CONFIG_DYNAMIC_THREAD
+/* Dynamic stack pool hooks: record the thread created on a pool stack,
+ * called from z_setup_new_thread(), and forget it when it dies, called
+ * from the scheduler with the thread halted.
+ */
+void z_thread_stack_pool_attach(struct k_thread *thread, k_thread_stack_t *stack);
+void z_thread_stack_pool_detach(struct k_thread *thread);
+
+#ifdef CONFIG_INIT_STACKS
+/* Size of the low end of a recycled pool stack buffer still holding the
+ * stack fill pattern, 0 if unknown. Consumes the value.
+ */
+size_t z_thread_stack_pool_clean_size(k_thread_stack_t *stack, const char *buf_start);
+#endif /* CONFIG_INIT_STACKS */
+#endif /* CONFIG_DYNAMIC_THREAD */
+
 #ifdef CONFIG_USERSPACE
 bool z_stack_is_user_capable(k_thread_stack_t *stack);
 
@@ -222,6 +238,13 @@ void z_mem_manage_boot_finish(void);
 
 void z_handle_obj_poll_events(sys_dlist_t *events, uint32_t state);
 
+#ifdef CONFIG_QUEUE_LOCKFREE
+/* Force appends to a polled queue through the locked path, so that they
+ * signal its poll events.
+ */
+void z_queue_poll_register(struct k_queue *queue);
+#endif /* CONFIG_QUEUE_LOCKFREE */
+
 #ifdef CONFIG_PM
 
 /* When the kernel is about to go idle, it calls this function to notify the
@@ -281,6 +304,20 @@ void z_paging_histogram_inc(struct k_mem_paging_histogram_t *hist,
 			    uint32_t cycles);
 #endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
 
+#ifdef CONFIG_DEMAND_PAGING_STATS
+/**
+ * Account for the page frames examined by the eviction algorithm.
+ *
+ * Called by eviction algorithms from k_mem_paging_eviction_select(),
+ * with interrupts locked.
+ *
+ * @param scanned Number of evictable page frames examined.
+ * @param referenced Number of those found recently accessed.
+ */
+void z_paging_stats_eviction_scan(unsigned long scanned,
+				  unsigned long referenced);
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+
 #ifdef CONFIG_OBJ_CORE_STATS_THREAD
 int z_thread_stats_raw(struct k_obj_core *obj_core, void *stats);
 int z_thread_stats_query(struct k_obj_core *obj_core, void *stats);
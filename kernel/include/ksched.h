@@ -65,6 +65,11 @@ void z_thread_abort(struct k_thread *thread);
 void move_thread_to_end_of_prio_q(struct k_thread *thread);
 bool thread_is_sliceable(struct k_thread *thread);
 
+#ifdef CONFIG_CPU_DOMAINS
+/* Cache domain of each CPU, filled in at PRE_KERNEL_1 */
+extern uint8_t z_cpu_domains[CONFIG_MP_MAX_NUM_CPUS];
+#endif /* CONFIG_CPU_DOMAINS */
+
 static inline void z_reschedule_unlocked(void)
 {
 	(void) z_reschedule_irqlock(arch_irq_lock());
@@ -25,6 +25,38 @@ extern "C" {
 static inline void z_init_timeout(struct _timeout *to)
 {
 	sys_dnode_init(&to->node);
+#ifdef CONFIG_TIMEOUT_SLACK
+	to->slack = 0U;
+	to->late = 0U;
+#endif /* CONFIG_TIMEOUT_SLACK */
+}
+
+/* Slack in ticks applied by the next z_add_timeout() of @a to */
+static inline void z_set_timeout_slack(struct _timeout *to, k_timeout_t slack)
+{
+#ifdef CONFIG_TIMEOUT_SLACK
+	__ASSERT(!K_TIMEOUT_EQ(slack, K_FOREVER) &&
+		 !(IS_ENABLED(CONFIG_TIMEOUT_64BIT) && (Z_TICK_ABS(slack.ticks) >= 0)),
+		 "slack must be a finite relative timeout");
+	to->slack = (uint32_t)MIN((uint64_t)slack.ticks, (uint64_t)INT32_MAX);
+#else
+	ARG_UNUSED(to);
+	ARG_UNUSED(slack);
+#endif /* CONFIG_TIMEOUT_SLACK */
+}
+
+/* Ticks between the nominal expiry of @a to and the tick at which it
+ * actually fired, only meaningful from within its expiry function.
+ */
+static inline k_ticks_t z_timeout_late(const struct _timeout *to)
+{
+#ifdef CONFIG_TIMEOUT_SLACK
+	return to->late;
+#else
+	ARG_UNUSED(to);
+
+	return 0;
+#endif /* CONFIG_TIMEOUT_SLACK */
 }
 
 void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
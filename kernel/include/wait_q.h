@@ -38,6 +38,14 @@ static inline struct k_thread *z_waitq_head(_wait_q_t *w)
 	return (struct k_thread *)rb_get_min(&w->waitq.tree);
 }
 
+/* Whether no thread is pended on @w. Only reads the root of the tree, so
+ * it may be called without the lock protecting @w, as a hint.
+ */
+static inline bool z_waitq_is_empty(_wait_q_t *w)
+{
+	return *(struct rbnode *volatile *)&w->waitq.tree.root == NULL;
+}
+
 #else /* !CONFIG_WAITQ_SCALABLE: */
 
 #define _WAIT_Q_FOR_EACH(wq, thread_ptr) \
@@ -54,6 +62,14 @@ static inline struct k_thread *z_waitq_head(_wait_q_t *w)
 	return (struct k_thread *)sys_dlist_peek_head(&w->waitq);
 }
 
+/* Whether no thread is pended on @w. Only reads the head of the list, so
+ * it may be called without the lock protecting @w, as a hint.
+ */
+static inline bool z_waitq_is_empty(_wait_q_t *w)
+{
+	return *(sys_dnode_t *volatile *)&w->waitq.head == &w->waitq;
+}
+
 #endif /* !CONFIG_WAITQ_SCALABLE */
 
 #ifdef __cplusplus
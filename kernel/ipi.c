@@ -6,22 +6,98 @@
 #include <zephyr/kernel.h>
 #include <kswap.h>
 #include <ksched.h>
+#include <kthread.h>
 #include <ipi.h>
 
 #ifdef CONFIG_TRACE_SCHED_IPI
 extern void z_trace_sched_ipi(void);
 #endif
 
+#ifdef CONFIG_SCHED_IPI_STATS
+/* Account for the CPUs an IPI being sent interrupts, and the ones
+ * spared compared to broadcasting it.
+ */
+static void ipi_stats_update(uint32_t ipi_mask)
+{
+	uint32_t others = (uint32_t)arch_num_cpus() - 1U;
+	uint32_t sent;
+
+	ipi_mask &= ~BIT(_current_cpu->id) & IPI_ALL_CPUS_MASK;
+	sent = (uint32_t)POPCOUNT(ipi_mask);
 
-void flag_ipi(void)
+	/* Without directed IPIs every other CPU gets interrupted */
+	if (!IS_ENABLED(CONFIG_ARCH_HAS_DIRECTED_IPIS) && (sent != 0U)) {
+		sent = others;
+	}
+
+	atomic_add(&_current_cpu->ipi_stats.sent, (atomic_val_t)sent);
+	atomic_add(&_current_cpu->ipi_stats.avoided,
+		   (atomic_val_t)(others - MIN(sent, others)));
+}
+#endif /* CONFIG_SCHED_IPI_STATS */
+
+void flag_ipi(uint32_t ipi_mask)
 {
 #if defined(CONFIG_SCHED_IPI_SUPPORTED)
 	if (arch_num_cpus() > 1) {
-		_kernel.pending_ipi = true;
+#ifdef CONFIG_SCHED_IPI_STATS
+		/* Nothing will be sent for an empty mask, so the CPUs it
+		 * spares must be counted here.
+		 */
+		if (ipi_mask == 0U) {
+			ipi_stats_update(0U);
+		}
+#endif /* CONFIG_SCHED_IPI_STATS */
+		atomic_or(&_kernel.pending_ipi, (atomic_val_t)ipi_mask);
 	}
+#else
+	ARG_UNUSED(ipi_mask);
 #endif /* CONFIG_SCHED_IPI_SUPPORTED */
 }
 
+/* Create a bitmask of CPUs that need an IPI. Note: sched_spinlock is held. */
+uint32_t ipi_mask_create(struct k_thread *thread)
+{
+	if (!IS_ENABLED(CONFIG_IPI_OPTIMIZE)) {
+		return (CONFIG_MP_MAX_NUM_CPUS > 1) ? IPI_ALL_CPUS_MASK : 0;
+	}
+
+	uint32_t  ipi_mask = 0;
+	uint32_t  num_cpus = (uint32_t)arch_num_cpus();
+	uint32_t  id = _current_cpu->id;
+	struct k_thread *cpu_thread;
+	bool   executable_on_cpu = true;
+
+	for (uint32_t i = 0; i < num_cpus; i++) {
+		if (id == i) {
+			continue;
+		}
+
+		/*
+		 * An IPI absolutely does not need to be sent if ...
+		 * 1. the CPU is not active, or
+		 * 2. <thread> can not execute on the target CPU
+		 * ... and might not need to be sent if ...
+		 * 3. the target CPU's active thread is not preemptible, or
+		 * 4. the target CPU's active thread has a higher priority
+		 *    (Items 3 & 4 may be overridden by a metaIRQ thread)
+		 */
+
+#if defined(CONFIG_SCHED_CPU_MASK)
+		executable_on_cpu = ((thread->base.cpu_mask & BIT(i)) != 0);
+#endif /* CONFIG_SCHED_CPU_MASK */
+
+		cpu_thread = _kernel.cpus[i].current;
+		if ((cpu_thread != NULL) &&
+		    (((z_sched_prio_cmp(cpu_thread, thread) < 0) &&
+		      (thread_is_preemptible(cpu_thread))) ||
+		     thread_is_metairq(thread)) && executable_on_cpu) {
+			ipi_mask |= BIT(i);
+		}
+	}
+
+	return ipi_mask;
+}
 
 void signal_pending_ipi(void)
 {
@@ -34,9 +110,21 @@ void signal_pending_ipi(void)
 	 */
 #if defined(CONFIG_SCHED_IPI_SUPPORTED)
 	if (arch_num_cpus() > 1) {
-		if (_kernel.pending_ipi) {
-			_kernel.pending_ipi = false;
+		uint32_t  cpu_bitmap;
+
+		cpu_bitmap = (uint32_t)atomic_clear(&_kernel.pending_ipi);
+		if (cpu_bitmap != 0) {
+#ifdef CONFIG_SCHED_IPI_STATS
+			/* Requests flagged since the last IPI are coalesced
+			 * into this one, so count what is actually sent.
+			 */
+			ipi_stats_update(cpu_bitmap);
+#endif /* CONFIG_SCHED_IPI_STATS */
+#ifdef CONFIG_ARCH_HAS_DIRECTED_IPIS
+			arch_sched_directed_ipi(cpu_bitmap);
+#else
 			arch_sched_ipi();
+#endif /* CONFIG_ARCH_HAS_DIRECTED_IPIS */
 		}
 	}
 #endif /* CONFIG_SCHED_IPI_SUPPORTED */
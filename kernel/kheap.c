@@ -8,6 +8,7 @@
 #include <zephyr/init.h>
 #include <zephyr/linker/linker-defs.h>
 #include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys/barrier.h>
 /* private kernel APIs */
 #include <ksched.h>
 #include <wait_q.h>
@@ -16,6 +17,10 @@ void k_heap_init(struct k_heap *heap, void *mem, size_t bytes)
 {
 	z_waitq_init(&heap->wait_q);
 	sys_heap_init(&heap->heap, mem, bytes);
+#ifdef CONFIG_SYS_HEAP_CACHE
+	sys_heap_cache_init(&heap->cache, &heap->heap, sizeof(void *));
+	atomic_set(&heap->waiters, 0);
+#endif
 
 	SYS_PORT_TRACING_OBJ_INIT(k_heap, heap);
 }
@@ -62,12 +67,33 @@ SYS_INIT_NAMED(statics_init_pre, statics_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_
 SYS_INIT_NAMED(statics_init_post, statics_init, POST_KERNEL, 0);
 #endif /* CONFIG_DEMAND_PAGING && !CONFIG_LINKER_GENERIC_SECTIONS_PRESENT_AT_BOOT */
 
+/* Allocate with the heap lock held, through the per-CPU cache if any */
+static inline void *heap_alloc_locked(struct k_heap *heap, size_t align,
+				      size_t bytes)
+{
+#ifdef CONFIG_SYS_HEAP_CACHE
+	return sys_heap_cache_alloc_locked(&heap->cache, align, bytes);
+#else
+	return sys_heap_aligned_alloc(&heap->heap, align, bytes);
+#endif
+}
+
 void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 			k_timeout_t timeout)
 {
 	k_timepoint_t end = sys_timepoint_calc(timeout);
 	void *ret = NULL;
 
+#ifdef CONFIG_SYS_HEAP_CACHE
+	ret = sys_heap_cache_alloc(&heap->cache, align, bytes);
+	if (ret != NULL) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap, aligned_alloc, heap, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, aligned_alloc, heap, timeout, ret);
+
+		return ret;
+	}
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap, aligned_alloc, heap, timeout);
@@ -77,7 +103,7 @@ void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 	bool blocked_alloc = false;
 
 	while (ret == NULL) {
-		ret = sys_heap_aligned_alloc(&heap->heap, align, bytes);
+		ret = heap_alloc_locked(heap, align, bytes);
 
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
@@ -88,6 +114,15 @@ void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 			blocked_alloc = true;
 
 			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_heap, aligned_alloc, heap, timeout);
+#ifdef CONFIG_SYS_HEAP_CACHE
+			/* Unlocked frees check the waiter count after caching
+			 * their block.  Blocks cached before it went up are
+			 * flushed back by this retry, later ones get flushed
+			 * by the freeing thread, which then wakes us up.
+			 */
+			atomic_inc(&heap->waiters);
+			continue;
+#endif
 		} else {
 			/**
 			 * @todo	Trace attempt to avoid empty trace segments
@@ -99,6 +134,12 @@ void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 		key = k_spin_lock(&heap->lock);
 	}
 
+#ifdef CONFIG_SYS_HEAP_CACHE
+	if (blocked_alloc) {
+		atomic_dec(&heap->waiters);
+	}
+#endif
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, aligned_alloc, heap, timeout, ret);
 
 	k_spin_unlock(&heap->lock, key);
@@ -118,9 +159,46 @@ void *k_heap_alloc(struct k_heap *heap, size_t bytes, k_timeout_t timeout)
 
 void k_heap_free(struct k_heap *heap, void *mem)
 {
+#ifdef CONFIG_SYS_HEAP_CACHE
+	if (sys_heap_cache_free(&heap->cache, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, heap);
+
+		/* Order the caching before the waiter check, against
+		 * the increment and flush of k_heap_aligned_alloc().
+		 */
+		barrier_dmem_fence_full();
+		if (atomic_get(&heap->waiters) == 0) {
+			return;
+		}
+
+		/* A waiter flushed the caches before this block got
+		 * in, hand it over.
+		 */
+		k_spinlock_key_t key = k_spin_lock(&heap->lock);
+
+		sys_heap_cache_flush_locked(&heap->cache);
+		if (IS_ENABLED(CONFIG_MULTITHREADING) &&
+		    z_unpend_all(&heap->wait_q) != 0) {
+			z_reschedule(&heap->lock, key);
+		} else {
+			k_spin_unlock(&heap->lock, key);
+		}
+		return;
+	}
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
+#ifdef CONFIG_SYS_HEAP_CACHE
+	/* Memory a waiter can use must go straight back to the heap */
+	if (atomic_get(&heap->waiters) == 0) {
+		sys_heap_cache_free_locked(&heap->cache, mem);
+	} else {
+		sys_heap_free(&heap->heap, mem);
+	}
+#else
 	sys_heap_free(&heap->heap, mem);
+#endif
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, heap);
 	if (IS_ENABLED(CONFIG_MULTITHREADING) && z_unpend_all(&heap->wait_q) != 0) {
@@ -0,0 +1,593 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+
+#include <zephyr/init.h>
+#include <zephyr/sys/check.h>
+#include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/sys/barrier.h>
+#include <string.h>
+
+#define CACHE_DEPTH	CONFIG_MEM_CACHE_PER_CPU_DEPTH
+#define CACHE_BATCH	MAX(CACHE_DEPTH / 2, 1)
+#define NO_CLASS	(-1)
+
+#ifdef CONFIG_OBJ_CORE_MEM_CACHE
+static struct k_obj_type obj_type_mem_cache;
+static struct k_obj_type obj_type_mem_cache_class;
+#endif /* CONFIG_OBJ_CORE_MEM_CACHE */
+
+/* Per-CPU magazines are used by their CPU, under a lock which only
+ * flushes take from other CPUs.  A thread migrating after picking its
+ * CPU still holds the right lock.  Per-CPU statistics are only touched
+ * by their CPU with local interrupts masked.
+ */
+static inline unsigned int cache_cpu_id(void)
+{
+#ifdef CONFIG_SMP
+	return arch_curr_cpu()->id;
+#else
+	return 0;
+#endif /* CONFIG_SMP */
+}
+
+static inline size_t class_size(struct k_mem_cache *cache, int cls)
+{
+	return cache->classes[cls].slab->info.block_size;
+}
+
+#ifdef CONFIG_OBJ_CORE_STATS_MEM_CACHE
+static void info_account(struct k_mem_cache_info *info, bool hit,
+			 bool fallback, bool failed)
+{
+	if (failed) {
+		info->failures++;
+	} else if (hit) {
+		info->hits++;
+	} else {
+		info->misses++;
+	}
+
+	if (fallback) {
+		info->fallbacks++;
+	}
+}
+
+static void info_sum(struct k_mem_cache_info *sum,
+		     const struct k_mem_cache_info *cpu_info)
+{
+	memset(sum, 0, sizeof(*sum));
+	for (int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		sum->hits += cpu_info[cpu].hits;
+		sum->misses += cpu_info[cpu].misses;
+		sum->fallbacks += cpu_info[cpu].fallbacks;
+		sum->failures += cpu_info[cpu].failures;
+	}
+}
+#endif /* CONFIG_OBJ_CORE_STATS_MEM_CACHE */
+
+/* Account an allocation to the cache, and to class @cls which served it,
+ * or was the best fit when it failed.
+ */
+static void cache_account(struct k_mem_cache *cache, int cls, bool hit,
+			  bool fallback, bool failed)
+{
+#ifdef CONFIG_OBJ_CORE_STATS_MEM_CACHE
+	unsigned int key = arch_irq_lock();
+	unsigned int cpu = cache_cpu_id();
+
+	info_account(&cache->cpu_info[cpu], hit, fallback, failed);
+	if (cls != NO_CLASS) {
+		info_account(&cache->classes[cls].cpu_info[cpu], hit,
+			     fallback, failed);
+	}
+
+	arch_irq_unlock(key);
+#else
+	ARG_UNUSED(cache);
+	ARG_UNUSED(cls);
+	ARG_UNUSED(hit);
+	ARG_UNUSED(fallback);
+	ARG_UNUSED(failed);
+#endif /* CONFIG_OBJ_CORE_STATS_MEM_CACHE */
+}
+
+/* Smallest class whose blocks can hold @size bytes */
+static int best_class(struct k_mem_cache *cache, size_t size)
+{
+	int cls = cache->order_class[LOG2CEIL(size)];
+
+	while ((cls < cache->num_classes) && (class_size(cache, cls) < size)) {
+		cls++;
+	}
+
+	return (cls < cache->num_classes) ? cls : NO_CLASS;
+}
+
+/* Class owning @obj, found from the slab buffer ranges */
+static int obj_class(struct k_mem_cache *cache, void *obj)
+{
+	for (int cls = 0; cls < cache->num_classes; cls++) {
+		struct k_mem_slab *slab = cache->classes[cls].slab;
+		char *end = slab->buffer +
+			    (slab->info.block_size * slab->info.num_blocks);
+
+		if (((char *)obj >= slab->buffer) && ((char *)obj < end)) {
+			return cls;
+		}
+	}
+
+	return NO_CLASS;
+}
+
+static void *cache_pop(struct k_mem_cache *cache, int cls)
+{
+	void *obj = NULL;
+
+#if CACHE_DEPTH > 0
+	struct k_mem_cache_mag *mag = &cache->classes[cls].mags[cache_cpu_id()];
+	k_spinlock_key_t key = k_spin_lock(&mag->lock);
+
+	if (mag->count > 0U) {
+		obj = mag->objs[--mag->count];
+	}
+
+	k_spin_unlock(&mag->lock, key);
+#else
+	ARG_UNUSED(cache);
+	ARG_UNUSED(cls);
+#endif /* CACHE_DEPTH > 0 */
+
+	return obj;
+}
+
+static void *slab_alloc(struct k_mem_cache *cache, int cls,
+			k_timeout_t timeout)
+{
+	void *obj;
+
+	if (k_mem_slab_alloc(cache->classes[cls].slab, &obj, timeout) != 0) {
+		return NULL;
+	}
+
+	if (cache->ctor != NULL) {
+		cache->ctor(obj, class_size(cache, cls));
+	}
+
+	return obj;
+}
+
+static void slab_free(struct k_mem_cache *cache, int cls, void *obj)
+{
+	if (cache->dtor != NULL) {
+		cache->dtor(obj, class_size(cache, cls));
+	}
+
+	k_mem_slab_free(cache->classes[cls].slab, obj);
+}
+
+#if CACHE_DEPTH > 0
+/* Return a batch of objects to their slab under one slab lock */
+static void slab_free_n(struct k_mem_cache *cache, int cls, void **objs,
+			uint32_t count)
+{
+	if (count == 0U) {
+		return;
+	}
+
+	if (cache->dtor != NULL) {
+		for (uint32_t i = 0; i < count; i++) {
+			cache->dtor(objs[i], class_size(cache, cls));
+		}
+	}
+
+	k_mem_slab_free_n(cache->classes[cls].slab, objs, count);
+}
+
+/* Return the objects of class @cls cached by every CPU to the slab */
+static void class_flush(struct k_mem_cache *cache, int cls)
+{
+	for (int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		struct k_mem_cache_mag *mag = &cache->classes[cls].mags[cpu];
+		void *objs[CACHE_DEPTH];
+		k_spinlock_key_t key = k_spin_lock(&mag->lock);
+		int count = mag->count;
+
+		memcpy(objs, mag->objs, count * sizeof(objs[0]));
+		mag->count = 0U;
+
+		k_spin_unlock(&mag->lock, key);
+
+		slab_free_n(cache, cls, objs, count);
+	}
+}
+#endif /* CACHE_DEPTH > 0 */
+
+static int cache_setup(struct k_mem_cache *cache)
+{
+	int cls = 0;
+
+	CHECKIF((cache->classes == NULL) || (cache->num_classes == 0U)) {
+		return -EINVAL;
+	}
+
+	for (int i = 0; i < cache->num_classes; i++) {
+		CHECKIF(cache->classes[i].slab == NULL) {
+			return -EINVAL;
+		}
+		CHECKIF((i > 0) && (class_size(cache, i) <= class_size(cache, i - 1))) {
+			return -EINVAL;
+		}
+	}
+
+	for (int i = 0; i < cache->num_classes; i++) {
+#if CACHE_DEPTH > 0
+		memset(cache->classes[i].mags, 0, sizeof(cache->classes[i].mags));
+		atomic_set(&cache->classes[i].waiters, 0);
+#endif /* CACHE_DEPTH > 0 */
+#ifdef CONFIG_OBJ_CORE_STATS_MEM_CACHE
+		memset(cache->classes[i].cpu_info, 0,
+		       sizeof(cache->classes[i].cpu_info));
+		memset(&cache->classes[i].info, 0, sizeof(cache->classes[i].info));
+#endif /* CONFIG_OBJ_CORE_STATS_MEM_CACHE */
+#ifdef CONFIG_OBJ_CORE_MEM_CACHE
+		k_obj_core_init_and_link(K_OBJ_CORE(&cache->classes[i]),
+					 &obj_type_mem_cache_class);
+#endif /* CONFIG_OBJ_CORE_MEM_CACHE */
+#ifdef CONFIG_OBJ_CORE_STATS_MEM_CACHE
+		k_obj_core_stats_register(K_OBJ_CORE(&cache->classes[i]),
+					  &cache->classes[i].info,
+					  sizeof(struct k_mem_cache_info));
+#endif /* CONFIG_OBJ_CORE_STATS_MEM_CACHE */
+	}
+
+	/* order_class[n] is the first class larger than 2^(n-1) bytes:
+	 * every class before it is too small for a request of order n.
+	 */
+	for (int order = 0; order < ARRAY_SIZE(cache->order_class); order++) {
+		size_t floor = (order == 0) ? 0 : ((size_t)1 << (order - 1));
+
+		while ((cls < cache->num_classes) && (class_size(cache, cls) <= floor)) {
+			cls++;
+		}
+		cache->order_class[order] = cls;
+	}
+
+#ifdef CONFIG_OBJ_CORE_STATS_MEM_CACHE
+	memset(cache->cpu_info, 0, sizeof(cache->cpu_info));
+	memset(&cache->info, 0, sizeof(cache->info));
+#endif /* CONFIG_OBJ_CORE_STATS_MEM_CACHE */
+
+#ifdef CONFIG_OBJ_CORE_MEM_CACHE
+	k_obj_core_init_and_link(K_OBJ_CORE(cache), &obj_type_mem_cache);
+#endif /* CONFIG_OBJ_CORE_MEM_CACHE */
+#ifdef CONFIG_OBJ_CORE_STATS_MEM_CACHE
+	k_obj_core_stats_register(K_OBJ_CORE(cache), &cache->info,
+				  sizeof(struct k_mem_cache_info));
+#endif /* CONFIG_OBJ_CORE_STATS_MEM_CACHE */
+
+	return 0;
+}
+
+int k_mem_cache_init(struct k_mem_cache *cache,
+		     struct k_mem_cache_class *classes, size_t num_classes,
+		     void (*ctor)(void *obj, size_t size),
+		     void (*dtor)(void *obj, size_t size))
+{
+	CHECKIF(num_classes > UINT8_MAX) {
+		return -EINVAL;
+	}
+
+	cache->classes = classes;
+	cache->num_classes = (uint8_t)num_classes;
+	cache->ctor = ctor;
+	cache->dtor = dtor;
+
+	return cache_setup(cache);
+}
+
+void *k_mem_cache_alloc(struct k_mem_cache *cache, size_t size,
+			k_timeout_t timeout)
+{
+	int best = (size == 0U) ? NO_CLASS : best_class(cache, size);
+	void *obj = NULL;
+
+	if (best == NO_CLASS) {
+		cache_account(cache, NO_CLASS, false, false, true);
+		return NULL;
+	}
+
+	/* Best fit first, then progressively larger classes */
+	for (int cls = best; cls < cache->num_classes; cls++) {
+		obj = cache_pop(cache, cls);
+		if (obj != NULL) {
+			cache_account(cache, cls, true, cls != best, false);
+			return obj;
+		}
+
+		obj = slab_alloc(cache, cls, K_NO_WAIT);
+		if (obj != NULL) {
+			cache_account(cache, cls, false, cls != best, false);
+			return obj;
+		}
+	}
+
+	if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+#if CACHE_DEPTH > 0
+		atomic_t *waiters = &cache->classes[best].waiters;
+
+		/* Do not wait on objects any CPU is sitting on.  Frees
+		 * check the waiter count after caching their object:
+		 * objects cached before it went up are flushed here,
+		 * later ones by the freeing thread.
+		 */
+		atomic_inc(waiters);
+		class_flush(cache, best);
+		obj = slab_alloc(cache, best, timeout);
+		atomic_dec(waiters);
+#else
+		obj = slab_alloc(cache, best, timeout);
+#endif /* CACHE_DEPTH > 0 */
+	}
+
+	cache_account(cache, best, false, false, obj == NULL);
+
+	return obj;
+}
+
+void k_mem_cache_free(struct k_mem_cache *cache, void *obj)
+{
+	if (obj == NULL) {
+		return;
+	}
+
+	int cls = obj_class(cache, obj);
+
+	__ASSERT(cls != NO_CLASS, "Invalid memory pointer provided");
+
+#if CACHE_DEPTH > 0
+	struct k_mem_cache_class *entry = &cache->classes[cls];
+	void *spill[CACHE_BATCH];
+	int n_spill = 0;
+	struct k_mem_cache_mag *mag = &entry->mags[cache_cpu_id()];
+	k_spinlock_key_t key = k_spin_lock(&mag->lock);
+
+	/* Return the oldest, coldest, half of a full cache */
+	if (mag->count == CACHE_DEPTH) {
+		n_spill = CACHE_BATCH;
+		memcpy(spill, mag->objs, n_spill * sizeof(spill[0]));
+		mag->count -= n_spill;
+		memmove(&mag->objs[0], &mag->objs[n_spill],
+			mag->count * sizeof(mag->objs[0]));
+	}
+	mag->objs[mag->count++] = obj;
+
+	k_spin_unlock(&mag->lock, key);
+
+	slab_free_n(cache, cls, spill, n_spill);
+
+	/* Order the caching before the waiter check, against the
+	 * increment and flush of k_mem_cache_alloc().  A thread that
+	 * flushed before the object got in is handed it by the slab.
+	 */
+	barrier_dmem_fence_full();
+	if (atomic_get(&entry->waiters) != 0) {
+		class_flush(cache, cls);
+	}
+#else
+	slab_free(cache, cls, obj);
+#endif /* CACHE_DEPTH > 0 */
+}
+
+void k_mem_cache_flush(struct k_mem_cache *cache)
+{
+#if CACHE_DEPTH > 0
+	for (int cls = 0; cls < cache->num_classes; cls++) {
+		class_flush(cache, cls);
+	}
+#else
+	ARG_UNUSED(cache);
+#endif /* CACHE_DEPTH > 0 */
+}
+
+static void class_stats_get(struct k_mem_cache_class *entry,
+			    struct sys_memory_stats *stats)
+{
+	size_t cached = 0;
+
+	(void)k_mem_slab_runtime_stats_get(entry->slab, stats);
+
+#if CACHE_DEPTH > 0
+	/* Unlocked peek at the other CPUs: good enough for stats */
+	for (int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		cached += entry->mags[cpu].count;
+	}
+	cached *= entry->slab->info.block_size;
+#endif /* CACHE_DEPTH > 0 */
+
+	stats->free_bytes += cached;
+	stats->allocated_bytes -= cached;
+}
+
+int k_mem_cache_runtime_stats_get(struct k_mem_cache *cache,
+				  struct sys_memory_stats *stats)
+{
+	if ((cache == NULL) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	memset(stats, 0, sizeof(*stats));
+
+	for (int cls = 0; cls < cache->num_classes; cls++) {
+		struct sys_memory_stats class_stats;
+
+		class_stats_get(&cache->classes[cls], &class_stats);
+
+		stats->free_bytes += class_stats.free_bytes;
+		stats->allocated_bytes += class_stats.allocated_bytes;
+		stats->max_allocated_bytes += class_stats.max_allocated_bytes;
+	}
+
+	return 0;
+}
+
+int k_mem_cache_class_runtime_stats_get(struct k_mem_cache *cache, size_t cls,
+					struct sys_memory_stats *stats)
+{
+	if ((cache == NULL) || (stats == NULL) || (cls >= cache->num_classes)) {
+		return -EINVAL;
+	}
+
+	class_stats_get(&cache->classes[cls], stats);
+
+	return 0;
+}
+
+#ifdef CONFIG_OBJ_CORE_STATS_MEM_CACHE
+static int k_mem_cache_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	__ASSERT((obj_core != NULL) && (stats != NULL), "NULL parameter");
+
+	struct k_mem_cache *cache;
+
+	cache = CONTAINER_OF(obj_core, struct k_mem_cache, obj_core);
+
+	info_sum(&cache->info, cache->cpu_info);
+	memcpy(stats, &cache->info, sizeof(cache->info));
+
+	return 0;
+}
+
+static int k_mem_cache_stats_query(struct k_obj_core *obj_core, void *stats)
+{
+	__ASSERT((obj_core != NULL) && (stats != NULL), "NULL parameter");
+
+	struct k_mem_cache *cache;
+
+	cache = CONTAINER_OF(obj_core, struct k_mem_cache, obj_core);
+
+	return k_mem_cache_runtime_stats_get(cache, stats);
+}
+
+static int k_mem_cache_stats_reset(struct k_obj_core *obj_core)
+{
+	__ASSERT(obj_core != NULL, "NULL parameter");
+
+	struct k_mem_cache *cache;
+
+	cache = CONTAINER_OF(obj_core, struct k_mem_cache, obj_core);
+	memset(cache->cpu_info, 0, sizeof(cache->cpu_info));
+	memset(&cache->info, 0, sizeof(cache->info));
+
+	/* Resetting the cache also resets each of its size classes */
+	for (int cls = 0; cls < cache->num_classes; cls++) {
+		memset(cache->classes[cls].cpu_info, 0,
+		       sizeof(cache->classes[cls].cpu_info));
+		memset(&cache->classes[cls].info, 0,
+		       sizeof(cache->classes[cls].info));
+	}
+
+	return 0;
+}
+
+static struct k_obj_core_stats_desc mem_cache_stats_desc = {
+	.raw_size = sizeof(struct k_mem_cache_info),
+	.query_size = sizeof(struct sys_memory_stats),
+	.raw   = k_mem_cache_stats_raw,
+	.query = k_mem_cache_stats_query,
+	.reset = k_mem_cache_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+
+static int k_mem_cache_class_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	__ASSERT((obj_core != NULL) && (stats != NULL), "NULL parameter");
+
+	struct k_mem_cache_class *entry;
+
+	entry = CONTAINER_OF(obj_core, struct k_mem_cache_class, obj_core);
+
+	info_sum(&entry->info, entry->cpu_info);
+	memcpy(stats, &entry->info, sizeof(entry->info));
+
+	return 0;
+}
+
+static int k_mem_cache_class_stats_query(struct k_obj_core *obj_core,
+					 void *stats)
+{
+	__ASSERT((obj_core != NULL) && (stats != NULL), "NULL parameter");
+
+	struct k_mem_cache_class *entry;
+
+	entry = CONTAINER_OF(obj_core, struct k_mem_cache_class, obj_core);
+
+	class_stats_get(entry, stats);
+
+	return 0;
+}
+
+static int k_mem_cache_class_stats_reset(struct k_obj_core *obj_core)
+{
+	__ASSERT(obj_core != NULL, "NULL parameter");
+
+	struct k_mem_cache_class *entry;
+
+	entry = CONTAINER_OF(obj_core, struct k_mem_cache_class, obj_core);
+	memset(entry->cpu_info, 0, sizeof(entry->cpu_info));
+	memset(&entry->info, 0, sizeof(entry->info));
+
+	return 0;
+}
+
+static struct k_obj_core_stats_desc mem_cache_class_stats_desc = {
+	.raw_size = sizeof(struct k_mem_cache_info),
+	.query_size = sizeof(struct sys_memory_stats),
+	.raw   = k_mem_cache_class_stats_raw,
+	.query = k_mem_cache_class_stats_query,
+	.reset = k_mem_cache_class_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+#endif /* CONFIG_OBJ_CORE_STATS_MEM_CACHE */
+
+/**
+ * @brief Complete initialization of statically defined memory caches.
+ *
+ * @return 0 on success, fails otherwise.
+ */
+static int init_mem_cache_obj_core_list(void)
+{
+	int rc = 0;
+
+#ifdef CONFIG_OBJ_CORE_MEM_CACHE
+	z_obj_type_init(&obj_type_mem_cache, K_OBJ_TYPE_MEM_CACHE_ID,
+			offsetof(struct k_mem_cache, obj_core));
+	z_obj_type_init(&obj_type_mem_cache_class, K_OBJ_TYPE_MEM_CACHE_CLASS_ID,
+			offsetof(struct k_mem_cache_class, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_MEM_CACHE
+	k_obj_type_stats_init(&obj_type_mem_cache, &mem_cache_stats_desc);
+	k_obj_type_stats_init(&obj_type_mem_cache_class,
+			      &mem_cache_class_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_MEM_CACHE */
+#endif /* CONFIG_OBJ_CORE_MEM_CACHE */
+
+	STRUCT_SECTION_FOREACH(k_mem_cache, cache) {
+		rc = cache_setup(cache);
+		if (rc < 0) {
+			break;
+		}
+	}
+
+	return rc;
+}
+
+SYS_INIT(init_mem_cache_obj_core_list, PRE_KERNEL_1,
+	 CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
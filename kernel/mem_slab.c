@@ -198,6 +198,7 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 #endif /* CONFIG_OBJ_CORE_STATS_MEM_SLAB */
 
 	z_waitq_init(&slab->wait_q);
+	z_waitq_init(&slab->batch_wait_q);
 	k_object_init(slab);
 out:
 	SYS_PORT_TRACING_OBJ_INIT(k_mem_slab, slab, rc);
@@ -279,7 +280,121 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
 
+	if (IS_ENABLED(CONFIG_MULTITHREADING) &&
+	    (z_unpend_all(&slab->batch_wait_q) != 0)) {
+		z_reschedule(&slab->lock, key);
+	} else {
+		k_spin_unlock(&slab->lock, key);
+	}
+}
+
+/* Take up to @count blocks off the free list, slab lock held */
+static uint32_t slab_take_locked(struct k_mem_slab *slab, void **mem,
+				 uint32_t count)
+{
+	uint32_t n = 0;
+
+	while ((n < count) && (slab->free_list != NULL)) {
+		mem[n++] = slab->free_list;
+		slab->free_list = *(char **)(slab->free_list);
+	}
+
+	slab->info.num_used += n;
+
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	slab->info.max_used = MAX(slab->info.num_used,
+				  slab->info.max_used);
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+
+	return n;
+}
+
+int k_mem_slab_alloc_n(struct k_mem_slab *slab, void **mem, uint32_t count,
+		       k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	bool no_wait = K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
+		       !IS_ENABLED(CONFIG_MULTITHREADING);
+	k_spinlock_key_t key;
+	uint32_t n = 0;
+
+	/* Could never be satisfied, and would wait for ever */
+	if (count > slab->info.num_blocks) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&slab->lock);
+
+	for (;;) {
+		/* A waiting request takes all of its blocks at once: holding
+		 * some while waiting for the others could deadlock with
+		 * another request holding the rest.
+		 */
+		if (no_wait ||
+		    ((slab->info.num_blocks - slab->info.num_used) >= count)) {
+			n = slab_take_locked(slab, mem, count);
+			break;
+		}
+
+		timeout = sys_timepoint_timeout(end);
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			break;
+		}
+
+		/* woken up whenever blocks go back to the free list */
+		(void) z_pend_curr(&slab->lock, key, &slab->batch_wait_q, timeout);
+		key = k_spin_lock(&slab->lock);
+	}
+
 	k_spin_unlock(&slab->lock, key);
+
+	if ((n == 0U) && (count != 0U)) {
+		return no_wait ? -ENOMEM : -EAGAIN;
+	}
+
+	return (int)n;
+}
+
+void k_mem_slab_free_n(struct k_mem_slab *slab, void **mem, uint32_t count)
+{
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	bool need_sched = false;
+	bool freed = false;
+
+	for (uint32_t i = 0; i < count; i++) {
+		__ASSERT(((char *)mem[i] >= slab->buffer) &&
+			 ((((char *)mem[i] - slab->buffer) % slab->info.block_size) == 0) &&
+			 ((char *)mem[i] <= (slab->buffer + (slab->info.block_size *
+							     (slab->info.num_blocks - 1)))),
+			 "Invalid memory pointer provided");
+
+		if (slab->free_list == NULL && IS_ENABLED(CONFIG_MULTITHREADING)) {
+			struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
+
+			if (pending_thread != NULL) {
+				z_thread_return_value_set_with_data(pending_thread, 0, mem[i]);
+				z_ready_thread(pending_thread);
+				need_sched = true;
+				continue;
+			}
+		}
+		*(char **) mem[i] = slab->free_list;
+		slab->free_list = (char *) mem[i];
+		slab->info.num_used--;
+		freed = true;
+	}
+
+	/* Batch requests retry once blocks are left on the free list */
+	if (freed && IS_ENABLED(CONFIG_MULTITHREADING) &&
+	    (z_unpend_all(&slab->batch_wait_q) != 0)) {
+		need_sched = true;
+	}
+
+	if (need_sched) {
+		z_reschedule(&slab->lock, key);
+	} else {
+		k_spin_unlock(&slab->lock, key);
+	}
 }
 
 int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stats *stats)
@@ -190,6 +190,225 @@ void z_page_frames_dump(void)
 SYS_BITARRAY_DEFINE_STATIC(virt_region_bitmap,
 			   CONFIG_KERNEL_VM_SIZE / CONFIG_MMU_PAGE_SIZE);
 
+#ifndef CONFIG_KERNEL_VM_TREE
+static inline int virt_region_bits_set(size_t num_bits, size_t offset)
+{
+	return sys_bitarray_set_region(&virt_region_bitmap, num_bits, offset);
+}
+
+static inline int virt_region_bits_test_and_set(size_t num_bits,
+						size_t offset)
+{
+	return sys_bitarray_test_and_set_region(&virt_region_bitmap, num_bits,
+						offset, true);
+}
+
+static inline int virt_region_bits_free(size_t num_bits, size_t offset)
+{
+	return sys_bitarray_free(&virt_region_bitmap, num_bits, offset);
+}
+
+static inline int virt_region_bits_alloc(size_t num_bits, size_t *offset)
+{
+	return sys_bitarray_alloc(&virt_region_bitmap, num_bits, offset);
+}
+#else
+/* Segment tree indexing the free runs of the bitmap, so that the first
+ * free region large enough is found in a logarithmic number of steps
+ * instead of scanning the bitmap.
+ *
+ * Its leaves summarize the 32-bit bundles of the bitmap. Node #1 covers
+ * the whole bitmap and node #n has nodes #2n and #2n+1 as halves. Each
+ * node holds the number of free pages at the start and at the end of the
+ * part of the bitmap it covers, and the largest number of consecutive free
+ * pages within it. Leaves past the end of the bitmap stay all zeroes, i.e.
+ * fully allocated.
+ */
+#define VR_BUNDLE_BITS	32U
+#define VR_PAGES	(CONFIG_KERNEL_VM_SIZE / CONFIG_MMU_PAGE_SIZE)
+#define VR_LEAVES	NHPOT(DIV_ROUND_UP(VR_PAGES, VR_BUNDLE_BITS))
+
+struct vr_node {
+	uint32_t head;
+	uint32_t tail;
+	uint32_t longest;
+};
+
+static struct vr_node vr_tree[2 * VR_LEAVES];
+
+BUILD_ASSERT(sizeof(virt_region_bitmap.bundles[0]) * 8 == VR_BUNDLE_BITS);
+
+/* Free bits of a bitmap bundle, bits past the end of the bitmap being
+ * considered allocated
+ */
+static inline uint32_t vr_bundle_free(size_t bundle)
+{
+	uint32_t free = ~virt_region_bitmap.bundles[bundle];
+	size_t valid = VR_PAGES - (bundle * VR_BUNDLE_BITS);
+
+	if (valid < VR_BUNDLE_BITS) {
+		free &= BIT_MASK(valid);
+	}
+
+	return free;
+}
+
+static void vr_leaf_update(size_t bundle)
+{
+	struct vr_node *leaf = &vr_tree[VR_LEAVES + bundle];
+	uint32_t free = vr_bundle_free(bundle);
+	uint32_t longest = 0U;
+
+	if (free == UINT32_MAX) {
+		leaf->head = VR_BUNDLE_BITS;
+		leaf->tail = VR_BUNDLE_BITS;
+	} else {
+		leaf->head = u32_count_trailing_zeros(~free);
+		leaf->tail = u32_count_leading_zeros(~free);
+	}
+
+	/* Each step shortens all runs of free bits by one */
+	while (free != 0U) {
+		free &= free << 1;
+		longest++;
+	}
+	leaf->longest = longest;
+}
+
+/* Update @node from its two halves, each covering @span pages */
+static inline void vr_node_update(size_t node, size_t span)
+{
+	struct vr_node *left = &vr_tree[2 * node];
+	struct vr_node *right = &vr_tree[(2 * node) + 1];
+
+	vr_tree[node].head = (left->head == span) ? (span + right->head) :
+			     left->head;
+	vr_tree[node].tail = (right->tail == span) ? (span + left->tail) :
+			     right->tail;
+	vr_tree[node].longest = MAX(MAX(left->longest, right->longest),
+				    left->tail + right->head);
+}
+
+/* Update the tree after the bitmap changed for pages [offset, offset + num) */
+static void vr_tree_update(size_t offset, size_t num)
+{
+	size_t lo = VR_LEAVES + (offset / VR_BUNDLE_BITS);
+	size_t hi = VR_LEAVES + ((offset + num - 1) / VR_BUNDLE_BITS);
+	size_t span = VR_BUNDLE_BITS;
+
+	if (num == 0U) {
+		return;
+	}
+
+	for (size_t node = lo; node <= hi; node++) {
+		vr_leaf_update(node - VR_LEAVES);
+	}
+
+	while (lo > 1) {
+		lo /= 2U;
+		hi /= 2U;
+		for (size_t node = lo; node <= hi; node++) {
+			vr_node_update(node, span);
+		}
+		span *= 2U;
+	}
+}
+
+/* Find the lowest offset of @num consecutive free pages */
+static int vr_tree_find(size_t num, size_t *offset)
+{
+	size_t span = (VR_LEAVES * VR_BUNDLE_BITS) / 2U;
+	size_t node = 1;
+	size_t base = 0;
+	uint32_t free, mask;
+
+	if (vr_tree[1].longest < num) {
+		return -ENOSPC;
+	}
+
+	while (node < VR_LEAVES) {
+		struct vr_node *left = &vr_tree[2 * node];
+		struct vr_node *right = &vr_tree[(2 * node) + 1];
+
+		if (left->longest >= num) {
+			node = 2 * node;
+		} else if ((left->tail + right->head) >= num) {
+			/* Straddles the two halves */
+			*offset = base + span - left->tail;
+			return 0;
+		} else {
+			node = (2 * node) + 1;
+			base += span;
+		}
+		span /= 2U;
+	}
+
+	/* Within a single bundle, so num is at most 32 */
+	free = vr_bundle_free(node - VR_LEAVES);
+	mask = (num == VR_BUNDLE_BITS) ? UINT32_MAX : BIT_MASK(num);
+	for (size_t bit = 0; bit <= (VR_BUNDLE_BITS - num); bit++) {
+		if (((free >> bit) & mask) == mask) {
+			*offset = base + bit;
+			return 0;
+		}
+	}
+
+	__ASSERT(false, "virtual region tree out of sync with bitmap");
+
+	return -ENOSPC;
+}
+
+static inline int virt_region_bits_set(size_t num_bits, size_t offset)
+{
+	int ret = sys_bitarray_set_region(&virt_region_bitmap, num_bits,
+					  offset);
+
+	vr_tree_update(offset, num_bits);
+
+	return ret;
+}
+
+static inline int virt_region_bits_test_and_set(size_t num_bits,
+						size_t offset)
+{
+	int ret = sys_bitarray_test_and_set_region(&virt_region_bitmap,
+						   num_bits, offset, true);
+
+	if (ret == 0) {
+		vr_tree_update(offset, num_bits);
+	}
+
+	return ret;
+}
+
+static inline int virt_region_bits_free(size_t num_bits, size_t offset)
+{
+	int ret = sys_bitarray_free(&virt_region_bitmap, num_bits, offset);
+
+	if (ret == 0) {
+		vr_tree_update(offset, num_bits);
+	}
+
+	return ret;
+}
+
+static int virt_region_bits_alloc(size_t num_bits, size_t *offset)
+{
+	int ret;
+
+	if ((num_bits == 0U) || (num_bits > VR_PAGES)) {
+		return -EINVAL;
+	}
+
+	ret = vr_tree_find(num_bits, offset);
+	if (ret == 0) {
+		ret = virt_region_bits_set(num_bits, *offset);
+	}
+
+	return ret;
+}
+#endif /* CONFIG_KERNEL_VM_TREE */
+
 static bool virt_region_inited;
 
 #define Z_VIRT_REGION_START_ADDR	Z_FREE_VM_START
@@ -216,11 +435,14 @@ static void virt_region_init(void)
 	 * already allocated so they will never be used.
 	 */
 
+#ifdef CONFIG_KERNEL_VM_TREE
+	vr_tree_update(0, VR_PAGES);
+#endif /* CONFIG_KERNEL_VM_TREE */
+
 	if (Z_VM_RESERVED > 0) {
 		/* Mark reserved region at end of virtual address space */
 		num_bits = Z_VM_RESERVED / CONFIG_MMU_PAGE_SIZE;
-		(void)sys_bitarray_set_region(&virt_region_bitmap,
-					      num_bits, 0);
+		(void)virt_region_bits_set(num_bits, 0);
 	}
 
 	/* Mark all bits up to Z_FREE_VM_START as allocated */
@@ -228,8 +450,7 @@ static void virt_region_init(void)
 		   - POINTER_TO_UINT(Z_VIRT_RAM_START);
 	offset = virt_to_bitmap_offset(Z_VIRT_RAM_START, num_bits);
 	num_bits /= CONFIG_MMU_PAGE_SIZE;
-	(void)sys_bitarray_set_region(&virt_region_bitmap,
-				      num_bits, offset);
+	(void)virt_region_bits_set(num_bits, offset);
 
 	virt_region_inited = true;
 }
@@ -259,7 +480,7 @@ static void virt_region_free(void *vaddr, size_t size)
 
 	offset = virt_to_bitmap_offset(vaddr, size);
 	num_bits = size / CONFIG_MMU_PAGE_SIZE;
-	(void)sys_bitarray_free(&virt_region_bitmap, num_bits, offset);
+	(void)virt_region_bits_free(num_bits, offset);
 #else /* !CONFIG_KERNEL_DIRECT_MAP */
 	/* With K_MEM_DIRECT_MAP, the region can be outside of the virtual
 	 * memory space, wholly within it, or overlap partially.
@@ -277,7 +498,7 @@ static void virt_region_free(void *vaddr, size_t size)
 
 		offset = virt_to_bitmap_offset(adjusted_start, adjusted_sz);
 		num_bits = adjusted_sz / CONFIG_MMU_PAGE_SIZE;
-		(void)sys_bitarray_free(&virt_region_bitmap, num_bits, offset);
+		(void)virt_region_bits_free(num_bits, offset);
 	}
 #endif /* !CONFIG_KERNEL_DIRECT_MAP */
 }
@@ -297,7 +518,7 @@ static void *virt_region_alloc(size_t size, size_t align)
 	/* Possibly request more pages to ensure we can get an aligned virtual address */
 	num_bits = (size + align - CONFIG_MMU_PAGE_SIZE) / CONFIG_MMU_PAGE_SIZE;
 	alloc_size = num_bits * CONFIG_MMU_PAGE_SIZE;
-	ret = sys_bitarray_alloc(&virt_region_bitmap, num_bits, &offset);
+	ret = virt_region_bits_alloc(num_bits, &offset);
 	if (ret != 0) {
 		LOG_ERR("insufficient virtual address space (requested %zu)",
 			size);
@@ -357,7 +578,7 @@ static void *virt_region_alloc(size_t size, size_t align)
 
 	/* Need to make sure this does not step into kernel memory */
 	if (dest_addr < POINTER_TO_UINT(Z_VIRT_REGION_START_ADDR)) {
-		(void)sys_bitarray_free(&virt_region_bitmap, size, offset);
+		(void)virt_region_bits_free(num_bits, offset);
 		return NULL;
 	}
 
@@ -392,6 +613,10 @@ static size_t z_free_page_count;
 	__ASSERT(expr, "page frame 0x%lx: " fmt, z_page_frame_to_phys(pf), \
 		 ##__VA_ARGS__)
 
+#ifdef CONFIG_DEMAND_PAGING_CLEANER
+static void page_cleaner_wake(void);
+#endif /* CONFIG_DEMAND_PAGING_CLEANER */
+
 /* Get an unused page frame. don't care which one, or NULL if there are none */
 static struct z_page_frame *free_page_frame_list_get(void)
 {
@@ -406,6 +631,12 @@ static struct z_page_frame *free_page_frame_list_get(void)
 			 "unavailable but somehow on free list");
 	}
 
+#ifdef CONFIG_DEMAND_PAGING_CLEANER
+	if (z_free_page_count < CONFIG_DEMAND_PAGING_CLEANER_LOW_WATERMARK) {
+		page_cleaner_wake();
+	}
+#endif /* CONFIG_DEMAND_PAGING_CLEANER */
+
 	return pf;
 }
 
@@ -804,8 +1035,7 @@ void z_phys_map(uint8_t **virt_ptr, uintptr_t phys, size_t size, uint32_t flags)
 
 			num_bits = adjusted_sz / CONFIG_MMU_PAGE_SIZE;
 			offset = virt_to_bitmap_offset(adjusted_start, adjusted_sz);
-			if (sys_bitarray_test_and_set_region(
-			    &virt_region_bitmap, num_bits, offset, true))
+			if (virt_region_bits_test_and_set(num_bits, offset))
 				goto fail;
 		}
 	} else {
@@ -1389,6 +1619,335 @@ static inline struct z_page_frame *do_eviction_select(bool *dirty)
 	return pf;
 }
 
+static inline void paging_stats_cleaner_miss_inc(void)
+{
+#if defined(CONFIG_DEMAND_PAGING_CLEANER) && defined(CONFIG_DEMAND_PAGING_STATS)
+	paging_stats.cleaner.misses++;
+#endif /* CONFIG_DEMAND_PAGING_CLEANER && CONFIG_DEMAND_PAGING_STATS */
+}
+
+#ifdef CONFIG_DEMAND_PAGING_CLEANER
+/*
+ * The page cleaner thread evicts pages ahead of demand, so that page faults
+ * find free page frames and only have to page in their data page. It is
+ * woken up when the free page frames drop below the low watermark and
+ * evicts pages until they reach the high watermark, writing dirty ones back
+ * to the backing store.
+ *
+ * It takes the same locks as a page fault for each page it evicts, and
+ * releases them in between so that page faults and higher priority threads
+ * are not held off for more than a single page-out.
+ */
+static K_KERNEL_PINNED_STACK_DEFINE(page_cleaner_stack,
+				    CONFIG_DEMAND_PAGING_CLEANER_STACK_SIZE);
+__pinned_bss
+static struct k_thread page_cleaner_thread;
+static K_SEM_DEFINE(page_cleaner_sem, 0, 1);
+static bool page_cleaner_started;
+
+static void page_cleaner_wake(void)
+{
+	if (page_cleaner_started) {
+		k_sem_give(&page_cleaner_sem);
+	}
+}
+
+static inline void paging_stats_cleaner_inc(bool dirty)
+{
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	if (dirty) {
+		paging_stats.cleaner.dirty++;
+	} else {
+		paging_stats.cleaner.clean++;
+	}
+#else
+	ARG_UNUSED(dirty);
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+}
+
+/* Evict a page if below the high watermark. Returns false once there are
+ * enough free page frames, or if the backing store is full.
+ */
+static bool page_cleaner_evict(void)
+{
+	struct z_page_frame *pf;
+	uintptr_t location;
+	bool dirty, ret = false;
+	int key;
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	k_sched_lock();
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	key = irq_lock();
+	if (z_free_page_count >= CONFIG_DEMAND_PAGING_CLEANER_HIGH_WATERMARK) {
+		goto out;
+	}
+
+	pf = do_eviction_select(&dirty);
+	if (pf == NULL) {
+		/* Nothing can be evicted, e.g. all pages are pinned */
+		goto out;
+	}
+	LOG_DBG("cleaning %p at 0x%lx", pf->addr, z_page_frame_to_phys(pf));
+	if (page_frame_prepare_locked(pf, &dirty, false, &location) != 0) {
+		goto out;
+	}
+	paging_stats_eviction_inc(_current_cpu->current, dirty);
+	paging_stats_cleaner_inc(dirty);
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	irq_unlock(key);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	if (dirty) {
+		do_backing_store_page_out(location);
+	}
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	key = irq_lock();
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	page_frame_free_locked(pf);
+	ret = true;
+out:
+	irq_unlock(key);
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	k_sched_unlock();
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+
+	return ret;
+}
+
+static void page_cleaner(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&page_cleaner_sem, K_FOREVER);
+#ifdef CONFIG_DEMAND_PAGING_STATS
+		paging_stats.cleaner.runs++;
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+
+		while (page_cleaner_evict()) {
+			/* Until the high watermark is reached */
+		}
+	}
+}
+
+static int page_cleaner_init(void)
+{
+	k_thread_create(&page_cleaner_thread, page_cleaner_stack,
+			K_KERNEL_STACK_SIZEOF(page_cleaner_stack),
+			page_cleaner, NULL, NULL, NULL,
+			CONFIG_DEMAND_PAGING_CLEANER_PRIORITY, 0, K_NO_WAIT);
+	k_thread_name_set(&page_cleaner_thread, "page_cleaner");
+	page_cleaner_started = true;
+
+	/* Memory may have run low during boot already */
+	if (z_free_page_count < CONFIG_DEMAND_PAGING_CLEANER_LOW_WATERMARK) {
+		k_sem_give(&page_cleaner_sem);
+	}
+
+	return 0;
+}
+
+SYS_INIT(page_cleaner_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_DEMAND_PAGING_CLEANER */
+
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+__weak void k_mem_paging_backing_store_page_in_batch(const uintptr_t *locations,
+						     const uintptr_t *phys,
+						     size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		arch_mem_scratch(phys[i]);
+		do_backing_store_page_in(locations[i]);
+	}
+}
+
+/*
+ * Page in the data pages following @addr, up to @count of them, in a single
+ * batch from the backing store. Stops at the first data page that is not
+ * paged out, or for which no page frame can be obtained without running
+ * out of backing store space.
+ *
+ * Called and returns with interrupts locked, and the scheduler locked if
+ * CONFIG_DEMAND_PAGING_ALLOW_IRQ is enabled, in which case interrupts are
+ * unlocked while dirty victims are written back and the batch is paged in.
+ * Returns the number of data pages paged in.
+ */
+static size_t page_in_batch_locked(uint8_t *addr, size_t count, int *key)
+{
+	struct z_page_frame *pfs[CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES];
+	uintptr_t locations[CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES];
+	uintptr_t phys[CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES];
+	uintptr_t page_out_locations[CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES];
+	bool dirty[CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES];
+	struct k_thread *faulting_thread = _current_cpu->current;
+	size_t n;
+
+	count = MIN(count, CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES);
+	count = MIN(count, (size_t)(Z_VIRT_RAM_END - addr) /
+			   CONFIG_MMU_PAGE_SIZE);
+
+	for (n = 0; n < count; n++) {
+		uint8_t *pos = addr + (n * CONFIG_MMU_PAGE_SIZE);
+		struct z_page_frame *pf;
+
+		if (arch_page_location_get(pos, &locations[n]) !=
+		    ARCH_PAGE_LOCATION_PAGED_OUT) {
+			break;
+		}
+
+		dirty[n] = false;
+		pf = free_page_frame_list_get();
+		if (pf == NULL) {
+			/* Read-ahead is speculative: stop at the first data
+			 * page no page frame can be found for.
+			 */
+			pf = do_eviction_select(&dirty[n]);
+			if ((pf == NULL) ||
+			    (page_frame_prepare_locked(pf, &dirty[n], false,
+						       &page_out_locations[n]) != 0)) {
+				break;
+			}
+			paging_stats_eviction_inc(faulting_thread, dirty[n]);
+
+			/* No longer mapped, so the next selection can't
+			 * return it again
+			 */
+			pf->flags &= ~Z_PAGE_FRAME_MAPPED;
+		}
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+		pf->flags |= Z_PAGE_FRAME_BUSY;
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		pfs[n] = pf;
+		phys[n] = z_page_frame_to_phys(pf);
+	}
+
+	if (n == 0) {
+		return 0;
+	}
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	irq_unlock(*key);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	/* Only the page-ins are batched, Z_SCRATCH_PAGE can map a single
+	 * page frame at a time.
+	 */
+	for (size_t i = 0; i < n; i++) {
+		if (dirty[i]) {
+			arch_mem_scratch(phys[i]);
+			do_backing_store_page_out(page_out_locations[i]);
+		}
+	}
+	k_mem_paging_backing_store_page_in_batch(locations, phys, n);
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	*key = irq_lock();
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+
+	for (size_t i = 0; i < n; i++) {
+		struct z_page_frame *pf = pfs[i];
+
+		pf->flags &= ~Z_PAGE_FRAME_BUSY;
+		pf->flags |= Z_PAGE_FRAME_MAPPED;
+		pf->addr = addr + (i * CONFIG_MMU_PAGE_SIZE);
+
+		arch_mem_page_in(pf->addr, phys[i]);
+		k_mem_paging_backing_store_page_finalize(pf, locations[i]);
+	}
+
+	return n;
+}
+
+/*
+ * A stream is a run of page faults on consecutive data pages, e.g. code
+ * being executed or a table being scanned through. Each fault of a stream
+ * reads ahead a window of the following data pages, and the stream expects
+ * its next fault right after them. If it happens there, the accesses went
+ * through the data pages read ahead without faulting, and the window
+ * doubles for the next fault.
+ */
+struct read_ahead_stream {
+	/* Data page where the next fault of the stream is expected */
+	uintptr_t next;
+
+	/* Number of data pages read ahead by the last fault */
+	uint16_t ahead;
+
+	/* Number of data pages to read ahead on the next fault */
+	uint16_t window;
+};
+
+static struct read_ahead_stream read_ahead_streams[
+	CONFIG_DEMAND_PAGING_READ_AHEAD_STREAMS] = {
+	[0 ... (CONFIG_DEMAND_PAGING_READ_AHEAD_STREAMS - 1)] = {
+		.next = UINTPTR_MAX,
+	},
+};
+static unsigned int read_ahead_replace;
+
+static inline void paging_stats_read_ahead_inc(struct k_thread *faulting_thread,
+					       size_t read_ahead, size_t avoided)
+{
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	paging_stats.pagefaults.read_ahead += read_ahead;
+	paging_stats.pagefaults.avoided += avoided;
+
+#ifdef CONFIG_DEMAND_PAGING_THREAD_STATS
+	faulting_thread->paging_stats.pagefaults.read_ahead += read_ahead;
+	faulting_thread->paging_stats.pagefaults.avoided += avoided;
+#else
+	ARG_UNUSED(faulting_thread);
+#endif /* CONFIG_DEMAND_PAGING_THREAD_STATS */
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+}
+
+/* Read ahead after the data page mapped to @pf was paged in by a fault */
+static void read_ahead_locked(struct z_page_frame *pf, int *key)
+{
+	uintptr_t page = POINTER_TO_UINT(pf->addr);
+	struct read_ahead_stream *stream = NULL;
+	size_t avoided, n;
+
+	for (int i = 0; i < CONFIG_DEMAND_PAGING_READ_AHEAD_STREAMS; i++) {
+		if (read_ahead_streams[i].next == page) {
+			stream = &read_ahead_streams[i];
+			break;
+		}
+	}
+
+	if (stream == NULL) {
+		/* Start tracking a new stream, but only read ahead once it
+		 * has faulted sequentially.
+		 */
+		stream = &read_ahead_streams[read_ahead_replace];
+		read_ahead_replace = (read_ahead_replace + 1) %
+				     CONFIG_DEMAND_PAGING_READ_AHEAD_STREAMS;
+		stream->next = page + CONFIG_MMU_PAGE_SIZE;
+		stream->ahead = 0;
+		stream->window = 0;
+		return;
+	}
+
+	avoided = stream->ahead;
+	stream->window = MIN(MAX(stream->window * 2, 1),
+			     CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES);
+
+	/* The faulting data page hasn't been accessed yet, keep the
+	 * eviction algorithm from selecting it to make room.
+	 */
+	pf->flags |= Z_PAGE_FRAME_BUSY;
+	n = page_in_batch_locked(UINT_TO_POINTER(page + CONFIG_MMU_PAGE_SIZE),
+				 stream->window, key);
+	pf->flags &= ~Z_PAGE_FRAME_BUSY;
+
+	stream->ahead = n;
+	stream->next = page + ((n + 1) * CONFIG_MMU_PAGE_SIZE);
+
+	paging_stats_read_ahead_inc(_current_cpu->current, n, avoided);
+}
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
+
 static bool do_page_fault(void *addr, bool pin)
 {
 	struct z_page_frame *pf;
@@ -1479,6 +2038,7 @@ static bool do_page_fault(void *addr, bool pin)
 			z_page_frame_to_phys(pf));
 
 		paging_stats_eviction_inc(faulting_thread, dirty);
+		paging_stats_cleaner_miss_inc();
 	}
 	ret = page_frame_prepare_locked(pf, &dirty, true, &page_out_location);
 	__ASSERT(ret == 0, "failed to prepare page frame");
@@ -1508,6 +2068,11 @@ static bool do_page_fault(void *addr, bool pin)
 
 	arch_mem_page_in(addr, z_page_frame_to_phys(pf));
 	k_mem_paging_backing_store_page_finalize(pf, page_in_location);
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	if (!pin) {
+		read_ahead_locked(pf, &key);
+	}
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
 out:
 	irq_unlock(key);
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
@@ -1526,11 +2091,49 @@ static void do_page_in(void *addr)
 	(void)ret;
 }
 
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+/* Page in the paged out runs of a region in batches. Data pages that could
+ * not be paged in this way are left to the page-by-page pass.
+ */
+static void page_in_batches(void *addr, size_t size)
+{
+	size_t pages = size / CONFIG_MMU_PAGE_SIZE;
+	size_t done = 0;
+	int key;
+
+	z_mem_assert_virtual_region(addr, size);
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	k_sched_lock();
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	key = irq_lock();
+	while (done < pages) {
+		size_t count = MIN(pages - done,
+				   CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES);
+		size_t n;
+
+		n = page_in_batch_locked((uint8_t *)addr +
+					 (done * CONFIG_MMU_PAGE_SIZE),
+					 count, &key);
+
+		/* Skip the data page the batch stopped at, if any */
+		done += (n < count) ? (n + 1) : n;
+	}
+	irq_unlock(key);
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	k_sched_unlock();
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+}
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
+
 void k_mem_page_in(void *addr, size_t size)
 {
 	__ASSERT(!IS_ENABLED(CONFIG_DEMAND_PAGING_ALLOW_IRQ) || !k_is_in_isr(),
 		 "%s may not be called in ISRs if CONFIG_DEMAND_PAGING_ALLOW_IRQ is enabled",
 		 __func__);
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	page_in_batches(addr, size);
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
 	virt_region_foreach(addr, size, do_page_in);
 }
 
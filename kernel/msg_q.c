@@ -121,6 +121,48 @@ int k_msgq_cleanup(struct k_msgq *msgq)
 }
 
 
+/* Copy @a count messages into the ring buffer, in at most two segments */
+static void msgq_ring_write(struct k_msgq *msgq, const char *data,
+			    uint32_t count)
+{
+	size_t len = (size_t)count * msgq->msg_size;
+	size_t seg = MIN(len, (size_t)(msgq->buffer_end - msgq->write_ptr));
+
+	__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
+			msgq->write_ptr < msgq->buffer_end);
+
+	(void)memcpy(msgq->write_ptr, data, seg);
+	if (len > seg) {
+		(void)memcpy(msgq->buffer_start, data + seg, len - seg);
+		msgq->write_ptr = msgq->buffer_start + (len - seg);
+	} else {
+		msgq->write_ptr += seg;
+		if (msgq->write_ptr == msgq->buffer_end) {
+			msgq->write_ptr = msgq->buffer_start;
+		}
+	}
+	msgq->used_msgs += count;
+}
+
+/* Copy @a count messages out of the ring buffer, in at most two segments */
+static void msgq_ring_read(struct k_msgq *msgq, char *data, uint32_t count)
+{
+	size_t len = (size_t)count * msgq->msg_size;
+	size_t seg = MIN(len, (size_t)(msgq->buffer_end - msgq->read_ptr));
+
+	(void)memcpy(data, msgq->read_ptr, seg);
+	if (len > seg) {
+		(void)memcpy(data + seg, msgq->buffer_start, len - seg);
+		msgq->read_ptr = msgq->buffer_start + (len - seg);
+	} else {
+		msgq->read_ptr += seg;
+		if (msgq->read_ptr == msgq->buffer_end) {
+			msgq->read_ptr = msgq->buffer_start;
+		}
+	}
+	msgq->used_msgs -= count;
+}
+
 int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout)
 {
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
@@ -195,6 +237,97 @@ static inline int z_vrfy_k_msgq_put(struct k_msgq *msgq, const void *data,
 #include <syscalls/k_msgq_put_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+int z_impl_k_msgq_put_n(struct k_msgq *msgq, const void *data,
+			uint32_t num_msgs, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	const char *src = data;
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+	uint32_t sent = 0U;
+	uint32_t count;
+	bool woken = false;
+	int result;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put_n, msgq, timeout);
+
+	if (num_msgs == 0U) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_n, msgq, timeout, 0);
+		return 0;
+	}
+
+	key = k_spin_lock(&msgq->lock);
+
+	/* Receivers only wait on an empty queue: give them their message */
+	while ((sent < num_msgs) && (msgq->used_msgs == 0U)) {
+		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (pending_thread == NULL) {
+			break;
+		}
+
+		(void)memcpy(pending_thread->base.swap_data, src,
+			     msgq->msg_size);
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		src += msgq->msg_size;
+		sent++;
+		woken = true;
+	}
+
+	/* Queue the rest, as far as there is room */
+	count = MIN(num_msgs - sent, msgq->max_msgs - msgq->used_msgs);
+	if (count > 0U) {
+		msgq_ring_write(msgq, src, count);
+		sent += count;
+#ifdef CONFIG_POLL
+		handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+#endif /* CONFIG_POLL */
+	}
+
+	if (sent > 0U) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_n, msgq, timeout, (int)sent);
+
+		if (woken) {
+			z_reschedule(&msgq->lock, key);
+		} else {
+			k_spin_unlock(&msgq->lock, key);
+		}
+		return (int)sent;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		/* don't wait for message space to become available */
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_n, msgq, timeout, -ENOMSG);
+		k_spin_unlock(&msgq->lock, key);
+		return -ENOMSG;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, put_n, msgq, timeout);
+
+	/* wait for the first message to be taken, failure, or timeout */
+	_current->base.swap_data = (void *) data;
+
+	result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+	result = (result == 0) ? 1 : result;
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_n, msgq, timeout, result);
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_put_n(struct k_msgq *msgq, const void *data,
+				      uint32_t num_msgs, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_READ(data, num_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_put_n(msgq, data, num_msgs, timeout);
+}
+#include <syscalls/k_msgq_put_n_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 void z_impl_k_msgq_get_attrs(struct k_msgq *msgq, struct k_msgq_attrs *attrs)
 {
 	attrs->msg_size = msgq->msg_size;
@@ -293,6 +426,93 @@ static inline int z_vrfy_k_msgq_get(struct k_msgq *msgq, void *data,
 #include <syscalls/k_msgq_get_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+int z_impl_k_msgq_get_n(struct k_msgq *msgq, void *data, uint32_t num_msgs,
+			k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	char *dst = data;
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+	uint32_t received = 0U;
+	uint32_t count;
+	bool woken = false;
+	int result;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get_n, msgq, timeout);
+
+	if (num_msgs == 0U) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get_n, msgq, timeout, 0);
+		return 0;
+	}
+
+	key = k_spin_lock(&msgq->lock);
+
+	while ((received < num_msgs) && (msgq->used_msgs > 0U)) {
+		count = MIN(num_msgs - received, msgq->used_msgs);
+		msgq_ring_read(msgq, dst, count);
+		dst += (size_t)count * msgq->msg_size;
+		received += count;
+
+		/* Senders only wait on a full queue: refill the room just
+		 * freed with their messages, which the next pass may take.
+		 */
+		while (msgq->used_msgs < msgq->max_msgs) {
+			pending_thread = z_unpend_first_thread(&msgq->wait_q);
+			if (pending_thread == NULL) {
+				break;
+			}
+
+			msgq_ring_write(msgq, pending_thread->base.swap_data, 1);
+			arch_thread_return_value_set(pending_thread, 0);
+			z_ready_thread(pending_thread);
+			woken = true;
+		}
+	}
+
+	if (received > 0U) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get_n, msgq, timeout, (int)received);
+
+		if (woken) {
+			z_reschedule(&msgq->lock, key);
+		} else {
+			k_spin_unlock(&msgq->lock, key);
+		}
+		return (int)received;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		/* don't wait for a message to become available */
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get_n, msgq, timeout, -ENOMSG);
+		k_spin_unlock(&msgq->lock, key);
+		return -ENOMSG;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get_n, msgq, timeout);
+
+	/* wait for the next message sent, or timeout */
+	_current->base.swap_data = data;
+
+	result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+	result = (result == 0) ? 1 : result;
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get_n, msgq, timeout, result);
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_get_n(struct k_msgq *msgq, void *data,
+				      uint32_t num_msgs, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(data, num_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_get_n(msgq, data, num_msgs, timeout);
+}
+#include <syscalls/k_msgq_get_n_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 int z_impl_k_msgq_peek(struct k_msgq *msgq, void *data)
 {
 	k_spinlock_key_t key;
@@ -102,6 +102,68 @@ static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 	return false;
 }
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+/*
+ * Lockless peeks at the scheduler and mutex state while spinning: these
+ * are only hints, the caller checks them again under the lock.
+ */
+static bool owner_running_elsewhere(struct k_thread *owner, uint8_t cpu_id)
+{
+	uint8_t cpu;
+
+	if (owner == NULL) {
+		return false;
+	}
+
+	cpu = *(volatile uint8_t *)&owner->base.cpu;
+
+	return (cpu != cpu_id) &&
+	       (*(struct k_thread *volatile *)&_kernel.cpus[cpu].current == owner);
+}
+
+/*
+ * Wait for the owner of a mutex running on another CPU to release it,
+ * for at most CONFIG_MUTEX_SPIN_CYCLES cycles. Called and returns with
+ * the lock held, the caller then takes the mutex if it is free.
+ *
+ * Only spin while no thread waits for the mutex: it is handed over to
+ * the first waiter on unlock, so spinning cannot overtake a pended
+ * thread of higher priority, and would not get the mutex anyway. Stop
+ * as soon as the owner is switched out or a thread pends.
+ */
+static k_spinlock_key_t mutex_spin(struct k_mutex *mutex, k_spinlock_key_t key)
+{
+	uint32_t start = k_cycle_get_32();
+	struct k_thread *owner = mutex->owner;
+	/* Read while the lock is held, _current_cpu cannot be used once it
+	 * is released. Should this thread migrate while spinning, the id
+	 * goes stale, which only makes the hint below less accurate.
+	 */
+	uint8_t cpu_id = _current_cpu->id;
+
+	while ((mutex->lock_count != 0U) &&
+	       (z_waitq_head(&mutex->wait_q) == NULL) &&
+	       owner_running_elsewhere(owner, cpu_id)) {
+		k_spin_unlock(&lock, key);
+
+		do {
+			if ((k_cycle_get_32() - start) >= CONFIG_MUTEX_SPIN_CYCLES) {
+				return k_spin_lock(&lock);
+			}
+			arch_spin_relax();
+		} while ((*(volatile uint32_t *)&mutex->lock_count != 0U) &&
+			 (*(struct k_thread *volatile *)&mutex->owner == owner) &&
+			 z_waitq_is_empty(&mutex->wait_q) &&
+			 owner_running_elsewhere(owner, cpu_id));
+
+		key = k_spin_lock(&lock);
+		owner = mutex->owner;
+	}
+
+	return key;
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 {
 	int new_prio;
@@ -114,6 +176,25 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	key = k_spin_lock(&lock);
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	if ((mutex->lock_count != 0U) && (mutex->owner != _current) &&
+	    !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		k_timepoint_t end = sys_timepoint_calc(timeout);
+
+		key = mutex_spin(mutex, key);
+
+		/* The time spent spinning counts towards the timeout */
+		timeout = sys_timepoint_timeout(end);
+		if ((mutex->lock_count != 0U) && K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&lock, key);
+
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, -EAGAIN);
+
+			return -EAGAIN;
+		}
+	}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
 
 		mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
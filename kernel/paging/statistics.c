@@ -88,6 +88,18 @@ unsigned long z_num_pagefaults_get(void)
 	return ret;
 }
 
+void z_paging_stats_eviction_scan(unsigned long scanned,
+				  unsigned long referenced)
+{
+	paging_stats.eviction.scanned += scanned;
+	paging_stats.eviction.referenced += referenced;
+
+#ifdef CONFIG_DEMAND_PAGING_THREAD_STATS
+	_current->paging_stats.eviction.scanned += scanned;
+	_current->paging_stats.eviction.referenced += referenced;
+#endif /* CONFIG_DEMAND_PAGING_THREAD_STATS */
+}
+
 void z_impl_k_mem_paging_stats_get(struct k_mem_paging_stats_t *stats)
 {
 	if (stats == NULL) {
@@ -43,9 +43,13 @@ void k_pipe_init(struct k_pipe *pipe, unsigned char *buffer, size_t size)
 	pipe->bytes_used = 0U;
 	pipe->read_index = 0U;
 	pipe->write_index = 0U;
+	pipe->put_claimed = 0U;
+	pipe->get_claimed = 0U;
 	pipe->lock = (struct k_spinlock){};
 	z_waitq_init(&pipe->wait_q.writers);
 	z_waitq_init(&pipe->wait_q.readers);
+	z_waitq_init(&pipe->wait_q.claim_writers);
+	z_waitq_init(&pipe->wait_q.claim_readers);
 	SYS_PORT_TRACING_OBJ_INIT(k_pipe, pipe);
 
 	pipe->flags = 0;
@@ -163,7 +167,10 @@ int k_pipe_cleanup(struct k_pipe *pipe)
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 
 	CHECKIF(z_waitq_head(&pipe->wait_q.readers) != NULL ||
-			z_waitq_head(&pipe->wait_q.writers) != NULL) {
+			z_waitq_head(&pipe->wait_q.writers) != NULL ||
+			z_waitq_head(&pipe->wait_q.claim_readers) != NULL ||
+			z_waitq_head(&pipe->wait_q.claim_writers) != NULL ||
+			pipe->put_claimed != 0U || pipe->get_claimed != 0U) {
 		k_spin_unlock(&pipe->lock, key);
 
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, cleanup, pipe, -EAGAIN);
@@ -377,6 +384,121 @@ static size_t pipe_write(struct k_pipe *pipe, sys_dlist_t *src_list,
 	return num_bytes_written;
 }
 
+/**
+ * @brief Wake threads waiting to claim data or space in the pipe buffer
+ */
+static void pipe_claim_wake(struct k_pipe *pipe, bool *reschedule)
+{
+	if ((pipe->bytes_used != 0U) &&
+	    (z_waitq_head(&pipe->wait_q.claim_readers) != NULL) &&
+	    z_sched_wake_all(&pipe->wait_q.claim_readers, 0, NULL)) {
+		*reschedule = true;
+	}
+
+	if ((pipe->bytes_used != pipe->size) &&
+	    (z_waitq_head(&pipe->wait_q.claim_writers) != NULL) &&
+	    z_sched_wake_all(&pipe->wait_q.claim_writers, 0, NULL)) {
+		*reschedule = true;
+	}
+}
+
+/**
+ * @brief Refill the pipe buffer from the waiting writer(s)
+ *
+ * @return Number of bytes copied to the pipe buffer
+ */
+static size_t pipe_buffer_refill(struct k_pipe *pipe, bool *reschedule)
+{
+	struct _pipe_desc   pipe_desc[2];
+	struct _pipe_desc  *desc;
+	struct k_thread    *thread;
+	sys_dlist_t         src_list;
+	sys_dlist_t         pipe_list;
+	size_t              bytes_copied;
+
+	if ((pipe->bytes_used == pipe->size) || (pipe->put_claimed != 0U)) {
+		return 0U;
+	}
+
+	sys_dlist_init(&src_list);
+	sys_dlist_init(&pipe_list);
+
+	(void) pipe_waiter_list_populate(&src_list,
+					 &pipe->wait_q.writers,
+					 pipe->size - pipe->bytes_used);
+
+	(void) pipe_buffer_list_populate(&pipe_list, pipe_desc,
+					 pipe->buffer, pipe->size,
+					 pipe->write_index,
+					 pipe->read_index);
+
+	bytes_copied = pipe_write(pipe, &src_list, &pipe_list, reschedule);
+
+	/* Wake the writers whose data now sits entirely in the buffer. */
+
+	while ((thread = z_waitq_head(&pipe->wait_q.writers)) != NULL) {
+		desc = (struct _pipe_desc *)thread->base.swap_data;
+		if (desc->bytes_to_xfer != 0U) {
+			break;
+		}
+
+		z_unpend_thread(thread);
+		z_ready_thread(thread);
+
+		*reschedule = true;
+	}
+
+	return bytes_copied;
+}
+
+/**
+ * @brief Copy data from the pipe buffer to the waiting reader(s)
+ *
+ * Readers only wait while the buffer is empty, or while they are kept off
+ * the buffer by a read claim. This serves them once data shows up.
+ */
+static void pipe_buffer_drain(struct k_pipe *pipe, bool *reschedule)
+{
+	struct k_thread    *thread;
+	struct _pipe_desc  *desc;
+	size_t              bytes_copied;
+	size_t              end;
+
+	while ((pipe->bytes_used != 0U) && (pipe->get_claimed == 0U)) {
+		thread = z_waitq_head(&pipe->wait_q.readers);
+		if (thread == NULL) {
+			break;
+		}
+
+		desc = (struct _pipe_desc *)thread->base.swap_data;
+		end = (pipe->read_index < pipe->write_index) ?
+		      pipe->write_index : pipe->size;
+
+		bytes_copied = pipe_xfer(desc->buffer, desc->bytes_to_xfer,
+					 &pipe->buffer[pipe->read_index],
+					 end - pipe->read_index);
+
+		desc->buffer        += bytes_copied;
+		desc->bytes_to_xfer -= bytes_copied;
+
+		pipe->bytes_used -= bytes_copied;
+		pipe->read_index += bytes_copied;
+		if (pipe->read_index >= pipe->size) {
+			pipe->read_index -= pipe->size;
+		}
+
+		if (desc->bytes_to_xfer == 0U) {
+
+			/* The thread's read request has been satisfied. */
+
+			z_unpend_thread(thread);
+			z_ready_thread(thread);
+
+			*reschedule = true;
+		}
+	}
+}
+
 int z_impl_k_pipe_put(struct k_pipe *pipe, const void *data,
 		      size_t bytes_to_write, size_t *bytes_written,
 		      size_t min_xfer, k_timeout_t timeout)
@@ -386,7 +508,7 @@ int z_impl_k_pipe_put(struct k_pipe *pipe, const void *data,
 	struct _pipe_desc *src_desc;
 	sys_dlist_t        dest_list;
 	sys_dlist_t        src_list;
-	size_t             bytes_can_write;
+	size_t             bytes_can_write = 0U;
 	bool               reschedule_needed = false;
 
 	__ASSERT(((arch_is_in_isr() == false) ||
@@ -409,13 +531,18 @@ int z_impl_k_pipe_put(struct k_pipe *pipe, const void *data,
 	/*
 	 * First, write to any waiting readers, if any exist.
 	 * Second, write to the pipe buffer, if it exists.
+	 *
+	 * Readers are skipped while a read claim holds older data in the
+	 * buffer, and nothing is written while a write claim is outstanding.
 	 */
 
-	bytes_can_write = pipe_waiter_list_populate(&dest_list,
-						    &pipe->wait_q.readers,
-						    bytes_to_write);
+	if ((pipe->get_claimed == 0U) && (pipe->put_claimed == 0U)) {
+		bytes_can_write = pipe_waiter_list_populate(&dest_list,
+							    &pipe->wait_q.readers,
+							    bytes_to_write);
+	}
 
-	if (pipe->bytes_used != pipe->size) {
+	if ((pipe->bytes_used != pipe->size) && (pipe->put_claimed == 0U)) {
 		bytes_can_write += pipe_buffer_list_populate(&dest_list,
 							     pipe_desc,
 							     pipe->buffer,
@@ -460,6 +587,7 @@ int z_impl_k_pipe_put(struct k_pipe *pipe, const void *data,
 
 	if ((pipe->bytes_used != 0U) && (*bytes_written != 0U)) {
 		handle_poll_events(pipe);
+		pipe_claim_wake(pipe, &reschedule_needed);
 	}
 
 	/*
@@ -552,7 +680,9 @@ static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
 
 	sys_dlist_init(&src_list);
 
-	if (pipe->bytes_used != 0) {
+	/* Nothing can be read while a read claim is outstanding. */
+
+	if ((pipe->bytes_used != 0) && (pipe->get_claimed == 0U)) {
 		bytes_can_read = pipe_buffer_list_populate(&src_list,
 							   pipe_desc,
 							   pipe->buffer,
@@ -561,9 +691,11 @@ static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
 							   pipe->write_index);
 	}
 
-	bytes_can_read += pipe_waiter_list_populate(&src_list,
-						    &pipe->wait_q.writers,
-						    bytes_to_read);
+	if (pipe->get_claimed == 0U) {
+		bytes_can_read += pipe_waiter_list_populate(&src_list,
+							    &pipe->wait_q.writers,
+							    bytes_to_read);
+	}
 
 	if ((bytes_can_read < min_xfer) &&
 	    (K_TIMEOUT_EQ(timeout, K_NO_WAIT))) {
@@ -625,29 +757,14 @@ static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
 		src_desc = (struct _pipe_desc *)sys_dlist_get(&src_list);
 	}
 
-	if (pipe->bytes_used != pipe->size) {
-		sys_dlist_t         pipe_list;
-
-		/*
-		 * The pipe is not full. If there are any waiting writers,
-		 * refill the pipe.
-		 */
-
-		sys_dlist_init(&src_list);
-		sys_dlist_init(&pipe_list);
-
-		(void) pipe_waiter_list_populate(&src_list,
-						 &pipe->wait_q.writers,
-						 pipe->size - pipe->bytes_used);
+	/*
+	 * If the pipe is not full and there are any waiting writers,
+	 * refill the pipe.
+	 */
 
-		(void) pipe_buffer_list_populate(&pipe_list, pipe_desc,
-						 pipe->buffer, pipe->size,
-						 pipe->write_index,
-						 pipe->read_index);
+	(void) pipe_buffer_refill(pipe, &reschedule_needed);
 
-		(void) pipe_write(pipe, &src_list,
-				  &pipe_list, &reschedule_needed);
-	}
+	pipe_claim_wake(pipe, &reschedule_needed);
 
 	/*
 	 * The immediate success conditions below are backwards
@@ -810,6 +927,249 @@ size_t z_vrfy_k_pipe_write_avail(struct k_pipe *pipe)
 #include <syscalls/k_pipe_write_avail_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+int k_pipe_put_claim(struct k_pipe *pipe, void **data, size_t size,
+		     k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_timeout_t   wait;
+	size_t        claim;
+	int           ret;
+
+	__ASSERT(((arch_is_in_isr() == false) ||
+		  K_TIMEOUT_EQ(timeout, K_NO_WAIT)), "");
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, put_claim, pipe, timeout);
+
+	CHECKIF((data == NULL) || (size == 0U)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, put_claim, pipe, timeout,
+					       -EINVAL);
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	while (true) {
+		if ((pipe->buffer == NULL) || (pipe->size == 0U)) {
+			ret = -ENOTSUP;
+			break;
+		}
+
+		if (pipe->put_claimed != 0U) {
+			ret = -EBUSY;
+			break;
+		}
+
+		if (pipe->bytes_used != pipe->size) {
+			claim = (pipe->write_index < pipe->read_index) ?
+				pipe->read_index - pipe->write_index :
+				pipe->size - pipe->write_index;
+			claim = MIN(MIN(claim, size), (size_t)INT_MAX);
+
+			pipe->put_claimed = claim;
+			*data = &pipe->buffer[pipe->write_index];
+			ret = (int)claim;
+			break;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			ret = -EIO;
+			break;
+		}
+
+		wait = sys_timepoint_timeout(end);
+		if (K_TIMEOUT_EQ(wait, K_NO_WAIT)) {
+			ret = -EAGAIN;
+			break;
+		}
+
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_pipe, put_claim, pipe, wait);
+
+		(void) z_pend_curr(&pipe->lock, key,
+				   &pipe->wait_q.claim_writers, wait);
+		key = k_spin_lock(&pipe->lock);
+	}
+
+	k_spin_unlock(&pipe->lock, key);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, put_claim, pipe, timeout, ret);
+
+	return ret;
+}
+
+int k_pipe_put_finish(struct k_pipe *pipe, size_t size)
+{
+	bool reschedule_needed = false;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, put_finish, pipe);
+
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	CHECKIF((pipe->put_claimed == 0U) || (size > pipe->put_claimed)) {
+		k_spin_unlock(&pipe->lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, put_finish, pipe, -EINVAL);
+
+		return -EINVAL;
+	}
+
+	pipe->put_claimed = 0U;
+	pipe->bytes_used += size;
+	pipe->write_index += size;
+	if (pipe->write_index >= pipe->size) {
+		pipe->write_index -= pipe->size;
+	}
+
+	/*
+	 * Hand the new data to any waiting readers, then let writers that
+	 * were kept off the buffer by the claim refill it.
+	 */
+
+	pipe_buffer_drain(pipe, &reschedule_needed);
+	if (pipe_buffer_refill(pipe, &reschedule_needed) != 0U) {
+		pipe_buffer_drain(pipe, &reschedule_needed);
+	}
+
+	if ((pipe->bytes_used != 0U) && (size != 0U)) {
+		handle_poll_events(pipe);
+	}
+
+	pipe_claim_wake(pipe, &reschedule_needed);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, put_finish, pipe, 0);
+
+	if (reschedule_needed) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	return 0;
+}
+
+int k_pipe_get_claim(struct k_pipe *pipe, void **data, size_t size,
+		     k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_timeout_t   wait;
+	size_t        claim;
+	bool          reschedule_needed = false;
+	int           ret;
+
+	__ASSERT(((arch_is_in_isr() == false) ||
+		  K_TIMEOUT_EQ(timeout, K_NO_WAIT)), "");
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, get_claim, pipe, timeout);
+
+	CHECKIF((data == NULL) || (size == 0U)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, get_claim, pipe, timeout,
+					       -EINVAL);
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	while (true) {
+		if ((pipe->buffer == NULL) || (pipe->size == 0U)) {
+			ret = -ENOTSUP;
+			break;
+		}
+
+		if (pipe->get_claimed != 0U) {
+			ret = -EBUSY;
+			break;
+		}
+
+		/* Data held by waiting writers is moved into the buffer. */
+
+		(void) pipe_buffer_refill(pipe, &reschedule_needed);
+
+		if (pipe->bytes_used != 0U) {
+			claim = (pipe->read_index < pipe->write_index) ?
+				pipe->write_index - pipe->read_index :
+				pipe->size - pipe->read_index;
+			claim = MIN(MIN(claim, size), (size_t)INT_MAX);
+
+			pipe->get_claimed = claim;
+			*data = &pipe->buffer[pipe->read_index];
+			ret = (int)claim;
+			break;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			ret = -EIO;
+			break;
+		}
+
+		wait = sys_timepoint_timeout(end);
+		if (K_TIMEOUT_EQ(wait, K_NO_WAIT)) {
+			ret = -EAGAIN;
+			break;
+		}
+
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_pipe, get_claim, pipe, wait);
+
+		(void) z_pend_curr(&pipe->lock, key,
+				   &pipe->wait_q.claim_readers, wait);
+		key = k_spin_lock(&pipe->lock);
+	}
+
+	if (reschedule_needed) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, get_claim, pipe, timeout, ret);
+
+	return ret;
+}
+
+int k_pipe_get_finish(struct k_pipe *pipe, size_t size)
+{
+	bool reschedule_needed = false;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, get_finish, pipe);
+
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	CHECKIF((pipe->get_claimed == 0U) || (size > pipe->get_claimed)) {
+		k_spin_unlock(&pipe->lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, get_finish, pipe, -EINVAL);
+
+		return -EINVAL;
+	}
+
+	pipe->get_claimed = 0U;
+	pipe->bytes_used -= size;
+	pipe->read_index += size;
+	if (pipe->read_index >= pipe->size) {
+		pipe->read_index -= pipe->size;
+	}
+
+	/*
+	 * Serve readers that were kept off the buffer by the claim, then
+	 * refill the freed space from any waiting writers.
+	 */
+
+	pipe_buffer_drain(pipe, &reschedule_needed);
+	if (pipe_buffer_refill(pipe, &reschedule_needed) != 0U) {
+		pipe_buffer_drain(pipe, &reschedule_needed);
+	}
+
+	pipe_claim_wake(pipe, &reschedule_needed);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, get_finish, pipe, 0);
+
+	if (reschedule_needed) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	return 0;
+}
+
 #ifdef CONFIG_OBJ_CORE_PIPE
 static int init_pipe_obj_core_list(void)
 {
@@ -35,10 +35,11 @@
  */
 static struct k_spinlock lock;
 
-enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED };
+enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED, MODE_SET };
 
 static int signal_poller(struct k_poll_event *event, uint32_t state);
 static int signal_triggered_work(struct k_poll_event *event, uint32_t status);
+static int signal_poll_set(struct k_poll_event *event, uint32_t state);
 
 void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 		       int mode, void *obj)
@@ -70,6 +71,12 @@ static inline bool is_condition_met(struct k_poll_event *event, uint32_t *state)
 		}
 		break;
 	case K_POLL_TYPE_DATA_AVAILABLE:
+#ifdef CONFIG_QUEUE_LOCKFREE
+		/* Must precede the check: later appends then take the
+		 * locked path and signal the event.
+		 */
+		z_queue_poll_register(event->queue);
+#endif /* CONFIG_QUEUE_LOCKFREE */
 		if (!k_queue_is_empty(event->queue)) {
 			*state = K_POLL_STATE_FIFO_DATA_AVAILABLE;
 			return true;
@@ -114,17 +121,25 @@ static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 {
 	struct k_poll_event *pending;
 
+	/* Poll sets have no thread: they are queued behind all pollers. */
+	if (poller->mode == MODE_SET) {
+		sys_dlist_append(events, &event->_node);
+		return;
+	}
+
 	pending = (struct k_poll_event *)sys_dlist_peek_tail(events);
 	if ((pending == NULL) ||
-		(z_sched_prio_cmp(poller_thread(pending->poller),
-							   poller_thread(poller)) > 0)) {
+		((pending->poller->mode != MODE_SET) &&
+		 (z_sched_prio_cmp(poller_thread(pending->poller),
+							   poller_thread(poller)) > 0))) {
 		sys_dlist_append(events, &event->_node);
 		return;
 	}
 
 	SYS_DLIST_FOR_EACH_CONTAINER(events, pending, _node) {
-		if (z_sched_prio_cmp(poller_thread(poller),
-					poller_thread(pending->poller)) > 0) {
+		if ((pending->poller->mode == MODE_SET) ||
+		    (z_sched_prio_cmp(poller_thread(poller),
+					poller_thread(pending->poller)) > 0)) {
 			sys_dlist_insert(&pending->_node, &event->_node);
 			return;
 		}
@@ -443,6 +458,11 @@ static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 	struct z_poller *poller = event->poller;
 	int retcode = 0;
 
+	if ((poller != NULL) && (poller->mode == MODE_SET)) {
+		/* Stays registered: no need to mark the event ready here */
+		return signal_poll_set(event, state);
+	}
+
 	if (poller != NULL) {
 		if (poller->mode == MODE_POLL) {
 			retcode = signal_poller(event, state);
@@ -567,6 +587,314 @@ static inline void z_vrfy_k_poll_signal_reset(struct k_poll_signal *sig)
 
 #endif /* CONFIG_USERSPACE */
 
+/* must be called with interrupts locked */
+static int signal_poll_set(struct k_poll_event *event, uint32_t state)
+{
+	struct k_poll_set *set = CONTAINER_OF(event->poller, struct k_poll_set,
+					      poller);
+	struct k_poll_set_entry *entry = CONTAINER_OF(event,
+						      struct k_poll_set_entry,
+						      event);
+
+	/* The object dropped the registration to signal it: renew it. */
+	register_event(event, &set->poller);
+
+	event->state |= state;
+	if (!sys_dnode_is_linked(&entry->ready_node)) {
+		sys_dlist_append(&set->ready, &entry->ready_node);
+	}
+
+	(void)z_sched_wake(&set->wait_q, 0, NULL);
+
+	return 0;
+}
+
+static bool poll_set_type_is_valid(uint32_t type)
+{
+	switch (type) {
+	case K_POLL_TYPE_SIGNAL:
+	case K_POLL_TYPE_SEM_AVAILABLE:
+	case K_POLL_TYPE_DATA_AVAILABLE:
+	case K_POLL_TYPE_MSGQ_DATA_AVAILABLE:
+#ifdef CONFIG_PIPES
+	case K_POLL_TYPE_PIPE_DATA_AVAILABLE:
+#endif /* CONFIG_PIPES */
+		return true;
+	default:
+		return false;
+	}
+}
+
+void k_poll_set_init(struct k_poll_set *set, struct k_poll_set_entry *entries,
+		     int max_events)
+{
+	__ASSERT(entries != NULL, "NULL entries\n");
+	__ASSERT(max_events > 0, "no entries\n");
+
+	set->poller.is_polling = false;
+	set->poller.mode = MODE_SET;
+	z_waitq_init(&set->wait_q);
+	sys_dlist_init(&set->ready);
+	(void)memset(entries, 0, max_events * sizeof(*entries));
+	set->entries = entries;
+	set->num_entries = max_events;
+
+	k_object_init(set);
+}
+
+int z_impl_k_poll_set_add(struct k_poll_set *set, uint32_t type, void *obj,
+			  uint32_t tag, uint32_t flags)
+{
+	struct k_poll_set_entry *entry = NULL;
+	bool woken = false;
+	uint32_t state;
+
+	if (!poll_set_type_is_valid(type) || (obj == NULL) ||
+	    ((flags & ~K_POLL_SET_EDGE) != 0U)) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	/* Statically defined sets get their mode on first use */
+	set->poller.mode = MODE_SET;
+
+	for (int i = 0; i < set->num_entries; i++) {
+		struct k_poll_set_entry *e = &set->entries[i];
+
+		if (e->event.obj == NULL) {
+			if (entry == NULL) {
+				entry = e;
+			}
+		} else if ((e->event.obj == obj) && (e->event.type == type)) {
+			k_spin_unlock(&lock, key);
+
+			return -EEXIST;
+		}
+	}
+
+	if (entry == NULL) {
+		k_spin_unlock(&lock, key);
+
+		return -ENOMEM;
+	}
+
+	k_poll_event_init(&entry->event, type, K_POLL_MODE_NOTIFY_ONLY, obj);
+	entry->event.tag = tag;
+	entry->flags = flags;
+
+	if (is_condition_met(&entry->event, &state)) {
+		entry->event.state = state;
+		sys_dlist_append(&set->ready, &entry->ready_node);
+		woken = z_sched_wake(&set->wait_q, 0, NULL);
+	}
+
+	register_event(&entry->event, &set->poller);
+
+	if (woken) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_poll_set_add(struct k_poll_set *set, uint32_t type,
+					void *obj, uint32_t tag, uint32_t flags)
+{
+	K_OOPS(K_SYSCALL_OBJ(set, K_OBJ_POLL_SET));
+
+	switch (type) {
+	case K_POLL_TYPE_SIGNAL:
+		K_OOPS(K_SYSCALL_OBJ(obj, K_OBJ_POLL_SIGNAL));
+		break;
+	case K_POLL_TYPE_SEM_AVAILABLE:
+		K_OOPS(K_SYSCALL_OBJ(obj, K_OBJ_SEM));
+		break;
+	case K_POLL_TYPE_DATA_AVAILABLE:
+		K_OOPS(K_SYSCALL_OBJ(obj, K_OBJ_QUEUE));
+		break;
+	case K_POLL_TYPE_MSGQ_DATA_AVAILABLE:
+		K_OOPS(K_SYSCALL_OBJ(obj, K_OBJ_MSGQ));
+		break;
+#ifdef CONFIG_PIPES
+	case K_POLL_TYPE_PIPE_DATA_AVAILABLE:
+		K_OOPS(K_SYSCALL_OBJ(obj, K_OBJ_PIPE));
+		break;
+#endif /* CONFIG_PIPES */
+	default:
+		return -EINVAL;
+	}
+
+	return z_impl_k_poll_set_add(set, type, obj, tag, flags);
+}
+#include <syscalls/k_poll_set_add_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_poll_set_remove(struct k_poll_set *set, uint32_t type, void *obj)
+{
+	int ret = -ENOENT;
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	for (int i = 0; i < set->num_entries; i++) {
+		struct k_poll_set_entry *entry = &set->entries[i];
+
+		if ((obj == NULL) || (entry->event.obj != obj) ||
+		    (entry->event.type != type)) {
+			continue;
+		}
+
+		clear_event_registration(&entry->event);
+		if (sys_dnode_is_linked(&entry->ready_node)) {
+			sys_dlist_remove(&entry->ready_node);
+		}
+
+		entry->event.type = K_POLL_TYPE_IGNORE;
+		entry->event.state = K_POLL_STATE_NOT_READY;
+		entry->event.obj = NULL;
+		ret = 0;
+		break;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_poll_set_remove(struct k_poll_set *set,
+					   uint32_t type, void *obj)
+{
+	K_OOPS(K_SYSCALL_OBJ(set, K_OBJ_POLL_SET));
+
+	return z_impl_k_poll_set_remove(set, type, obj);
+}
+#include <syscalls/k_poll_set_remove_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+/* must be called with interrupts locked */
+static int poll_set_collect(struct k_poll_set *set,
+			    struct k_poll_event *events, int num_events)
+{
+	struct k_poll_set_entry *entry;
+	sys_dnode_t *requeued = NULL;
+	sys_dnode_t *node;
+	uint32_t state;
+	bool requeue;
+	int count = 0;
+
+	/*
+	 * Only the ready list is visited. Level triggered events that are
+	 * still ready go back to its tail, so stop when the first of them
+	 * comes around again.
+	 */
+	while (count < num_events) {
+		node = sys_dlist_peek_head(&set->ready);
+		if ((node == NULL) || (node == requeued)) {
+			break;
+		}
+
+		sys_dlist_remove(node);
+		entry = CONTAINER_OF(node, struct k_poll_set_entry, ready_node);
+		requeue = false;
+
+		if ((entry->flags & K_POLL_SET_EDGE) != 0U) {
+			state = entry->event.state;
+		} else if (is_condition_met(&entry->event, &state)) {
+			state |= entry->event.state & K_POLL_STATE_CANCELLED;
+			requeue = true;
+		} else {
+			state = entry->event.state & K_POLL_STATE_CANCELLED;
+		}
+
+		entry->event.state = K_POLL_STATE_NOT_READY;
+
+		if (state == K_POLL_STATE_NOT_READY) {
+			continue;
+		}
+
+		events[count] = (struct k_poll_event) {
+			.tag = entry->event.tag,
+			.type = entry->event.type,
+			.state = state,
+			.mode = K_POLL_MODE_NOTIFY_ONLY,
+			.obj = entry->event.obj,
+		};
+		count++;
+
+		if (requeue) {
+			sys_dlist_append(&set->ready, node);
+			if (requeued == NULL) {
+				requeued = node;
+			}
+		}
+	}
+
+	return count;
+}
+
+int z_impl_k_poll_set_wait(struct k_poll_set *set,
+			   struct k_poll_event *events, int num_events,
+			   k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_timeout_t wait;
+	int ret;
+
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	if ((events == NULL) || (num_events <= 0)) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	while (true) {
+		ret = poll_set_collect(set, events, num_events);
+		if (ret > 0) {
+			break;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			ret = -EAGAIN;
+			break;
+		}
+
+		wait = sys_timepoint_timeout(end);
+		if (K_TIMEOUT_EQ(wait, K_NO_WAIT)) {
+			ret = -EAGAIN;
+			break;
+		}
+
+		(void)z_pend_curr(&lock, key, &set->wait_q, wait);
+		key = k_spin_lock(&lock);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_poll_set_wait(struct k_poll_set *set,
+					 struct k_poll_event *events,
+					 int num_events, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(set, K_OBJ_POLL_SET));
+	if (num_events <= 0) {
+		return -EINVAL;
+	}
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(events, num_events,
+					    sizeof(struct k_poll_event)));
+
+	return z_impl_k_poll_set_wait(set, events, num_events, timeout);
+}
+#include <syscalls/k_poll_set_wait_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 static void triggered_work_handler(struct k_work *work)
 {
 	struct k_work_poll *twork =
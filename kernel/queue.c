@@ -63,6 +63,9 @@ void z_impl_k_queue_init(struct k_queue *queue)
 #if defined(CONFIG_POLL)
 	sys_dlist_init(&queue->poll_events);
 #endif
+#ifdef CONFIG_QUEUE_LOCKFREE
+	atomic_set(&queue->lf_head, 0);
+#endif /* CONFIG_QUEUE_LOCKFREE */
 
 	SYS_PORT_TRACING_OBJ_INIT(k_queue, queue);
 
@@ -94,6 +97,98 @@ static inline void handle_poll_events(struct k_queue *queue, uint32_t state)
 #endif /* CONFIG_POLL */
 }
 
+#ifdef CONFIG_QUEUE_LOCKFREE
+/* Push an item on the lock-free append list, unless a waiter or poller
+ * requires the locked path.
+ */
+static bool lockfree_append(struct k_queue *queue, void *data)
+{
+	sys_sfnode_t *node = data;
+	atomic_val_t old;
+
+	do {
+		old = atomic_get(&queue->lf_head);
+		if ((old & (atomic_val_t)Z_QUEUE_LF_FLAGS) != 0) {
+			return false;
+		}
+		node->next_and_flags = (unative_t)old;
+	} while (!atomic_cas(&queue->lf_head, old, (atomic_val_t)node));
+
+	return true;
+}
+
+/* Move the lock-free append list to the tail of data_q, restoring
+ * arrival order. Must be called with the queue lock held.
+ */
+static void lockfree_drain(struct k_queue *queue)
+{
+	atomic_val_t old;
+	sys_sfnode_t *node, *next, *head = NULL, *tail;
+
+	do {
+		old = atomic_get(&queue->lf_head);
+		if ((old & ~(atomic_val_t)Z_QUEUE_LF_FLAGS) == 0) {
+			return;
+		}
+	} while (!atomic_cas(&queue->lf_head, old,
+			     old & (atomic_val_t)Z_QUEUE_LF_FLAGS));
+
+	node = (sys_sfnode_t *)(old & ~(atomic_val_t)Z_QUEUE_LF_FLAGS);
+	tail = node;
+	while (node != NULL) {
+		next = (sys_sfnode_t *)node->next_and_flags;
+		node->next_and_flags = (unative_t)head;
+		head = node;
+		node = next;
+	}
+
+	sys_sflist_append_list(&queue->data_q, head, tail);
+}
+
+/* Take the lock just to drain, for the operations that inspect data_q
+ * without holding it.
+ */
+static void lockfree_sync(struct k_queue *queue)
+{
+	if ((atomic_get(&queue->lf_head) & ~(atomic_val_t)Z_QUEUE_LF_FLAGS) != 0) {
+		k_spinlock_key_t key = k_spin_lock(&queue->lock);
+
+		lockfree_drain(queue);
+		k_spin_unlock(&queue->lock, key);
+	}
+}
+
+/* Re-open the fast path once nobody waits on the queue any more. Must be
+ * called with the queue lock held.
+ */
+static void lockfree_waiters_update(struct k_queue *queue)
+{
+	if (z_waitq_head(&queue->wait_q) == NULL) {
+		(void)atomic_and(&queue->lf_head, ~(atomic_val_t)Z_QUEUE_LF_WAITERS);
+	}
+}
+
+void z_queue_poll_register(struct k_queue *queue)
+{
+	(void)atomic_or(&queue->lf_head, (atomic_val_t)Z_QUEUE_LF_POLLED);
+}
+#else
+static inline void lockfree_drain(struct k_queue *queue)
+{
+	ARG_UNUSED(queue);
+}
+
+static inline void lockfree_sync(struct k_queue *queue)
+{
+	ARG_UNUSED(queue);
+}
+
+static inline void lockfree_waiters_update(struct k_queue *queue)
+{
+	ARG_UNUSED(queue);
+}
+#endif /* CONFIG_QUEUE_LOCKFREE */
+
 void z_impl_k_queue_cancel_wait(struct k_queue *queue)
 {
 	SYS_PORT_TRACING_OBJ_FUNC(k_queue, cancel_wait, queue);
@@ -124,10 +219,21 @@ static int32_t queue_insert(struct k_queue *queue, void *prev, void *data,
 			    bool alloc, bool is_append)
 {
 	struct k_thread *first_pending_thread;
-	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+	k_spinlock_key_t key;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, queue_insert, queue, alloc);
 
+#ifdef CONFIG_QUEUE_LOCKFREE
+	if (is_append && !alloc && lockfree_append(queue, data)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, queue_insert, queue, alloc, 0);
+
+		return 0;
+	}
+#endif /* CONFIG_QUEUE_LOCKFREE */
+
+	key = k_spin_lock(&queue->lock);
+	lockfree_drain(queue);
+
 	if (is_append) {
 		prev = sys_sflist_peek_tail(&queue->data_q);
 	}
@@ -137,6 +243,7 @@ static int32_t queue_insert(struct k_queue *queue, void *prev, void *data,
 		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_queue, queue_insert, queue, alloc, K_FOREVER);
 
 		prepare_thread_to_run(first_pending_thread, data);
+		lockfree_waiters_update(queue);
 		z_reschedule(&queue->lock, key);
 
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, queue_insert, queue, alloc, 0);
@@ -167,6 +274,7 @@ static int32_t queue_insert(struct k_queue *queue, void *prev, void *data,
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_queue, queue_insert, queue, alloc, K_FOREVER);
 
 	sys_sflist_insert(&queue->data_q, prev, data);
+	lockfree_waiters_update(queue);
 	handle_poll_events(queue, K_POLL_STATE_DATA_AVAILABLE);
 	z_reschedule(&queue->lock, key);
 
@@ -258,6 +366,8 @@ int k_queue_append_list(struct k_queue *queue, void *head, void *tail)
 	k_spinlock_key_t key = k_spin_lock(&queue->lock);
 	struct k_thread *thread = NULL;
 
+	lockfree_drain(queue);
+
 	if (head != NULL) {
 		thread = z_unpend_first_thread(&queue->wait_q);
 	}
@@ -271,6 +381,7 @@ int k_queue_append_list(struct k_queue *queue, void *head, void *tail)
 	if (head != NULL) {
 		sys_sflist_append_list(&queue->data_q, head, tail);
 	}
+	lockfree_waiters_update(queue);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, append_list, queue, 0);
 
@@ -321,6 +432,8 @@ void *z_impl_k_queue_get(struct k_queue *queue, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, get, queue, timeout);
 
+	lockfree_drain(queue);
+
 	if (likely(!sys_sflist_is_empty(&queue->data_q))) {
 		sys_sfnode_t *node;
 
@@ -343,6 +456,23 @@ void *z_impl_k_queue_get(struct k_queue *queue, k_timeout_t timeout)
 		return NULL;
 	}
 
+#ifdef CONFIG_QUEUE_LOCKFREE
+	/* Close the fast path before pending, and catch any item that was
+	 * appended since the drain above.
+	 */
+	if ((atomic_or(&queue->lf_head, (atomic_val_t)Z_QUEUE_LF_WAITERS) &
+	     ~(atomic_val_t)Z_QUEUE_LF_FLAGS) != 0) {
+		lockfree_drain(queue);
+		data = z_queue_node_peek(sys_sflist_get_not_empty(&queue->data_q),
+					 true);
+		k_spin_unlock(&queue->lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get, queue, timeout, data);
+
+		return data;
+	}
+#endif /* CONFIG_QUEUE_LOCKFREE */
+
 	int ret = z_pend_curr(&queue->lock, key, &queue->wait_q, timeout);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get, queue, timeout,
@@ -355,6 +485,8 @@ bool k_queue_remove(struct k_queue *queue, void *data)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, remove, queue);
 
+	lockfree_sync(queue);
+
 	bool ret = sys_sflist_find_and_remove(&queue->data_q, (sys_sfnode_t *)data);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, remove, queue, ret);
@@ -368,6 +500,8 @@ bool k_queue_unique_append(struct k_queue *queue, void *data)
 
 	sys_sfnode_t *test;
 
+	lockfree_sync(queue);
+
 	SYS_SFLIST_FOR_EACH_NODE(&queue->data_q, test) {
 		if (test == (sys_sfnode_t *) data) {
 			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, unique_append, queue, false);
@@ -385,6 +519,8 @@ bool k_queue_unique_append(struct k_queue *queue, void *data)
 
 void *z_impl_k_queue_peek_head(struct k_queue *queue)
 {
+	lockfree_sync(queue);
+
 	void *ret = z_queue_node_peek(sys_sflist_peek_head(&queue->data_q), false);
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_queue, peek_head, queue, ret);
@@ -394,6 +530,8 @@ void *z_impl_k_queue_peek_head(struct k_queue *queue)
 
 void *z_impl_k_queue_peek_tail(struct k_queue *queue)
 {
+	lockfree_sync(queue);
+
 	void *ret = z_queue_node_peek(sys_sflist_peek_tail(&queue->data_q), false);
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_queue, peek_tail, queue, ret);
@@ -119,6 +119,65 @@ static ALWAYS_INLINE void z_priq_dumb_add(sys_dlist_t *pq,
 }
 #endif /* CONFIG_SCHED_DUMB || CONFIG_WAITQ_DUMB */
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+#ifdef CONFIG_CPU_DOMAINS
+/* Least loaded CPU of the domain the thread may run on, or @fallback
+ * if its mask allows none of them.
+ */
+static int runq_domain_cpu(struct k_thread *thread, int domain, int fallback)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	int cpu = fallback;
+	uint32_t least = UINT32_MAX;
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		if (z_cpu_domains[i] != domain) {
+			continue;
+		}
+#ifdef CONFIG_SCHED_CPU_MASK
+		if ((thread->base.cpu_mask & BIT(i)) == 0) {
+			continue;
+		}
+#endif /* CONFIG_SCHED_CPU_MASK */
+		if (_kernel.cpus[i].ready_q.nr_queued < least) {
+			least = _kernel.cpus[i].ready_q.nr_queued;
+			cpu = i;
+		}
+	}
+
+	return cpu;
+}
+#endif /* CONFIG_CPU_DOMAINS */
+
+/* Pick the CPU whose run queue a thread is added to: the CPU it last
+ * ran on if its mask still allows it, which keeps the thread on a
+ * warm cache, otherwise the first allowed CPU.  A thread with a domain
+ * hint that last ran outside its domain goes to the least loaded CPU
+ * of the domain instead.
+ */
+static ALWAYS_INLINE int runq_cpu_pick(struct k_thread *thread)
+{
+	int cpu = thread->base.cpu;
+
+#ifdef CONFIG_SCHED_CPU_MASK
+	int m = thread->base.cpu_mask & BIT_MASK(arch_num_cpus());
+
+	if ((m != 0) && ((m & BIT(cpu)) == 0)) {
+		cpu = u32_count_trailing_zeros(m);
+	}
+#endif /* CONFIG_SCHED_CPU_MASK */
+
+#ifdef CONFIG_CPU_DOMAINS
+	if ((thread->base.domain >= 0) &&
+	    (z_cpu_domains[cpu] != thread->base.domain)) {
+		cpu = runq_domain_cpu(thread, thread->base.domain, cpu);
+	}
+#endif /* CONFIG_CPU_DOMAINS */
+
+	return cpu;
+}
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+
 static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 {
 #ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
@@ -133,6 +192,8 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 	cpu = m == 0 ? 0 : u32_count_trailing_zeros(m);
 
 	return &_kernel.cpus[cpu].ready_q.runq;
+#elif defined(CONFIG_SCHED_PER_CPU_RUNQ)
+	return &_kernel.cpus[thread->base.runq_cpu].ready_q.runq;
 #else
 	ARG_UNUSED(thread);
 	return &_kernel.ready_q.runq;
@@ -141,27 +202,150 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 
 static ALWAYS_INLINE void *curr_cpu_runq(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#ifdef CONFIG_SCHED_CPU_READY_Q
 	return &arch_curr_cpu()->ready_q.runq;
 #else
 	return &_kernel.ready_q.runq;
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_CPU_READY_Q */
 }
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+BUILD_ASSERT(CONFIG_MP_MAX_NUM_CPUS <= 32,
+	     "runq_busy holds one bit per CPU");
+
+/* Head of a run queue regardless of CPU masks */
+#ifdef CONFIG_SCHED_DUMB
+#define runq_head(pq)	z_priq_dumb_best(pq)
+#else
+#define runq_head(pq)	_priq_run_best(pq)
+#endif /* CONFIG_SCHED_DUMB */
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+
 static ALWAYS_INLINE void runq_add(struct k_thread *thread)
 {
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	int cpu = runq_cpu_pick(thread);
+	struct _ready_q *rq = &_kernel.cpus[cpu].ready_q;
+
+	thread->base.runq_cpu = cpu;
+	rq->nr_queued++;
+	rq->top_prio = MIN(rq->top_prio, thread->base.prio);
+	_kernel.runq_busy |= BIT(cpu);
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 	_priq_run_add(thread_runq(thread), thread);
 }
 
 static ALWAYS_INLINE void runq_remove(struct k_thread *thread)
 {
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	int cpu = thread->base.runq_cpu;
+	struct _ready_q *rq = &_kernel.cpus[cpu].ready_q;
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+
 	_priq_run_remove(thread_runq(thread), thread);
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	rq->nr_queued--;
+	if (rq->nr_queued == 0U) {
+		rq->top_prio = INT_MAX;
+		_kernel.runq_busy &= ~BIT(cpu);
+	} else if (thread->base.prio == rq->top_prio) {
+		rq->top_prio = runq_head(&rq->runq)->base.prio;
+	}
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+/* Whether an equal priority thread is better stolen from the queue of
+ * CPU @a over the one of CPU @b: a peer in the stealing CPU's own cache
+ * domain first, then the busier one.
+ */
+static ALWAYS_INLINE bool runq_steal_prefer(unsigned int a, unsigned int b)
+{
+#ifdef CONFIG_CPU_DOMAINS
+	uint8_t local = z_cpu_domains[_current_cpu->id];
+	bool a_local = (z_cpu_domains[a] == local);
+	bool b_local = (z_cpu_domains[b] == local);
+
+	if (a_local != b_local) {
+		return a_local;
+	}
+#endif /* CONFIG_CPU_DOMAINS */
+
+	return _kernel.cpus[a].ready_q.nr_queued >
+	       _kernel.cpus[b].ready_q.nr_queued;
+}
+
+/* Whether the queue of a peer can be skipped without looking into it:
+ * its best thread ranks below @best, or only ties with it while @best
+ * comes from the local queue, which wins ties.  Deadlines break ties
+ * between equal priorities, so those have to be compared in full.
+ */
+static ALWAYS_INLINE bool runq_steal_skip(struct _ready_q *rq,
+					  struct k_thread *best, bool local)
+{
+	if (best == NULL) {
+		return false;
+	}
+
+	if (rq->top_prio > best->base.prio) {
+		return true;
+	}
+
+	return (rq->top_prio == best->base.prio) && local &&
+	       !IS_ENABLED(CONFIG_SCHED_DEADLINE);
+}
+
+/* Best thread this CPU could run: the head of its own queue unless a
+ * peer queue holds a thread that outranks it.  On a tie the local
+ * queue wins, and if the local queue has nothing to offer the thread
+ * is taken from the peer runq_steal_prefer() ranks first.  Thread
+ * masks are honoured by _priq_run_best(), which only returns threads
+ * allowed on _current_cpu.
+ *
+ * Only non-empty peer queues whose top priority could beat the local
+ * candidate are looked into, so a CPU with runnable work of its own
+ * normally reads no more than the busy mask and a priority per peer.
+ */
+static ALWAYS_INLINE struct k_thread *runq_best(void)
+{
+	unsigned int own = _current_cpu->id;
+	unsigned int from = own;
+	struct k_thread *best = _priq_run_best(&_kernel.cpus[own].ready_q.runq);
+	uint32_t peers = _kernel.runq_busy & ~BIT(own);
+
+	while (peers != 0U) {
+		unsigned int i = u32_count_trailing_zeros(peers);
+		struct _ready_q *rq = &_kernel.cpus[i].ready_q;
+		struct k_thread *thread;
+		int32_t cmp;
+
+		peers &= peers - 1U;
+
+		if (runq_steal_skip(rq, best, from == own)) {
+			continue;
+		}
+
+		thread = _priq_run_best(&rq->runq);
+		if (thread == NULL) {
+			continue;
+		}
+
+		cmp = (best == NULL) ? 1 : z_sched_prio_cmp(thread, best);
+		if ((cmp > 0) ||
+		    ((cmp == 0) && (from != own) && runq_steal_prefer(i, from))) {
+			best = thread;
+			from = i;
+		}
+	}
+
+	return best;
+}
+#else
 static ALWAYS_INLINE struct k_thread *runq_best(void)
 {
 	return _priq_run_best(curr_cpu_runq());
 }
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 
 /* _current is never in the run queue until context switch on
  * SMP configurations, see z_requeue_current()
@@ -413,7 +597,8 @@ static void ready_thread(struct k_thread *thread)
 
 		queue_thread(thread);
 		update_cache(0);
-		flag_ipi();
+
+		flag_ipi(ipi_mask_create(thread));
 	}
 }
 
@@ -487,9 +672,11 @@ static void z_thread_halt(struct k_thread *thread, k_spinlock_key_t key,
 		/* We might spin to wait, so a true synchronous IPI is needed
 		 * here, not deferred!
 		 */
-#ifdef CONFIG_SCHED_IPI_SUPPORTED
+#if defined(CONFIG_ARCH_HAS_DIRECTED_IPIS)
+		arch_sched_directed_ipi(IPI_CPU_MASK(thread->base.cpu));
+#elif defined(CONFIG_SCHED_IPI_SUPPORTED)
 		arch_sched_ipi();
-#endif /* CONFIG_SCHED_IPI_SUPPORTED */
+#endif /* CONFIG_ARCH_HAS_DIRECTED_IPIS */
 	}
 
 	if (is_halting(thread) && (thread != _current)) {
@@ -776,6 +963,18 @@ bool z_thread_prio_set(struct k_thread *thread, int prio)
 				thread->base.prio = prio;
 			}
 			update_cache(1);
+
+#ifdef CONFIG_SMP
+			/* If the thread runs elsewhere its CPU may now have
+			 * to switch away from it, otherwise it may now
+			 * preempt another CPU.
+			 */
+			if (thread_active_elsewhere(thread)) {
+				flag_ipi(IPI_CPU_MASK(thread->base.cpu));
+			} else {
+				flag_ipi(ipi_mask_create(thread));
+			}
+#endif /* CONFIG_SMP */
 		} else {
 			thread->base.prio = prio;
 		}
@@ -1006,23 +1205,26 @@ void init_ready_q(struct _ready_q *ready_q)
 		}
 	};
 #elif defined(CONFIG_SCHED_MULTIQ)
-	for (int i = 0; i < ARRAY_SIZE(_kernel.ready_q.runq.queues); i++) {
+	for (int i = 0; i < ARRAY_SIZE(ready_q->runq.queues); i++) {
 		sys_dlist_init(&ready_q->runq.queues[i]);
 	}
 #else
 	sys_dlist_init(&ready_q->runq);
 #endif
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	ready_q->top_prio = INT_MAX;
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 void z_sched_init(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#ifdef CONFIG_SCHED_CPU_READY_Q
 	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
 		init_ready_q(&_kernel.cpus[i].ready_q);
 	}
 #else
 	init_ready_q(&_kernel.ready_q);
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_CPU_READY_Q */
 }
 
 void z_impl_k_thread_priority_set(k_tid_t thread, int prio)
@@ -1036,7 +1238,6 @@ void z_impl_k_thread_priority_set(k_tid_t thread, int prio)
 
 	bool need_sched = z_thread_prio_set((struct k_thread *)thread, prio);
 
-	flag_ipi();
 	if (need_sched && _current->base.sched_locked == 0U) {
 		z_reschedule_unlocked();
 	}
@@ -1354,6 +1555,9 @@ static void halt_thread(struct k_thread *thread, uint8_t new_state)
 		SYS_PORT_TRACING_FUNC(k_thread, sched_abort, thread);
 
 		z_thread_monitor_exit(thread);
+#ifdef CONFIG_DYNAMIC_THREAD
+		z_thread_stack_pool_detach(thread);
+#endif /* CONFIG_DYNAMIC_THREAD */
 #ifdef CONFIG_THREAD_ABORT_HOOK
 		thread_abort_hook(thread);
 #endif /* CONFIG_THREAD_ABORT_HOOK */
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/fatal_types.h>
+/* private kernel APIs */
+#include <kernel_arch_interface.h>
+
+BUILD_ASSERT(CONFIG_MCS_SPINLOCK_NODES <= ATOMIC_BITS,
+	     "Too many MCS spinlock nodes for the allocation mask");
+
+/* Queue nodes of a CPU. A node is in use from the moment the CPU starts
+ * acquiring a lock until it releases it. Locks are not always released
+ * in the reverse order of their acquisition (z_swap() releases the
+ * caller's lock while holding the scheduler lock), so nodes are
+ * allocated from a mask rather than used as a stack.
+ *
+ * Only the owning CPU spins on its nodes: keep each CPU's nodes on their
+ * own cache lines.
+ */
+struct mcs_cpu {
+	atomic_t used;
+	struct z_spinlock_mcs_node nodes[CONFIG_MCS_SPINLOCK_NODES];
+} __aligned(64);
+
+static struct mcs_cpu mcs_cpus[CONFIG_MP_MAX_NUM_CPUS];
+
+/* Called with interrupts locked */
+static struct z_spinlock_mcs_node *mcs_node_alloc(void)
+{
+	uint16_t cpu = _current_cpu->id;
+	struct mcs_cpu *mcs = &mcs_cpus[cpu];
+	struct z_spinlock_mcs_node *node;
+	uint16_t i;
+
+	for (i = 0; i < CONFIG_MCS_SPINLOCK_NODES; i++) {
+		if (!atomic_test_and_set_bit(&mcs->used, i)) {
+			break;
+		}
+	}
+
+	__ASSERT(i < CONFIG_MCS_SPINLOCK_NODES,
+		 "CPU %u holds more than %d spinlocks", cpu,
+		 CONFIG_MCS_SPINLOCK_NODES);
+
+	/* Out of nodes even without assertions. Halt right away: the
+	 * fatal error path takes spinlocks of its own.
+	 */
+	if (unlikely(i == CONFIG_MCS_SPINLOCK_NODES)) {
+		arch_system_halt(K_ERR_KERNEL_PANIC);
+	}
+
+	node = &mcs->nodes[i];
+	node->cpu = cpu;
+	node->idx = i;
+	(void)atomic_ptr_clear(&node->next);
+	atomic_set(&node->wait, 1);
+
+	return node;
+}
+
+static void mcs_node_free(struct z_spinlock_mcs_node *node)
+{
+	atomic_clear_bit(&mcs_cpus[node->cpu].used, node->idx);
+}
+
+void z_spin_lock_mcs(struct k_spinlock *l)
+{
+	struct z_spinlock_mcs_node *node = mcs_node_alloc();
+	struct z_spinlock_mcs_node *prev;
+
+	prev = atomic_ptr_set(&l->tail, node);
+	if (prev != NULL) {
+		/* Queue behind the previous waiter and wait for it to
+		 * hand the lock over
+		 */
+		(void)atomic_ptr_set(&prev->next, node);
+		while (atomic_get(&node->wait) != 0) {
+			arch_spin_relax();
+		}
+	}
+
+	l->holder = node;
+}
+
+bool z_spin_trylock_mcs(struct k_spinlock *l)
+{
+	struct z_spinlock_mcs_node *node = mcs_node_alloc();
+
+	if (!atomic_ptr_cas(&l->tail, NULL, node)) {
+		mcs_node_free(node);
+		return false;
+	}
+
+	l->holder = node;
+
+	return true;
+}
+
+void z_spin_unlock_mcs(struct k_spinlock *l)
+{
+	struct z_spinlock_mcs_node *node = l->holder;
+	struct z_spinlock_mcs_node *next = atomic_ptr_get(&node->next);
+
+	if (next == NULL) {
+		/* No known waiter: leave the lock free, unless a CPU has
+		 * just queued up and is about to link itself behind us.
+		 */
+		if (atomic_ptr_cas(&l->tail, node, NULL)) {
+			mcs_node_free(node);
+			return;
+		}
+
+		do {
+			arch_spin_relax();
+			next = atomic_ptr_get(&node->next);
+		} while (next == NULL);
+	}
+
+	atomic_clear(&next->wait);
+	mcs_node_free(node);
+}
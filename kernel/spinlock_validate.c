@@ -32,6 +32,33 @@ void z_spin_lock_set_owner(struct k_spinlock *l)
 	l->thread_cpu = _current_cpu->id | (uintptr_t)_current;
 }
 
+bool z_rwspin_lock_valid(struct k_rwspinlock *l)
+{
+	uintptr_t thread_cpu = l->thread_cpu;
+
+	/* Either lock mode would deadlock against our own write lock */
+	if (thread_cpu != 0U) {
+		if ((thread_cpu & 3U) == _current_cpu->id) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool z_rwspin_write_unlock_valid(struct k_rwspinlock *l)
+{
+	if (l->thread_cpu != (_current_cpu->id | (uintptr_t)_current)) {
+		return false;
+	}
+	l->thread_cpu = 0;
+	return true;
+}
+
+void z_rwspin_write_set_owner(struct k_rwspinlock *l)
+{
+	l->thread_cpu = _current_cpu->id | (uintptr_t)_current;
+}
+
 #ifdef CONFIG_KERNEL_COHERENCE
 bool z_spin_lock_mem_coherent(struct k_spinlock *l)
 {
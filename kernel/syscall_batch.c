@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/syscall_batch.h>
+#include <zephyr/internal/syscall_handler.h>
+#include <zephyr/sys/speculation.h>
+#include <string.h>
+
+int z_impl_k_syscall_batch_submit(struct k_syscall_batch_entry *entries,
+				  uint32_t num_entries)
+{
+	ARG_UNUSED(entries);
+	ARG_UNUSED(num_entries);
+
+	/* The entries are run through the verification handlers, which
+	 * only make sense for user mode callers.
+	 */
+	return -ENOTSUP;
+}
+
+static inline int z_vrfy_k_syscall_batch_submit(struct k_syscall_batch_entry *entries,
+						uint32_t num_entries)
+{
+	void *ssf = _current->syscall_frame;
+
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(entries, num_entries,
+					    sizeof(*entries)));
+
+	for (uint32_t i = 0; i < num_entries; i++) {
+		struct k_syscall_batch_entry *entry = &entries[i];
+		uintptr_t args[K_SYSCALL_BATCH_ARGS];
+		uint32_t id = entry->id;
+		uintptr_t ret;
+
+		/* Entries live in user memory: take a snapshot so that the
+		 * handler verifies the values it actually uses.
+		 */
+		memcpy(args, entry->args, sizeof(args));
+
+		K_OOPS(K_SYSCALL_VERIFY_MSG(id < K_SYSCALL_BAD &&
+					    id != K_SYSCALL_K_SYSCALL_BATCH_SUBMIT,
+					    "bad system call id %u in batch entry %u",
+					    id, i));
+
+		/* As on the system call entry path, the id must not be used
+		 * to index the table speculatively past the check above.
+		 */
+		id = k_array_index_sanitize(id, K_SYSCALL_LIMIT);
+
+		ret = _k_syscall_table[id](args[0], args[1], args[2], args[3],
+					   args[4], args[5], ssf);
+
+		/* The handler clears the frame on its way out, but we are
+		 * still serving the batch system call.
+		 */
+		_current->syscall_frame = ssf;
+		entry->result = ret;
+	}
+
+	return (int)num_entries;
+}
+#include <syscalls/k_syscall_batch_submit_mrsh.c>
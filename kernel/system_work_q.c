@@ -19,11 +19,21 @@ static K_KERNEL_STACK_DEFINE(sys_work_q_stack,
 
 struct k_work_q k_sys_work_q;
 
+#if defined(CONFIG_WORKQUEUE_POOL) && (CONFIG_SYSTEM_WORKQUEUE_NUM_WORKERS > 1)
+K_WORK_QUEUE_WORKERS_DEFINE(sys_work_q_workers,
+			    CONFIG_SYSTEM_WORKQUEUE_NUM_WORKERS - 1,
+			    CONFIG_SYSTEM_WORKQUEUE_STACK_SIZE);
+#endif
+
 static int k_sys_work_q_init(void)
 {
 	struct k_work_queue_config cfg = {
 		.name = "sysworkq",
 		.no_yield = IS_ENABLED(CONFIG_SYSTEM_WORKQUEUE_NO_YIELD),
+#if defined(CONFIG_WORKQUEUE_POOL) && (CONFIG_SYSTEM_WORKQUEUE_NUM_WORKERS > 1)
+		.num_workers = CONFIG_SYSTEM_WORKQUEUE_NUM_WORKERS,
+		.workers = &sys_work_q_workers,
+#endif
 	};
 
 	k_work_queue_start(&k_sys_work_q,
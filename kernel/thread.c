@@ -430,7 +430,17 @@ static char *setup_thread_stack(struct k_thread *new_thread,
 		stack_buf_size, (void *)stack_ptr);
 
 #ifdef CONFIG_INIT_STACKS
+#ifdef CONFIG_DYNAMIC_THREAD
+	/* A recycled pool stack still holds the fill pattern below the
+	 * high water mark of its previous thread
+	 */
+	size_t clean = MIN(z_thread_stack_pool_clean_size(stack, stack_buf_start),
+			   stack_buf_size);
+
+	memset(stack_buf_start + clean, 0xaa, stack_buf_size - clean);
+#else
 	memset(stack_buf_start, 0xaa, stack_buf_size);
+#endif /* CONFIG_DYNAMIC_THREAD */
 #endif /* CONFIG_INIT_STACKS */
 #ifdef CONFIG_STACK_SENTINEL
 	/* Put the stack sentinel at the lowest 4 bytes of the stack area.
@@ -513,6 +523,9 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 	/* Initialize various struct k_thread members */
 	z_init_thread_base(&new_thread->base, prio, _THREAD_PRESTART, options);
 	stack_ptr = setup_thread_stack(new_thread, stack, stack_size);
+#ifdef CONFIG_DYNAMIC_THREAD
+	z_thread_stack_pool_attach(new_thread, stack);
+#endif /* CONFIG_DYNAMIC_THREAD */
 
 #ifdef CONFIG_KERNEL_COHERENCE
 	/* Check that the thread object is safe, but that the stack is
@@ -578,6 +591,9 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 		new_thread->base.cpu_mask = -1; /* allow all cpus */
 	}
 #endif /* CONFIG_SCHED_CPU_MASK */
+#ifdef CONFIG_CPU_DOMAINS
+	new_thread->base.domain = K_CPU_DOMAIN_ANY;
+#endif /* CONFIG_CPU_DOMAINS */
 #ifdef CONFIG_ARCH_HAS_CUSTOM_SWAP_TO_MAIN
 	/* _current may be null if the dummy thread is not used */
 	if (!_current) {
@@ -718,6 +734,7 @@ void z_init_thread_base(struct _thread_base *thread_base, int priority,
 
 #ifdef CONFIG_SMP
 	thread_base->is_idle = 0;
+	thread_base->cpu = 0;
 #endif /* CONFIG_SMP */
 
 #ifdef CONFIG_TIMESLICE_PER_THREAD
@@ -945,6 +962,10 @@ int k_thread_runtime_stats_all_get(k_thread_runtime_stats_t *stats)
 		stats->average_cycles   += tmp_stats.average_cycles;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 		stats->idle_cycles      += tmp_stats.idle_cycles;
+#ifdef CONFIG_SCHED_IPI_STATS
+		stats->ipis_sent        += tmp_stats.ipis_sent;
+		stats->ipis_avoided     += tmp_stats.ipis_avoided;
+#endif /* CONFIG_SCHED_IPI_STATS */
 	}
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
@@ -11,11 +11,10 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
+#include <zephyr/sys/math_extras.h>
 
 static uint64_t curr_tick;
 
-static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
-
 static struct k_spinlock timeout_lock;
 
 #define MAX_WAIT (IS_ENABLED(CONFIG_SYSTEM_CLOCK_SLOPPY_IDLE) \
@@ -36,6 +35,227 @@ static inline int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+
+/* Hierarchical timer wheel.  Each level has WHEEL_SLOTS buckets and
+ * each bucket at level L spans WHEEL_SLOTS^L ticks.  Timeouts store
+ * their absolute expiry tick in dticks and live at the level of the
+ * most significant WHEEL_BITS-wide digit in which they differ from
+ * wheel_base (which tracks curr_tick).  Timeouts too far in the
+ * future for the top level sit in a sorted overflow list.  When the
+ * base advances, only the one bucket per level whose digit now
+ * matches the base needs to be redistributed, so insertion and
+ * removal are O(1) and the earliest timeout is found with a
+ * find-first-set per level.
+ */
+#define WHEEL_BITS   6
+#define WHEEL_SLOTS  BIT(WHEEL_BITS)
+#define WHEEL_MASK   (WHEEL_SLOTS - 1)
+#define WHEEL_LEVELS CONFIG_TIMEOUT_WHEEL_LEVELS
+
+BUILD_ASSERT(WHEEL_BITS * WHEEL_LEVELS < 64, "timer wheel too deep");
+
+struct wheel_level {
+	uint64_t bitmap;
+	sys_dlist_t slots[WHEEL_SLOTS];
+};
+
+static struct wheel_level wheel[WHEEL_LEVELS];
+
+static sys_dlist_t wheel_overflow = SYS_DLIST_STATIC_INIT(&wheel_overflow);
+
+static uint64_t wheel_base;
+
+/* Cached earliest timeout, only meaningful when wheel_next_valid */
+static struct _timeout *wheel_next;
+static bool wheel_next_valid = true;
+
+static inline unsigned int wheel_level(uint64_t expiry)
+{
+	uint64_t diff = expiry ^ wheel_base;
+
+	if (diff == 0U) {
+		return 0;
+	}
+
+	return (63 - u64_count_leading_zeros(diff)) / WHEEL_BITS;
+}
+
+static inline unsigned int wheel_slot(uint64_t expiry, unsigned int level)
+{
+	return (expiry >> (level * WHEEL_BITS)) & WHEEL_MASK;
+}
+
+static void wheel_place(struct _timeout *to)
+{
+	uint64_t expiry = (uint64_t)to->dticks;
+	unsigned int level = wheel_level(expiry);
+
+	if (level >= WHEEL_LEVELS) {
+		struct _timeout *t;
+
+		/* Far future: keep sorted, ties in insertion order */
+		SYS_DLIST_FOR_EACH_CONTAINER(&wheel_overflow, t, node) {
+			if ((uint64_t)t->dticks > expiry) {
+				sys_dlist_insert(&t->node, &to->node);
+				return;
+			}
+		}
+		sys_dlist_append(&wheel_overflow, &to->node);
+	} else {
+		unsigned int slot = wheel_slot(expiry, level);
+
+		/* Buckets are only initialized when they become occupied,
+		 * an empty bucket is never looked at.
+		 */
+		if ((wheel[level].bitmap & BIT64(slot)) == 0U) {
+			sys_dlist_init(&wheel[level].slots[slot]);
+			wheel[level].bitmap |= BIT64(slot);
+		}
+		sys_dlist_append(&wheel[level].slots[slot], &to->node);
+	}
+}
+
+/* Move wheel_base forward to curr_tick, redistributing the buckets
+ * whose digit now matches the new base.  All timeouts earlier than
+ * curr_tick must already have been removed.
+ */
+static void wheel_advance(void)
+{
+	uint64_t old_base = wheel_base;
+	struct _timeout *t, *tmp;
+
+	if (curr_tick == old_base) {
+		return;
+	}
+
+	wheel_base = curr_tick;
+
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&wheel_overflow, t, tmp, node) {
+		if (wheel_level((uint64_t)t->dticks) >= WHEEL_LEVELS) {
+			break;
+		}
+		sys_dlist_remove(&t->node);
+		wheel_place(t);
+	}
+
+	for (int l = WHEEL_LEVELS - 1; l > 0; l--) {
+		unsigned int shift = l * WHEEL_BITS;
+		unsigned int slot = wheel_slot(wheel_base, l);
+		sys_dlist_t *list = &wheel[l].slots[slot];
+
+		if ((old_base >> shift) == (wheel_base >> shift) ||
+		    (wheel[l].bitmap & BIT64(slot)) == 0U) {
+			continue;
+		}
+
+		wheel[l].bitmap &= ~BIT64(slot);
+		SYS_DLIST_FOR_EACH_CONTAINER_SAFE(list, t, tmp, node) {
+			sys_dlist_remove(&t->node);
+			wheel_place(t);
+		}
+	}
+}
+
+static struct _timeout *wheel_find_first(void)
+{
+	struct _timeout *ret = NULL;
+	struct _timeout *t;
+
+	if (wheel[0].bitmap != 0U) {
+		unsigned int slot = u64_count_trailing_zeros(wheel[0].bitmap);
+		sys_dnode_t *n = sys_dlist_peek_head(&wheel[0].slots[slot]);
+
+		return CONTAINER_OF(n, struct _timeout, node);
+	}
+
+	/* Higher level buckets are unsorted, but the lowest occupied
+	 * bucket of the lowest occupied level holds the earliest entry.
+	 */
+	for (int l = 1; l < WHEEL_LEVELS; l++) {
+		if (wheel[l].bitmap != 0U) {
+			unsigned int slot = u64_count_trailing_zeros(wheel[l].bitmap);
+
+			SYS_DLIST_FOR_EACH_CONTAINER(&wheel[l].slots[slot], t, node) {
+				if ((ret == NULL) || (t->dticks < ret->dticks)) {
+					ret = t;
+				}
+			}
+			return ret;
+		}
+	}
+
+	return SYS_DLIST_PEEK_HEAD_CONTAINER(&wheel_overflow, ret, node);
+}
+
+static struct _timeout *first(void)
+{
+	if (!wheel_next_valid) {
+		wheel_next = wheel_find_first();
+		wheel_next_valid = true;
+	}
+
+	return wheel_next;
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	uint64_t expiry = (uint64_t)t->dticks;
+	unsigned int level = wheel_level(expiry);
+
+	sys_dlist_remove(&t->node);
+
+	if (level < WHEEL_LEVELS) {
+		unsigned int slot = wheel_slot(expiry, level);
+
+		if (sys_dlist_is_empty(&wheel[level].slots[slot])) {
+			wheel[level].bitmap &= ~BIT64(slot);
+		}
+	}
+
+	if (t == wheel_next) {
+		wheel_next_valid = false;
+	}
+}
+
+/* Ticks from curr_tick until the timeout expires, must be locked */
+static k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	return timeout->dticks - (k_ticks_t)curr_tick;
+}
+
+static void insert_timeout(struct _timeout *to, k_ticks_t ticks)
+{
+	to->dticks = curr_tick + MAX(0, ticks);
+	wheel_place(to);
+
+	if (wheel_next_valid &&
+	    ((wheel_next == NULL) || (to->dticks < wheel_next->dticks))) {
+		wheel_next = to;
+	}
+}
+
+/* First timeout has expired at curr_tick, must be locked */
+static void expire_timeout(struct _timeout *t, int32_t dt)
+{
+	ARG_UNUSED(dt);
+
+	remove_timeout(t);
+	wheel_advance();
+}
+
+/* curr_tick has moved forward without expiring anything */
+static void consume_ticks(int32_t ticks)
+{
+	ARG_UNUSED(ticks);
+
+	wheel_advance();
+}
+
+#else
+
+static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -59,6 +279,87 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
+/* must be locked */
+static k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	k_ticks_t ticks = 0;
+
+	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
+		ticks += t->dticks;
+		if (timeout == t) {
+			break;
+		}
+	}
+
+	return ticks;
+}
+
+static void insert_timeout(struct _timeout *to, k_ticks_t ticks)
+{
+	struct _timeout *t;
+
+	to->dticks = ticks;
+
+	for (t = first(); t != NULL; t = next(t)) {
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			break;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	if (t == NULL) {
+		sys_dlist_append(&timeout_list, &to->node);
+	}
+}
+
+/* First timeout has expired dt ticks from the previous curr_tick, which
+ * is short of its deadline if it fired early within its slack.
+ */
+static void expire_timeout(struct _timeout *t, int32_t dt)
+{
+	t->dticks -= dt;
+	remove_timeout(t);
+}
+
+static void consume_ticks(int32_t ticks)
+{
+	struct _timeout *t = first();
+
+	if (t != NULL) {
+		t->dticks -= ticks;
+	}
+}
+
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
+#ifdef CONFIG_TIMEOUT_SLACK
+/* Timeouts expired ahead of their deadline, by a wakeup they share */
+static uint32_t merged_wakeups;
+#endif /* CONFIG_TIMEOUT_SLACK */
+
+static inline uint32_t timeout_slack(const struct _timeout *t)
+{
+#ifdef CONFIG_TIMEOUT_SLACK
+	return t->slack;
+#else
+	ARG_UNUSED(t);
+
+	return 0;
+#endif /* CONFIG_TIMEOUT_SLACK */
+}
+
+/* Timeouts are queued by their deadline, the latest tick their slack
+ * allows, which is what the system timer gets programmed for.  Any
+ * timeout whose window opens within the next @a ticks can expire now.
+ * Must be locked.
+ */
+static inline bool timeout_due(const struct _timeout *t, int32_t ticks)
+{
+	return (int64_t)timeout_rem(t) <= (int64_t)ticks + timeout_slack(t);
+}
+
 static int32_t elapsed(void)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
@@ -87,10 +388,10 @@ static int32_t next_timeout(void)
 	int32_t ret;
 
 	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	    ((int64_t)(timeout_rem(to) - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = MAX_WAIT;
 	} else {
-		ret = MAX(0, to->dticks - ticks_elapsed);
+		ret = MAX(0, timeout_rem(to) - ticks_elapsed);
 	}
 
 	return ret;
@@ -111,29 +412,16 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 	to->fn = fn;
 
 	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
+		k_ticks_t ticks;
 
 		if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
 		    Z_TICK_ABS(timeout.ticks) >= 0) {
-			k_ticks_t ticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
-
-			to->dticks = MAX(1, ticks);
+			ticks = MAX(1, Z_TICK_ABS(timeout.ticks) - curr_tick);
 		} else {
-			to->dticks = timeout.ticks + 1 + elapsed();
-		}
-
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
-			}
-			to->dticks -= t->dticks;
+			ticks = timeout.ticks + 1 + elapsed();
 		}
 
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
-		}
+		insert_timeout(to, ticks + timeout_slack(to));
 
 		if (to == first()) {
 			sys_clock_set_timeout(next_timeout(), false);
@@ -155,21 +443,6 @@ int z_abort_timeout(struct _timeout *to)
 	return ret;
 }
 
-/* must be locked */
-static k_ticks_t timeout_rem(const struct _timeout *timeout)
-{
-	k_ticks_t ticks = 0;
-
-	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
-		ticks += t->dticks;
-		if (timeout == t) {
-			break;
-		}
-	}
-
-	return ticks;
-}
-
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
 {
 	k_ticks_t ticks = 0;
@@ -228,13 +501,20 @@ void sys_clock_announce(int32_t ticks)
 	struct _timeout *t;
 
 	for (t = first();
-	     (t != NULL) && (t->dticks <= announce_remaining);
+	     (t != NULL) && timeout_due(t, announce_remaining);
 	     t = first()) {
-		int dt = t->dticks;
+		k_ticks_t rem = timeout_rem(t);
+		int dt = MIN(rem, announce_remaining);
+
+#ifdef CONFIG_TIMEOUT_SLACK
+		t->late = t->slack - (uint32_t)(rem - dt);
+		if (rem > dt) {
+			merged_wakeups++;
+		}
+#endif /* CONFIG_TIMEOUT_SLACK */
 
 		curr_tick += dt;
-		t->dticks = 0;
-		remove_timeout(t);
+		expire_timeout(t, dt);
 
 		k_spin_unlock(&timeout_lock, key);
 		t->fn(t);
@@ -242,11 +522,8 @@ void sys_clock_announce(int32_t ticks)
 		announce_remaining -= dt;
 	}
 
-	if (t != NULL) {
-		t->dticks -= announce_remaining;
-	}
-
 	curr_tick += announce_remaining;
+	consume_ticks(announce_remaining);
 	announce_remaining = 0;
 
 	sys_clock_set_timeout(next_timeout(), false);
@@ -258,6 +535,19 @@ void sys_clock_announce(int32_t ticks)
 #endif /* CONFIG_TIMESLICING */
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+uint32_t sys_clock_merged_wakeups_get(void)
+{
+	uint32_t ret = 0U;
+
+	K_SPINLOCK(&timeout_lock) {
+		ret = merged_wakeups;
+	}
+
+	return ret;
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 int64_t sys_clock_tick_get(void)
 {
 	uint64_t t = 0U;
@@ -330,7 +620,33 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 #ifdef CONFIG_ZTEST
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	K_SPINLOCK(&timeout_lock) {
+		sys_dlist_t pending;
+		struct _timeout *t, *tmp;
+
+		/* The wheel is laid out relative to curr_tick, so
+		 * rebuild it around the new base.
+		 */
+		sys_dlist_init(&pending);
+		for (t = first(); t != NULL; t = first()) {
+			remove_timeout(t);
+			sys_dlist_append(&pending, &t->node);
+		}
+
+		curr_tick = tick;
+		wheel_base = tick;
+
+		SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&pending, t, tmp, node) {
+			sys_dlist_remove(&t->node);
+			t->dticks = MAX(t->dticks, (k_ticks_t)tick);
+			wheel_place(t);
+		}
+		wheel_next_valid = false;
+	}
+#else
 	curr_tick = tick;
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 }
 
 void z_vrfy_sys_clock_tick_set(uint64_t tick)
@@ -56,8 +56,11 @@ void z_timer_expiration_handler(struct _timeout *t)
 	    !K_TIMEOUT_EQ(timer->period, K_FOREVER)) {
 		k_timeout_t next = timer->period;
 
-		/* see note about z_add_timeout() in z_impl_k_timer_start() */
-		next.ticks = MAX(next.ticks - 1, 0);
+		/* see note about z_add_timeout() in timer_start(), and
+		 * step from the nominal expiry if we fired late within the
+		 * timer's slack.
+		 */
+		next.ticks = MAX((int64_t)next.ticks - 1 - z_timeout_late(t), 0);
 
 #ifdef CONFIG_TIMEOUT_64BIT
 		/* Exploit the fact that uptime during a kernel
@@ -136,11 +139,9 @@ void k_timer_init(struct k_timer *timer,
 }
 
 
-void z_impl_k_timer_start(struct k_timer *timer, k_timeout_t duration,
-			  k_timeout_t period)
+static void timer_start(struct k_timer *timer, k_timeout_t duration,
+			k_timeout_t period, k_timeout_t slack)
 {
-	SYS_PORT_TRACING_OBJ_FUNC(k_timer, start, timer, duration, period);
-
 	/* Acquire spinlock to ensure safety during concurrent calls to
 	 * k_timer_start for scheduling or rescheduling. This is necessary
 	 * since k_timer_start can be preempted, especially for the same
@@ -173,6 +174,7 @@ void z_impl_k_timer_start(struct k_timer *timer, k_timeout_t duration,
 	(void)z_abort_timeout(&timer->timeout);
 	timer->period = period;
 	timer->status = 0U;
+	z_set_timeout_slack(&timer->timeout, slack);
 
 	z_add_timeout(&timer->timeout, z_timer_expiration_handler,
 		     duration);
@@ -180,6 +182,22 @@ void z_impl_k_timer_start(struct k_timer *timer, k_timeout_t duration,
 	k_spin_unlock(&lock, key);
 }
 
+void z_impl_k_timer_start(struct k_timer *timer, k_timeout_t duration,
+			  k_timeout_t period)
+{
+	SYS_PORT_TRACING_OBJ_FUNC(k_timer, start, timer, duration, period);
+
+	timer_start(timer, duration, period, K_NO_WAIT);
+}
+
+void z_impl_k_timer_start_slack(struct k_timer *timer, k_timeout_t duration,
+				k_timeout_t period, k_timeout_t slack)
+{
+	SYS_PORT_TRACING_OBJ_FUNC(k_timer, start, timer, duration, period);
+
+	timer_start(timer, duration, period, slack);
+}
+
 #ifdef CONFIG_USERSPACE
 static inline void z_vrfy_k_timer_start(struct k_timer *timer,
 					k_timeout_t duration,
@@ -189,6 +207,20 @@ static inline void z_vrfy_k_timer_start(struct k_timer *timer,
 	z_impl_k_timer_start(timer, duration, period);
 }
 #include <syscalls/k_timer_start_mrsh.c>
+
+static inline void z_vrfy_k_timer_start_slack(struct k_timer *timer,
+					      k_timeout_t duration,
+					      k_timeout_t period,
+					      k_timeout_t slack)
+{
+	K_OOPS(K_SYSCALL_OBJ(timer, K_OBJ_TIMER));
+	K_OOPS(K_SYSCALL_VERIFY_MSG(!K_TIMEOUT_EQ(slack, K_FOREVER) &&
+				    !(IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
+				      (Z_TICK_ABS(slack.ticks) >= 0)),
+				    "slack must be a finite relative timeout"));
+	z_impl_k_timer_start_slack(timer, duration, period, slack);
+}
+#include <syscalls/k_timer_start_slack_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
 void z_impl_k_timer_stop(struct k_timer *timer)
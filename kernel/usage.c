@@ -8,7 +8,8 @@
 
 #include <zephyr/timing/timing.h>
 #include <ksched.h>
-#include <zephyr/spinlock.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/barrier.h>
 #include <zephyr/sys/check.h>
 
 /* Need one of these for this to work */
@@ -16,7 +17,100 @@
 #error "No data backend configured for CONFIG_SCHED_THREAD_USAGE"
 #endif /* !CONFIG_USE_SWITCH && !CONFIG_INSTRUMENT_THREAD_SWITCHING */
 
-static struct k_spinlock usage_lock;
+/*
+ * Usage statistics are accumulated on every context switch without any
+ * lock.  Each block has a single writer: the CPU owning it for a CPU's
+ * usage0 and k_cycle_stats block, and the CPU running the thread for a
+ * thread's block.
+ *
+ * The enable, disable and reset operations may target blocks written by
+ * other CPUs, so they do not update them: they post a request in the
+ * block, which its writer applies in its next update.  Requests are
+ * applied at once to blocks the calling CPU writes.
+ *
+ * Readers do not take any lock either: each block carries a sequence
+ * counter which is odd while the block is being updated, and readers
+ * retry their copy until the sequence is even and unchanged across it.
+ * Requests still pending in the copy are applied to it, so they are seen
+ * by readers as soon as they are posted.
+ */
+#define USAGE_REQ_ENABLE	BIT(0)
+#define USAGE_REQ_DISABLE	BIT(1)
+#define USAGE_REQ_RESET		BIT(2)
+
+/* Post a request to the writer of @stats, cancelling requests in @clear */
+static void usage_request(struct k_cycle_stats *stats, atomic_val_t set,
+			  atomic_val_t clear)
+{
+	atomic_val_t old;
+
+	do {
+		old = atomic_get(&stats->req);
+	} while (!atomic_cas(&stats->req, old, (old & ~clear) | set));
+}
+
+static void usage_requests_apply(struct k_cycle_stats *stats, atomic_val_t req)
+{
+	if (((req & USAGE_REQ_ENABLE) != 0) && !stats->track_usage) {
+		stats->track_usage = true;
+#ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
+		stats->num_windows++;
+		stats->current = 0;
+#endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+	}
+
+	if ((req & USAGE_REQ_DISABLE) != 0) {
+		stats->track_usage = false;
+	}
+
+	if ((req & USAGE_REQ_RESET) != 0) {
+		stats->total = 0ULL;
+#ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
+		stats->current = 0ULL;
+		stats->longest = 0ULL;
+		stats->num_windows = stats->track_usage ? 1U : 0U;
+#endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+	}
+}
+
+static ALWAYS_INLINE void usage_update_begin(struct k_cycle_stats *stats)
+{
+	stats->seq++;
+	barrier_dmem_fence_full();
+}
+
+static ALWAYS_INLINE void usage_update_end(struct k_cycle_stats *stats)
+{
+	if (atomic_get(&stats->req) != 0) {
+		usage_requests_apply(stats, atomic_clear(&stats->req));
+	}
+
+	barrier_dmem_fence_full();
+	stats->seq++;
+}
+
+/* Whether the writer of @stats has anything to update */
+static ALWAYS_INLINE bool usage_update_needed(struct k_cycle_stats *stats)
+{
+	return stats->track_usage || (atomic_get(&stats->req) != 0);
+}
+
+/* Take a consistent copy of a block updated concurrently */
+static void usage_snapshot(const struct k_cycle_stats *stats,
+			   struct k_cycle_stats *copy)
+{
+	atomic_val_t seq;
+
+	do {
+		seq = atomic_get(&stats->seq);
+		barrier_dmem_fence_full();
+		*copy = *stats;
+		barrier_dmem_fence_full();
+	} while (((seq & 1) != 0) || (atomic_get(&stats->seq) != seq));
+
+	usage_requests_apply(copy, copy->req);
+	copy->req = 0;
+}
 
 static uint32_t usage_now(void)
 {
@@ -35,24 +129,32 @@ static uint32_t usage_now(void)
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 static void sched_cpu_update_usage(struct _cpu *cpu, uint32_t cycles)
 {
-	if (!cpu->usage->track_usage) {
+	struct k_cycle_stats *usage = cpu->usage;
+
+	if (!usage_update_needed(usage)) {
 		return;
 	}
 
-	if (cpu->current != cpu->idle_thread) {
-		cpu->usage->total += cycles;
+	usage_update_begin(usage);
+
+	if (!usage->track_usage) {
+		/* Only applies the pending requests */
+	} else if (cpu->current != cpu->idle_thread) {
+		usage->total += cycles;
 
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
-		cpu->usage->current += cycles;
+		usage->current += cycles;
 
-		if (cpu->usage->longest < cpu->usage->current) {
-			cpu->usage->longest = cpu->usage->current;
+		if (usage->longest < usage->current) {
+			usage->longest = usage->current;
 		}
 	} else {
-		cpu->usage->current = 0;
-		cpu->usage->num_windows++;
+		usage->current = 0;
+		usage->num_windows++;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 	}
+
+	usage_update_end(usage);
 }
 #else
 #define sched_cpu_update_usage(cpu, cycles)   do { } while (0)
@@ -60,78 +162,91 @@ static void sched_cpu_update_usage(struct _cpu *cpu, uint32_t cycles)
 
 static void sched_thread_update_usage(struct k_thread *thread, uint32_t cycles)
 {
-	thread->base.usage.total += cycles;
+	struct k_cycle_stats *usage = &thread->base.usage;
+
+	if (!usage_update_needed(usage)) {
+		return;
+	}
+
+	usage_update_begin(usage);
+
+	if (usage->track_usage) {
+		usage->total += cycles;
 
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
-	thread->base.usage.current += cycles;
+		usage->current += cycles;
 
-	if (thread->base.usage.longest < thread->base.usage.current) {
-		thread->base.usage.longest = thread->base.usage.current;
-	}
+		if (usage->longest < usage->current) {
+			usage->longest = usage->current;
+		}
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+	}
+
+	usage_update_end(usage);
 }
 
-void z_sched_usage_start(struct k_thread *thread)
+/* Account the current execution window of this CPU up to now, and apply
+ * the requests posted to it and to its current thread. Must be called on
+ * that CPU with local interrupts masked.
+ */
+static void sched_usage_flush(struct _cpu *cpu)
 {
-#ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
-	k_spinlock_key_t  key;
-
-	key = k_spin_lock(&usage_lock);
+	uint32_t now = usage_now();
+	uint32_t cycles = now - cpu->usage0;
 
-	_current_cpu->usage0 = usage_now();   /* Always update */
+	sched_thread_update_usage(cpu->current, cycles);
+	sched_cpu_update_usage(cpu, cycles);
 
-	if (thread->base.usage.track_usage) {
-		thread->base.usage.num_windows++;
-		thread->base.usage.current = 0;
-	}
+	cpu->usage0 = now;
+}
 
-	k_spin_unlock(&usage_lock, key);
-#else
-	/* One write through a volatile pointer doesn't require
-	 * synchronization as long as _usage() treats it as volatile
-	 * (we can't race with _stop() by design).
+void z_sched_usage_start(struct k_thread *thread)
+{
+	/* Local interrupts are masked, so this CPU is ours, and so is the
+	 * block of the thread it is about to run.
 	 */
+	struct _cpu *cpu = _current_cpu;
+	struct k_cycle_stats *usage = &thread->base.usage;
+
+	cpu->usage0 = usage_now();   /* Always update */
 
-	_current_cpu->usage0 = usage_now();
+	if (usage_update_needed(usage)) {
+		usage_update_begin(usage);
+#ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
+		if (usage->track_usage) {
+			usage->num_windows++;
+			usage->current = 0;
+		}
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+		usage_update_end(usage);
+	}
 }
 
 void z_sched_usage_stop(void)
 {
-	k_spinlock_key_t k   = k_spin_lock(&usage_lock);
-
-	struct _cpu     *cpu = _current_cpu;
-
+	struct _cpu *cpu = _current_cpu;
 	uint32_t u0 = cpu->usage0;
 
 	if (u0 != 0) {
 		uint32_t cycles = usage_now() - u0;
 
-		if (cpu->current->base.usage.track_usage) {
-			sched_thread_update_usage(cpu->current, cycles);
-		}
-
+		sched_thread_update_usage(cpu->current, cycles);
 		sched_cpu_update_usage(cpu, cycles);
 	}
 
 	cpu->usage0 = 0;
-	k_spin_unlock(&usage_lock, k);
 }
 
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 {
-	k_spinlock_key_t  key;
-	struct _cpu *cpu;
+	struct _cpu *cpu = &_kernel.cpus[cpu_id];
+	struct k_cycle_stats usage, idle;
+	unsigned int key;
 
-	key = k_spin_lock(&usage_lock);
-	cpu = _current_cpu;
-
-
-	if (&_kernel.cpus[cpu_id] == cpu) {
-		uint32_t  now = usage_now();
-		uint32_t cycles = now - cpu->usage0;
+	key = arch_irq_lock();
 
+	if (cpu == _current_cpu) {
 		/*
 		 * Getting stats for the current CPU. Update both its
 		 * current thread stats and the CPU stats as the CPU's
@@ -139,51 +254,49 @@ void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 		 * that information up-to-date.
 		 */
 
-		if (cpu->current->base.usage.track_usage) {
-			sched_thread_update_usage(cpu->current, cycles);
-		}
+		sched_usage_flush(cpu);
+	}
 
-		sched_cpu_update_usage(cpu, cycles);
+	arch_irq_unlock(key);
 
-		cpu->usage0 = now;
-	}
+	usage_snapshot(cpu->usage, &usage);
+	usage_snapshot(&cpu->idle_thread->base.usage, &idle);
 
-	stats->total_cycles     = cpu->usage->total;
+	stats->total_cycles     = usage.total;
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
-	stats->current_cycles   = cpu->usage->current;
-	stats->peak_cycles      = cpu->usage->longest;
+	stats->current_cycles   = usage.current;
+	stats->peak_cycles      = usage.longest;
 
-	if (cpu->usage->num_windows == 0) {
+	if (usage.num_windows == 0) {
 		stats->average_cycles = 0;
 	} else {
 		stats->average_cycles = stats->total_cycles /
-					cpu->usage->num_windows;
+					usage.num_windows;
 	}
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 
-	stats->idle_cycles =
-		_kernel.cpus[cpu_id].idle_thread->base.usage.total;
+	stats->idle_cycles = idle.total;
 
 	stats->execution_cycles = stats->total_cycles + stats->idle_cycles;
 
-	k_spin_unlock(&usage_lock, key);
+#ifdef CONFIG_SCHED_IPI_STATS
+	stats->ipis_sent =
+		(uint32_t)atomic_get(&_kernel.cpus[cpu_id].ipi_stats.sent);
+	stats->ipis_avoided =
+		(uint32_t)atomic_get(&_kernel.cpus[cpu_id].ipi_stats.avoided);
+#endif /* CONFIG_SCHED_IPI_STATS */
 }
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
 void z_sched_thread_usage(struct k_thread *thread,
 			  struct k_thread_runtime_stats *stats)
 {
-	struct _cpu *cpu;
-	k_spinlock_key_t  key;
-
-	key = k_spin_lock(&usage_lock);
-	cpu = _current_cpu;
+	struct k_cycle_stats usage;
+	unsigned int key;
 
+	key = arch_irq_lock();
 
-	if (thread == cpu->current) {
-		uint32_t now = usage_now();
-		uint32_t cycles = now - cpu->usage0;
-
+	if (thread == _current_cpu->current) {
 		/*
 		 * Getting stats for the current thread. Update both the
 		 * current thread stats and its CPU stats as the CPU's
@@ -191,167 +304,117 @@ void z_sched_thread_usage(struct k_thread *thread,
 		 * that information up-to-date.
 		 */
 
-		if (thread->base.usage.track_usage) {
-			sched_thread_update_usage(thread, cycles);
-		}
-
-		sched_cpu_update_usage(cpu, cycles);
-
-		cpu->usage0 = now;
+		sched_usage_flush(_current_cpu);
 	}
 
-	stats->execution_cycles = thread->base.usage.total;
-	stats->total_cycles     = thread->base.usage.total;
+	arch_irq_unlock(key);
 
 	/* Copy-out the thread's usage stats */
 
+	usage_snapshot(&thread->base.usage, &usage);
+
+	stats->execution_cycles = usage.total;
+	stats->total_cycles     = usage.total;
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
-	stats->current_cycles = thread->base.usage.current;
-	stats->peak_cycles    = thread->base.usage.longest;
+	stats->current_cycles = usage.current;
+	stats->peak_cycles    = usage.longest;
 
-	if (thread->base.usage.num_windows == 0) {
+	if (usage.num_windows == 0) {
 		stats->average_cycles = 0;
 	} else {
 		stats->average_cycles = stats->total_cycles /
-					thread->base.usage.num_windows;
+					usage.num_windows;
 	}
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 	stats->idle_cycles = 0;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
-	stats->execution_cycles = thread->base.usage.total;
+#ifdef CONFIG_SCHED_IPI_STATS
+	stats->ipis_sent = 0;
+	stats->ipis_avoided = 0;
+#endif /* CONFIG_SCHED_IPI_STATS */
+}
+
+#if defined(CONFIG_SCHED_THREAD_USAGE_ANALYSIS) || \
+	defined(CONFIG_OBJ_CORE_STATS_THREAD)
+/*
+ * Post a request to the block of @thread, and apply it right away if the
+ * thread runs on this CPU. Otherwise the CPU switching the thread out,
+ * or next switching it in, applies it.
+ */
+static void thread_usage_request(struct k_thread *thread, atomic_val_t set,
+				 atomic_val_t clear)
+{
+	unsigned int key = arch_irq_lock();
 
-	k_spin_unlock(&usage_lock, key);
+	usage_request(&thread->base.usage, set, clear);
+	if (thread == _current_cpu->current) {
+		sched_usage_flush(_current_cpu);
+	}
+
+	arch_irq_unlock(key);
 }
+#endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS || CONFIG_OBJ_CORE_STATS_THREAD */
 
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
 int k_thread_runtime_stats_enable(k_tid_t  thread)
 {
-	k_spinlock_key_t  key;
-
 	CHECKIF(thread == NULL) {
 		return -EINVAL;
 	}
 
-	key = k_spin_lock(&usage_lock);
-
-	if (!thread->base.usage.track_usage) {
-		thread->base.usage.track_usage = true;
-		thread->base.usage.num_windows++;
-		thread->base.usage.current = 0;
-	}
-
-	k_spin_unlock(&usage_lock, key);
+	thread_usage_request(thread, USAGE_REQ_ENABLE, USAGE_REQ_DISABLE);
 
 	return 0;
 }
 
 int k_thread_runtime_stats_disable(k_tid_t  thread)
 {
-	k_spinlock_key_t key;
-
 	CHECKIF(thread == NULL) {
 		return -EINVAL;
 	}
 
-	key = k_spin_lock(&usage_lock);
-	struct _cpu *cpu = _current_cpu;
-
-	if (thread->base.usage.track_usage) {
-		thread->base.usage.track_usage = false;
-
-		if (thread == cpu->current) {
-			uint32_t cycles = usage_now() - cpu->usage0;
-
-			sched_thread_update_usage(thread, cycles);
-			sched_cpu_update_usage(cpu, cycles);
-		}
-	}
-
-	k_spin_unlock(&usage_lock, key);
+	thread_usage_request(thread, USAGE_REQ_DISABLE, USAGE_REQ_ENABLE);
 
 	return 0;
 }
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
-void k_sys_runtime_stats_enable(void)
+/*
+ * Post a request to the block of every CPU. This CPU applies it right
+ * away, the others on their next context switch.
+ */
+static void sys_usage_request(atomic_val_t set, atomic_val_t clear)
 {
-	k_spinlock_key_t  key;
-
-	key = k_spin_lock(&usage_lock);
-
-	if (_current_cpu->usage->track_usage) {
-
-		/*
-		 * Usage tracking is already enabled on the current CPU
-		 * and thus on all other CPUs (if applicable). There is
-		 * nothing left to do.
-		 */
-
-		k_spin_unlock(&usage_lock, key);
-		return;
-	}
-
-	/* Enable gathering of runtime stats on each CPU */
-
 	unsigned int num_cpus = arch_num_cpus();
+	unsigned int key = arch_irq_lock();
 
-	for (uint8_t i = 0; i < num_cpus; i++) {
-		_kernel.cpus[i].usage->track_usage = true;
-#ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
-		_kernel.cpus[i].usage->num_windows++;
-		_kernel.cpus[i].usage->current = 0;
-#endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		usage_request(_kernel.cpus[i].usage, set, clear);
 	}
+	sched_usage_flush(_current_cpu);
 
-	k_spin_unlock(&usage_lock, key);
+	arch_irq_unlock(key);
 }
 
-void k_sys_runtime_stats_disable(void)
+void k_sys_runtime_stats_enable(void)
 {
-	struct _cpu *cpu;
-	k_spinlock_key_t key;
-
-	key = k_spin_lock(&usage_lock);
-
-	if (!_current_cpu->usage->track_usage) {
-
-		/*
-		 * Usage tracking is already disabled on the current CPU
-		 * and thus on all other CPUs (if applicable). There is
-		 * nothing left to do.
-		 */
-
-		k_spin_unlock(&usage_lock, key);
-		return;
-	}
-
-	uint32_t now = usage_now();
-
-	unsigned int num_cpus = arch_num_cpus();
-
-	for (uint8_t i = 0; i < num_cpus; i++) {
-		cpu = &_kernel.cpus[i];
-		if (cpu->usage0 != 0) {
-			sched_cpu_update_usage(cpu, now - cpu->usage0);
-		}
-		cpu->usage->track_usage = false;
-	}
+	sys_usage_request(USAGE_REQ_ENABLE, USAGE_REQ_DISABLE);
+}
 
-	k_spin_unlock(&usage_lock, key);
+void k_sys_runtime_stats_disable(void)
+{
+	sys_usage_request(USAGE_REQ_DISABLE, USAGE_REQ_ENABLE);
 }
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
 #ifdef CONFIG_OBJ_CORE_STATS_THREAD
 int z_thread_stats_raw(struct k_obj_core *obj_core, void *stats)
 {
-	k_spinlock_key_t  key;
-
-	key = k_spin_lock(&usage_lock);
-	memcpy(stats, obj_core->stats, sizeof(struct k_cycle_stats));
-	k_spin_unlock(&usage_lock, key);
+	usage_snapshot(obj_core->stats, stats);
 
 	return 0;
 }
@@ -369,46 +432,17 @@ int z_thread_stats_query(struct k_obj_core *obj_core, void *stats)
 
 int z_thread_stats_reset(struct k_obj_core *obj_core)
 {
-	k_spinlock_key_t  key;
-	struct k_cycle_stats  *stats;
 	struct k_thread *thread;
 
 	thread = CONTAINER_OF(obj_core, struct k_thread, obj_core);
-	key = k_spin_lock(&usage_lock);
-	stats = obj_core->stats;
-
-	stats->total = 0ULL;
-#ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
-	stats->current = 0ULL;
-	stats->longest = 0ULL;
-	stats->num_windows = (thread->base.usage.track_usage) ?  1U : 0U;
-#endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
-
-	if (thread != _current_cpu->current) {
-
-		/*
-		 * If the thread is not running, there is nothing else to do.
-		 * If the thread is running on another core, then it is not
-		 * safe to do anything else but unlock and return (and pretend
-		 * that its stats were reset at the start of its execution
-		 * window.
-		 */
-
-		k_spin_unlock(&usage_lock, key);
 
-		return 0;
-	}
-
-	/* Update the current CPU stats. */
-
-	uint32_t now = usage_now();
-	uint32_t cycles = now - _current_cpu->usage0;
-
-	sched_cpu_update_usage(_current_cpu, cycles);
-
-	_current_cpu->usage0 = now;
+	/*
+	 * If the thread is running on another core, its stats are reset
+	 * when it is switched out, which amounts to resetting them at the
+	 * start of its next execution window.
+	 */
 
-	k_spin_unlock(&usage_lock, key);
+	thread_usage_request(thread, USAGE_REQ_RESET, 0);
 
 	return 0;
 }
@@ -443,11 +477,7 @@ int z_thread_stats_enable(struct k_obj_core *obj_core)
 #ifdef CONFIG_OBJ_CORE_STATS_SYSTEM
 int z_cpu_stats_raw(struct k_obj_core *obj_core, void *stats)
 {
-	k_spinlock_key_t  key;
-
-	key = k_spin_lock(&usage_lock);
-	memcpy(stats, obj_core->stats, sizeof(struct k_cycle_stats));
-	k_spin_unlock(&usage_lock, key);
+	usage_snapshot(obj_core->stats, stats);
 
 	return 0;
 }
@@ -467,12 +497,12 @@ int z_cpu_stats_query(struct k_obj_core *obj_core, void *stats)
 #ifdef CONFIG_OBJ_CORE_STATS_SYSTEM
 int z_kernel_stats_raw(struct k_obj_core *obj_core, void *stats)
 {
-	k_spinlock_key_t  key;
+	const struct k_cycle_stats *src = obj_core->stats;
+	struct k_cycle_stats *dst = stats;
 
-	key = k_spin_lock(&usage_lock);
-	memcpy(stats, obj_core->stats,
-	       CONFIG_MP_MAX_NUM_CPUS * sizeof(struct k_cycle_stats));
-	k_spin_unlock(&usage_lock, key);
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		usage_snapshot(&src[i], &dst[i]);
+	}
 
 	return 0;
 }
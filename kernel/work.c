@@ -200,6 +200,9 @@ static void queue_flusher_locked(struct k_work_q *queue,
 	}
 
 	init_flusher(flusher);
+#ifdef CONFIG_WORKQUEUE_POOL
+	flusher->target = work;
+#endif /* CONFIG_WORKQUEUE_POOL */
 	if (in_list) {
 		sys_slist_insert(&queue->pending, &work->node,
 				 &flusher->work.node);
@@ -223,6 +226,29 @@ static inline void queue_remove_locked(struct k_work_q *queue,
 	}
 }
 
+/* Test whether a thread is one of the threads animating a queue.
+ *
+ * @param queue the queue to check
+ * @param thread the thread to look for
+ */
+static inline bool is_queue_thread(const struct k_work_q *queue,
+				   const struct k_thread *thread)
+{
+	if (thread == &queue->thread) {
+		return true;
+	}
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	for (int i = 0; i < (queue->num_workers - 1); i++) {
+		if (thread == &queue->workers->threads[i]) {
+			return true;
+		}
+	}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+	return false;
+}
+
 /* Potentially notify a queue that it needs to look for pending work.
  *
  * This may make the work queue thread ready, but as the lock is held it
@@ -272,7 +298,7 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	}
 
 	int ret = -EBUSY;
-	bool chained = (_current == &queue->thread) && !k_is_in_isr();
+	bool chained = is_queue_thread(queue, _current) && !k_is_in_isr();
 	bool draining = flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 	bool plugged = flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
 
@@ -609,6 +635,73 @@ bool k_work_cancel_sync(struct k_work *work,
 	return pending;
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+/* Test whether a pending work item may be started by a worker.
+ *
+ * An item running on another worker stays pending until that worker
+ * is done with it, and so does a flusher for an item that is running:
+ * this preserves handler non-reentrancy and flush ordering when the
+ * queue has several workers.
+ *
+ * Invoked with work lock held.
+ */
+static inline bool work_startable_locked(const struct k_work *work)
+{
+	if (flag_test(&work->flags, K_WORK_RUNNING_BIT)) {
+		return false;
+	}
+
+	if (flag_test(&work->flags, K_WORK_FLUSHING_BIT)) {
+		const struct z_work_flusher *flusher
+			= CONTAINER_OF(work, struct z_work_flusher, work);
+
+		return !flag_test(&flusher->target->flags, K_WORK_RUNNING_BIT);
+	}
+
+	return true;
+}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+/* Take the next work item that may be started off a queue.
+ *
+ * Invoked with work lock held.
+ *
+ * @return the node of the work item, or NULL if there is none.
+ */
+static inline sys_snode_t *queue_get_locked(struct k_work_q *queue)
+{
+#ifdef CONFIG_WORKQUEUE_POOL
+	sys_snode_t *node, *prev = NULL;
+
+	SYS_SLIST_FOR_EACH_NODE(&queue->pending, node) {
+		if (work_startable_locked(CONTAINER_OF(node, struct k_work, node))) {
+			sys_slist_remove(&queue->pending, prev, node);
+			return node;
+		}
+		prev = node;
+	}
+
+	return NULL;
+#else
+	return sys_slist_get(&queue->pending);
+#endif /* CONFIG_WORKQUEUE_POOL */
+}
+
+/* Test whether no work item is pending or running on a queue.
+ *
+ * Invoked with work lock held, after queue_get_locked() found nothing.
+ */
+static inline bool queue_idle_locked(const struct k_work_q *queue)
+{
+#ifdef CONFIG_WORKQUEUE_POOL
+	return (queue->busy == 0U) && sys_slist_is_empty(&queue->pending);
+#else
+	ARG_UNUSED(queue);
+
+	return true;
+#endif /* CONFIG_WORKQUEUE_POOL */
+}
+
 /* Loop executed by a work queue thread.
  *
  * @param workq_ptr pointer to the work queue structure
@@ -628,12 +721,15 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		bool yield;
 
 		/* Check for and prepare any new work. */
-		node = sys_slist_get(&queue->pending);
+		node = queue_get_locked(queue);
 		if (node != NULL) {
 			/* Mark that there's some work active that's
 			 * not on the pending list.
 			 */
 			flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+#ifdef CONFIG_WORKQUEUE_POOL
+			queue->busy++;
+#endif /* CONFIG_WORKQUEUE_POOL */
 			work = CONTAINER_OF(node, struct k_work, node);
 			flag_set(&work->flags, K_WORK_RUNNING_BIT);
 			flag_clear(&work->flags, K_WORK_QUEUED_BIT);
@@ -651,7 +747,8 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			 * This means that if node is not NULL, then work will not be NULL.
 			 */
 			handler = work->handler;
-		} else if (flag_test_and_clear(&queue->flags,
+		} else if (queue_idle_locked(queue) &&
+			   flag_test_and_clear(&queue->flags,
 					       K_WORK_QUEUE_DRAIN_BIT)) {
 			/* Not busy and draining: move threads waiting for
 			 * drain to ready state.  The held spinlock inhibits
@@ -702,7 +799,20 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			finalize_cancel_locked(work);
 		}
 
+#ifdef CONFIG_WORKQUEUE_POOL
+		if (--queue->busy == 0U) {
+			flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		}
+
+		/* Items held back while this one ran may now be started
+		 * by an idle worker.
+		 */
+		if (!sys_slist_is_empty(&queue->pending)) {
+			(void)notify_queue_locked(queue);
+		}
+#else
 		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+#endif /* CONFIG_WORKQUEUE_POOL */
 		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
 		k_spin_unlock(&lock, key);
 
@@ -761,6 +871,49 @@ void k_work_queue_start(struct k_work_q *queue,
 		k_thread_name_set(&queue->thread, cfg->name);
 	}
 
+#ifdef CONFIG_WORKQUEUE_POOL
+	queue->num_workers = 1U;
+	queue->busy = 0U;
+	queue->workers = NULL;
+
+	if ((cfg != NULL) && (cfg->num_workers > 1U)) {
+		__ASSERT_NO_MSG(cfg->workers != NULL);
+		__ASSERT_NO_MSG(cfg->workers->count >= (cfg->num_workers - 1U));
+
+		queue->num_workers = cfg->num_workers;
+		queue->workers = cfg->workers;
+	}
+
+	for (int i = 0; i < (queue->num_workers - 1); i++) {
+		struct k_thread *thread = &queue->workers->threads[i];
+		k_thread_stack_t *wstack = (k_thread_stack_t *)
+			((char *)queue->workers->stacks + (i * queue->workers->stack_len));
+
+		(void)k_thread_create(thread, wstack, queue->workers->stack_size,
+				      work_queue_main, queue, NULL, NULL,
+				      prio, 0, K_FOREVER);
+
+		if (cfg->name != NULL) {
+			k_thread_name_set(thread, cfg->name);
+		}
+	}
+
+#ifdef CONFIG_SCHED_CPU_MASK
+	if ((cfg != NULL) && cfg->pin_workers) {
+		for (int i = 0; i < queue->num_workers; i++) {
+			struct k_thread *thread = (i == 0) ? &queue->thread
+					: &queue->workers->threads[i - 1];
+
+			(void)k_thread_cpu_pin(thread, i % arch_num_cpus());
+		}
+	}
+#endif /* CONFIG_SCHED_CPU_MASK */
+
+	for (int i = 0; i < (queue->num_workers - 1); i++) {
+		k_thread_start(&queue->workers->threads[i]);
+	}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 	k_thread_start(&queue->thread);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
@@ -900,12 +1053,14 @@ int k_work_delayable_busy_get(const struct k_work_delayable *dwork)
  *
  * @param delay the delay to use before scheduling.
  *
+ * @param slack the additional delay the timeout may expire after.
+ *
  * @retval from submit_to_queue_locked() if delay is K_NO_WAIT; otherwise
  * @retval 1 to indicate successfully scheduled.
  */
 static int schedule_for_queue_locked(struct k_work_q **queuep,
 				     struct k_work_delayable *dwork,
-				     k_timeout_t delay)
+				     k_timeout_t delay, k_timeout_t slack)
 {
 	int ret = 1;
 	struct k_work *work = &dwork->work;
@@ -918,6 +1073,7 @@ static int schedule_for_queue_locked(struct k_work_q **queuep,
 	dwork->queue = *queuep;
 
 	/* Add timeout */
+	z_set_timeout_slack(&dwork->timeout, slack);
 	z_add_timeout(&dwork->timeout, work_timeout, delay);
 
 	return ret;
@@ -970,25 +1126,34 @@ static int cancel_delayable_async_locked(struct k_work_delayable *dwork)
 	return cancel_async_locked(&dwork->work);
 }
 
-int k_work_schedule_for_queue(struct k_work_q *queue,
-			       struct k_work_delayable *dwork,
-			       k_timeout_t delay)
+static int schedule_for_queue(struct k_work_q *queue,
+			      struct k_work_delayable *dwork,
+			      k_timeout_t delay, k_timeout_t slack)
 {
-	__ASSERT_NO_MSG(dwork != NULL);
-
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, schedule_for_queue, queue, dwork, delay);
-
 	struct k_work *work = &dwork->work;
 	int ret = 0;
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
 	/* Schedule the work item if it's idle or running. */
 	if ((work_busy_get_locked(work) & ~K_WORK_RUNNING) == 0U) {
-		ret = schedule_for_queue_locked(&queue, dwork, delay);
+		ret = schedule_for_queue_locked(&queue, dwork, delay, slack);
 	}
 
 	k_spin_unlock(&lock, key);
 
+	return ret;
+}
+
+int k_work_schedule_for_queue(struct k_work_q *queue,
+			       struct k_work_delayable *dwork,
+			       k_timeout_t delay)
+{
+	__ASSERT_NO_MSG(dwork != NULL);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, schedule_for_queue, queue, dwork, delay);
+
+	int ret = schedule_for_queue(queue, dwork, delay, K_NO_WAIT);
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, schedule_for_queue, queue, dwork, delay, ret);
 
 	return ret;
@@ -1006,6 +1171,33 @@ int k_work_schedule(struct k_work_delayable *dwork,
 	return ret;
 }
 
+int k_work_schedule_for_queue_slack(struct k_work_q *queue,
+				    struct k_work_delayable *dwork,
+				    k_timeout_t delay, k_timeout_t slack)
+{
+	__ASSERT_NO_MSG(dwork != NULL);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, schedule_for_queue, queue, dwork, delay);
+
+	int ret = schedule_for_queue(queue, dwork, delay, slack);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, schedule_for_queue, queue, dwork, delay, ret);
+
+	return ret;
+}
+
+int k_work_schedule_slack(struct k_work_delayable *dwork, k_timeout_t delay,
+			  k_timeout_t slack)
+{
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, schedule, dwork, delay);
+
+	int ret = k_work_schedule_for_queue_slack(&k_sys_work_q, dwork, delay, slack);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, schedule, dwork, delay, ret);
+
+	return ret;
+}
+
 int k_work_reschedule_for_queue(struct k_work_q *queue,
 				 struct k_work_delayable *dwork,
 				 k_timeout_t delay)
@@ -1021,7 +1213,7 @@ int k_work_reschedule_for_queue(struct k_work_q *queue,
 	(void)unschedule_locked(dwork);
 
 	/* Schedule the work item with the new parameters. */
-	ret = schedule_for_queue_locked(&queue, dwork, delay);
+	ret = schedule_for_queue_locked(&queue, dwork, delay, K_NO_WAIT);
 
 	k_spin_unlock(&lock, key);
 
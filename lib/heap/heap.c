@@ -508,6 +508,9 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 
 	struct z_heap *h = (struct z_heap *)addr;
 	heap->heap = h;
+#ifdef CONFIG_SYS_HEAP_CACHE
+	heap->cache = NULL;
+#endif
 	h->end_chunk = heap_sz;
 	h->avail_buckets = 0;
 
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/sys/sys_heap.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/kernel.h>
+#include <string.h>
+#include "heap.h"
+
+#define CACHE_BATCH		MAX(CONFIG_SYS_HEAP_CACHE_DEPTH / 2, 1)
+#define CLASS_SIZE(cls)		((size_t)SYS_HEAP_CACHE_MIN_SIZE << (cls))
+#define NO_CLASS		(-1)
+
+/* The magazines of a CPU are used by that CPU, under a per-CPU lock
+ * which only sys_heap_cache_flush_locked() takes from other CPUs.  A
+ * thread migrating after picking its CPU still holds the right lock.
+ */
+static inline struct sys_heap_cache_cpu *cache_cpu(struct sys_heap_cache *cache)
+{
+#ifdef CONFIG_SMP
+	return &cache->cpus[arch_curr_cpu()->id];
+#else
+	return &cache->cpus[0];
+#endif /* CONFIG_SMP */
+}
+
+/* Smallest class whose blocks can hold a request of @bytes */
+static int alloc_class(size_t bytes)
+{
+	for (int cls = 0; cls < CONFIG_SYS_HEAP_CACHE_CLASSES; cls++) {
+		if (bytes <= CLASS_SIZE(cls)) {
+			return cls;
+		}
+	}
+
+	return NO_CLASS;
+}
+
+/* Largest class that a block of @usable bytes satisfies.  Blocks more
+ * than twice the largest class are not worth pinning in a cache.
+ */
+static int free_class(size_t usable)
+{
+	if ((usable < CLASS_SIZE(0)) ||
+	    (usable >= 2 * CLASS_SIZE(CONFIG_SYS_HEAP_CACHE_CLASSES - 1))) {
+		return NO_CLASS;
+	}
+
+	int cls = 0;
+
+	while ((cls < (CONFIG_SYS_HEAP_CACHE_CLASSES - 1)) &&
+	       (usable >= CLASS_SIZE(cls + 1))) {
+		cls++;
+	}
+
+	return cls;
+}
+
+static bool cacheable_align(struct sys_heap_cache *cache, size_t align)
+{
+	/* Power-of-two alignments the cache guarantees; this excludes
+	 * the "rewind" encoding of sys_heap_aligned_alloc().
+	 */
+	return ((align & (align - 1)) == 0) && (align <= cache->align);
+}
+
+void sys_heap_cache_init(struct sys_heap_cache *cache, struct sys_heap *heap,
+			 size_t align)
+{
+	memset(cache, 0, sizeof(*cache));
+	cache->heap = heap;
+	cache->align = MAX(align, sizeof(void *));
+	heap->cache = cache;
+}
+
+void *sys_heap_cache_alloc(struct sys_heap_cache *cache, size_t align,
+			   size_t bytes)
+{
+	int cls = alloc_class(bytes);
+	void *mem = NULL;
+
+	if ((bytes == 0) || (cls == NO_CLASS) || !cacheable_align(cache, align)) {
+		return NULL;
+	}
+
+	struct sys_heap_cache_cpu *cpu = cache_cpu(cache);
+	k_spinlock_key_t key = k_spin_lock(&cpu->lock);
+	struct sys_heap_magazine *mag = &cpu->mags[cls];
+
+	if (mag->count > 0U) {
+		mem = mag->objs[--mag->count];
+		cpu->cached_bytes -= sys_heap_usable_size(cache->heap, mem);
+		cpu->hits++;
+	} else {
+		cpu->misses++;
+	}
+
+	k_spin_unlock(&cpu->lock, key);
+
+	return mem;
+}
+
+void *sys_heap_cache_alloc_locked(struct sys_heap_cache *cache, size_t align,
+				  size_t bytes)
+{
+	struct sys_heap *heap = cache->heap;
+	int cls = alloc_class(bytes);
+
+	if ((bytes == 0) || (cls == NO_CLASS) || !cacheable_align(cache, align)) {
+		void *mem = sys_heap_aligned_alloc(heap, align, bytes);
+
+		if ((mem == NULL) && (bytes != 0)) {
+			sys_heap_cache_flush_locked(cache);
+			mem = sys_heap_aligned_alloc(heap, align, bytes);
+		}
+
+		return mem;
+	}
+
+	size_t size = CLASS_SIZE(cls);
+	void *mem = sys_heap_aligned_alloc(heap, cache->align, size);
+
+	if (mem == NULL) {
+		sys_heap_cache_flush_locked(cache);
+
+		/* A fragmented heap may still fit the exact request */
+		return sys_heap_aligned_alloc(heap, align, bytes);
+	}
+
+	struct sys_heap_cache_cpu *cpu = cache_cpu(cache);
+	k_spinlock_key_t key = k_spin_lock(&cpu->lock);
+	struct sys_heap_magazine *mag = &cpu->mags[cls];
+
+	for (int i = 0; (i < CACHE_BATCH) &&
+			(mag->count < CONFIG_SYS_HEAP_CACHE_DEPTH); i++) {
+		void *extra = sys_heap_aligned_alloc(heap, cache->align, size);
+
+		if (extra == NULL) {
+			break;
+		}
+		mag->objs[mag->count++] = extra;
+		cpu->cached_bytes += sys_heap_usable_size(heap, extra);
+	}
+
+	k_spin_unlock(&cpu->lock, key);
+
+	return mem;
+}
+
+bool sys_heap_cache_free(struct sys_heap_cache *cache, void *mem)
+{
+	if (mem == NULL) {
+		return true;
+	}
+
+	if (((uintptr_t)mem & (cache->align - 1)) != 0) {
+		return false;
+	}
+
+	size_t usable = sys_heap_usable_size(cache->heap, mem);
+	int cls = free_class(usable);
+	bool cached = false;
+
+	if (cls == NO_CLASS) {
+		return false;
+	}
+
+	struct sys_heap_cache_cpu *cpu = cache_cpu(cache);
+	k_spinlock_key_t key = k_spin_lock(&cpu->lock);
+	struct sys_heap_magazine *mag = &cpu->mags[cls];
+
+	if (mag->count < CONFIG_SYS_HEAP_CACHE_DEPTH) {
+		mag->objs[mag->count++] = mem;
+		cpu->cached_bytes += usable;
+		cached = true;
+	}
+
+	k_spin_unlock(&cpu->lock, key);
+
+	return cached;
+}
+
+void sys_heap_cache_free_locked(struct sys_heap_cache *cache, void *mem)
+{
+	struct sys_heap *heap = cache->heap;
+
+	if (mem == NULL) {
+		return;
+	}
+
+	size_t usable = sys_heap_usable_size(heap, mem);
+	int cls = free_class(usable);
+
+	if ((cls == NO_CLASS) || (((uintptr_t)mem & (cache->align - 1)) != 0)) {
+		sys_heap_free(heap, mem);
+		return;
+	}
+
+	struct sys_heap_cache_cpu *cpu = cache_cpu(cache);
+	k_spinlock_key_t key = k_spin_lock(&cpu->lock);
+	struct sys_heap_magazine *mag = &cpu->mags[cls];
+
+	/* Return the oldest, coldest, half of a full magazine */
+	if (mag->count == CONFIG_SYS_HEAP_CACHE_DEPTH) {
+		for (int i = 0; i < CACHE_BATCH; i++) {
+			cpu->cached_bytes -= sys_heap_usable_size(heap, mag->objs[i]);
+			sys_heap_free(heap, mag->objs[i]);
+		}
+		mag->count -= CACHE_BATCH;
+		memmove(&mag->objs[0], &mag->objs[CACHE_BATCH],
+			mag->count * sizeof(mag->objs[0]));
+	}
+
+	mag->objs[mag->count++] = mem;
+	cpu->cached_bytes += usable;
+
+	k_spin_unlock(&cpu->lock, key);
+}
+
+void sys_heap_cache_flush_locked(struct sys_heap_cache *cache)
+{
+	/* Blocks cached on other CPUs are free memory too, which a
+	 * failing allocation must be able to use.
+	 */
+	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		struct sys_heap_cache_cpu *cpu = &cache->cpus[i];
+		k_spinlock_key_t key = k_spin_lock(&cpu->lock);
+
+		for (int cls = 0; cls < CONFIG_SYS_HEAP_CACHE_CLASSES; cls++) {
+			struct sys_heap_magazine *mag = &cpu->mags[cls];
+
+			while (mag->count > 0U) {
+				sys_heap_free(cache->heap,
+					      mag->objs[--mag->count]);
+			}
+		}
+		cpu->cached_bytes = 0;
+
+		k_spin_unlock(&cpu->lock, key);
+	}
+}
@@ -19,6 +19,30 @@ int sys_heap_runtime_stats_get(struct sys_heap *heap,
 	stats->allocated_bytes = heap->heap->allocated_bytes;
 	stats->max_allocated_bytes = heap->heap->max_allocated_bytes;
 
+#ifdef CONFIG_SYS_HEAP_CACHE
+	stats->cached_bytes = 0;
+	stats->cache_hits = 0;
+	stats->cache_misses = 0;
+
+	if (heap->cache != NULL) {
+		/* Racy snapshot of the other CPUs' counters, which is
+		 * good enough for statistics.
+		 */
+		for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+			struct sys_heap_cache_cpu *cpu = &heap->cache->cpus[i];
+
+			stats->cached_bytes += cpu->cached_bytes;
+			stats->cache_hits += cpu->hits;
+			stats->cache_misses += cpu->misses;
+		}
+
+		stats->cached_bytes = MIN(stats->cached_bytes,
+					  stats->allocated_bytes);
+		stats->allocated_bytes -= stats->cached_bytes;
+		stats->free_bytes += stats->cached_bytes;
+	}
+#endif /* CONFIG_SYS_HEAP_CACHE */
+
 	return 0;
 }
 
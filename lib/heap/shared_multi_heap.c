@@ -91,6 +91,22 @@ void *shared_multi_heap_alloc(enum shared_multi_heap_attr attr, size_t bytes)
 	return sys_multi_heap_alloc(&shared_multi_heap, (void *)(long) attr, bytes);
 }
 
+void *shared_multi_heap_alloc_local(size_t bytes)
+{
+	void *block = NULL;
+
+#ifdef CONFIG_CPU_DOMAINS
+	block = shared_multi_heap_alloc(SMH_REG_ATTR_DOMAIN(k_cpu_domain_current()),
+					bytes);
+#endif /* CONFIG_CPU_DOMAINS */
+
+	if (block == NULL) {
+		block = shared_multi_heap_alloc(SMH_REG_ATTR_CACHEABLE, bytes);
+	}
+
+	return block;
+}
+
 void *shared_multi_heap_aligned_alloc(enum shared_multi_heap_attr attr,
 				      size_t align, size_t bytes)
 {
@@ -116,6 +116,18 @@ extern char _heap_sentry[];
 
 Z_LIBC_DATA static struct sys_heap z_malloc_heap;
 
+#ifdef CONFIG_SYS_HEAP_CACHE
+/* Only supervisor threads use the cache, so it stays out of the libc
+ * partition.
+ */
+static struct sys_heap_cache z_malloc_cache;
+
+static inline bool malloc_cache_usable(void)
+{
+	return !k_is_user_context();
+}
+#endif /* CONFIG_SYS_HEAP_CACHE */
+
 #ifdef CONFIG_MULTITHREADING
 Z_LIBC_DATA SYS_MUTEX_DEFINE(z_malloc_heap_mutex);
 
@@ -139,11 +151,31 @@ malloc_unlock(void)
 
 void *malloc(size_t size)
 {
+#ifdef CONFIG_SYS_HEAP_CACHE
+	if (malloc_cache_usable()) {
+		void *ret = sys_heap_cache_alloc(&z_malloc_cache,
+						 __alignof__(z_max_align_t),
+						 size);
+
+		if (ret != NULL) {
+			return ret;
+		}
+	}
+#endif /* CONFIG_SYS_HEAP_CACHE */
+
 	malloc_lock();
 
+#ifdef CONFIG_SYS_HEAP_CACHE
+	void *ret = malloc_cache_usable() ?
+		sys_heap_cache_alloc_locked(&z_malloc_cache,
+					    __alignof__(z_max_align_t), size) :
+		sys_heap_aligned_alloc(&z_malloc_heap,
+				       __alignof__(z_max_align_t), size);
+#else
 	void *ret = sys_heap_aligned_alloc(&z_malloc_heap,
 					   __alignof__(z_max_align_t),
 					   size);
+#endif /* CONFIG_SYS_HEAP_CACHE */
 	if (ret == NULL && size != 0) {
 		errno = ENOMEM;
 	}
@@ -157,9 +189,16 @@ void *aligned_alloc(size_t alignment, size_t size)
 {
 	malloc_lock();
 
+#ifdef CONFIG_SYS_HEAP_CACHE
+	/* Also flushes the cache and retries when the heap is exhausted */
+	void *ret = malloc_cache_usable() ?
+		sys_heap_cache_alloc_locked(&z_malloc_cache, alignment, size) :
+		sys_heap_aligned_alloc(&z_malloc_heap, alignment, size);
+#else
 	void *ret = sys_heap_aligned_alloc(&z_malloc_heap,
 					   alignment,
 					   size);
+#endif /* CONFIG_SYS_HEAP_CACHE */
 	if (ret == NULL && size != 0) {
 		errno = ENOMEM;
 	}
@@ -232,6 +271,10 @@ static int malloc_prepare(void)
 #endif
 
 	sys_heap_init(&z_malloc_heap, heap_base, heap_size);
+#ifdef CONFIG_SYS_HEAP_CACHE
+	sys_heap_cache_init(&z_malloc_cache, &z_malloc_heap,
+			    __alignof__(z_max_align_t));
+#endif /* CONFIG_SYS_HEAP_CACHE */
 
 	return 0;
 }
@@ -255,6 +298,19 @@ void *realloc(void *ptr, size_t requested_size)
 
 void free(void *ptr)
 {
+#ifdef CONFIG_SYS_HEAP_CACHE
+	if (malloc_cache_usable()) {
+		if (sys_heap_cache_free(&z_malloc_cache, ptr)) {
+			return;
+		}
+
+		malloc_lock();
+		sys_heap_cache_free_locked(&z_malloc_cache, ptr);
+		malloc_unlock();
+		return;
+	}
+#endif /* CONFIG_SYS_HEAP_CACHE */
+
 	malloc_lock();
 	sys_heap_free(&z_malloc_heap, ptr);
 	malloc_unlock();
@@ -0,0 +1,527 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Compressed RAM backing store implementation
+ */
+#include <zephyr/kernel.h>
+#include <mmu.h>
+#include <string.h>
+#include <kernel_arch_interface.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/kernel/mm/demand_paging.h>
+
+/*
+ * Like the RAM backing store, this one has limited storage space and
+ * frees locations as soon as their data page is paged in, so all data
+ * pages are treated as dirty.
+ *
+ * Data pages are compressed on page-out and stored in a pool of fixed
+ * size chunks, in the manner of a zpool: a data page takes as many
+ * chunks as its compressed size requires, chained together and not
+ * necessarily contiguous, so the pool never fragments. A data page
+ * filled with a single byte value takes no chunk at all, and one that
+ * does not compress is stored as is.
+ *
+ * Location tokens are page-aligned entry indexes. As the compressed
+ * size of a data page is only known at page-out, each location handed
+ * out reserves enough chunks for an uncompressed page, and page-out
+ * releases whatever it did not use.
+ *
+ * The codec is a greedy LZ77 compressor with a single entry hash
+ * table, emitting the LZ4 block format.
+ */
+
+#define CHUNK_SIZE	64U
+#define NUM_CHUNKS	(CONFIG_BACKING_STORE_COMPRESSED_POOL_SIZE / CHUNK_SIZE)
+#define PAGE_CHUNKS	(CONFIG_MMU_PAGE_SIZE / CHUNK_SIZE)
+#define NUM_ENTRIES	CONFIG_BACKING_STORE_COMPRESSED_PAGES
+#define CHUNK_NONE	UINT16_MAX
+
+BUILD_ASSERT(NUM_CHUNKS >= 2 * PAGE_CHUNKS,
+	     "pool must hold at least two uncompressed pages");
+BUILD_ASSERT(NUM_CHUNKS < CHUNK_NONE, "pool too large for chunk indexes");
+BUILD_ASSERT(NUM_ENTRIES >= 2, "backing store must hold two pages");
+BUILD_ASSERT(CONFIG_MMU_PAGE_SIZE <= UINT16_MAX,
+	     "page offsets must fit the hash table");
+
+/* Entry states, a stored entry holds ENTRY_STORED plus its length */
+#define ENTRY_FREE	0U
+#define ENTRY_RESERVED	1U
+#define ENTRY_STORED	2U
+
+struct zentry {
+	uint16_t state;
+	/* First chunk of the stored data, or the fill byte */
+	uint16_t head;
+};
+
+static uint8_t pool[NUM_CHUNKS][CHUNK_SIZE] __aligned(sizeof(uint32_t));
+static uint16_t chunk_next[NUM_CHUNKS];
+static uint16_t free_chunk;
+static size_t free_chunks;
+static size_t reserved_chunks;
+
+static struct zentry entries[NUM_ENTRIES];
+static uint16_t free_entries[NUM_ENTRIES];
+static size_t num_free_entries;
+
+static struct k_spinlock zlock;
+static struct k_mem_paging_backing_store_compressed_stats zstats;
+
+/* Page-ins and page-outs are serialized, so they can share these */
+static uint8_t zbuf[CONFIG_MMU_PAGE_SIZE] __aligned(sizeof(uint32_t));
+
+/*
+ * Codec
+ */
+
+#define MIN_MATCH	4
+#define LAST_LITERALS	5
+#define MF_LIMIT	12
+#define MAX_OFFSET	UINT16_MAX
+#define HASH_LOG	10
+
+static uint16_t hash_table[1 << HASH_LOG];
+
+static inline uint32_t read32(const uint8_t *p)
+{
+	uint32_t v;
+
+	(void)memcpy(&v, p, sizeof(v));
+
+	return v;
+}
+
+static inline uint32_t hash4(uint32_t v)
+{
+	return (v * 2654435761U) >> (32 - HASH_LOG);
+}
+
+/* Worst case size of a sequence with @lit literals and a match of
+ * @mlen extra bytes
+ */
+static inline size_t seq_bound(size_t lit, size_t mlen)
+{
+	return 1 + (lit / 255 + 1) + lit + 2 + (mlen / 255 + 1);
+}
+
+static uint8_t *put_token(uint8_t *op, size_t lit, size_t mlen)
+{
+	*op++ = (MIN(lit, 15U) << 4) | MIN(mlen, 15U);
+	if (lit >= 15U) {
+		for (lit -= 15U; lit >= 255U; lit -= 255U) {
+			*op++ = 255U;
+		}
+		*op++ = lit;
+	}
+
+	return op;
+}
+
+static uint8_t *put_match_len(uint8_t *op, size_t mlen)
+{
+	if (mlen >= 15U) {
+		for (mlen -= 15U; mlen >= 255U; mlen -= 255U) {
+			*op++ = 255U;
+		}
+		*op++ = mlen;
+	}
+
+	return op;
+}
+
+/* Compress @n bytes of @src, returns the compressed size or 0 if it
+ * does not fit in @cap bytes
+ */
+static size_t lz_compress(const uint8_t *src, size_t n, uint8_t *dst,
+			  size_t cap)
+{
+	const uint8_t *ip = src, *anchor = src;
+	const uint8_t *mf_limit = src + n - MF_LIMIT;
+	const uint8_t *match_limit = src + n - LAST_LITERALS;
+	uint8_t *op = dst, *oend = dst + cap;
+	size_t lit;
+
+	(void)memset(hash_table, 0, sizeof(hash_table));
+
+	while (ip < mf_limit) {
+		uint32_t seq = read32(ip);
+		uint32_t h = hash4(seq);
+		const uint8_t *ref = src + hash_table[h];
+		const uint8_t *m, *r;
+		size_t mlen, offset;
+
+		hash_table[h] = ip - src;
+		if ((ref >= ip) || ((ip - ref) > MAX_OFFSET) ||
+		    (read32(ref) != seq)) {
+			ip++;
+			continue;
+		}
+
+		for (m = ip + MIN_MATCH, r = ref + MIN_MATCH;
+		     (m < match_limit) && (*m == *r); m++, r++) {
+		}
+
+		lit = ip - anchor;
+		mlen = m - ip - MIN_MATCH;
+		if (seq_bound(lit, mlen) > (size_t)(oend - op)) {
+			return 0;
+		}
+
+		op = put_token(op, lit, mlen);
+		(void)memcpy(op, anchor, lit);
+		op += lit;
+		offset = ip - ref;
+		*op++ = offset & 0xffU;
+		*op++ = offset >> 8;
+		op = put_match_len(op, mlen);
+
+		ip = m;
+		anchor = m;
+	}
+
+	lit = src + n - anchor;
+	if (seq_bound(lit, 0) > (size_t)(oend - op)) {
+		return 0;
+	}
+	op = put_token(op, lit, 0);
+	(void)memcpy(op, anchor, lit);
+	op += lit;
+
+	return op - dst;
+}
+
+static inline bool get_len(const uint8_t **ipp, const uint8_t *iend,
+			   size_t *len)
+{
+	const uint8_t *ip = *ipp;
+	uint8_t b;
+
+	do {
+		if (ip >= iend) {
+			return false;
+		}
+		b = *ip++;
+		*len += b;
+	} while (b == 255U);
+
+	*ipp = ip;
+
+	return true;
+}
+
+/* Decompress @n bytes of @src, returns the decompressed size or
+ * -EINVAL if the input is malformed or does not fit in @cap bytes
+ */
+static int lz_decompress(const uint8_t *src, size_t n, uint8_t *dst,
+			 size_t cap)
+{
+	const uint8_t *ip = src, *iend = src + n;
+	uint8_t *op = dst, *oend = dst + cap;
+
+	while (ip < iend) {
+		uint8_t token = *ip++;
+		size_t lit = token >> 4, mlen = token & 0xfU, offset;
+		const uint8_t *ref;
+
+		if ((lit == 15U) && !get_len(&ip, iend, &lit)) {
+			return -EINVAL;
+		}
+		if ((lit > (size_t)(iend - ip)) || (lit > (size_t)(oend - op))) {
+			return -EINVAL;
+		}
+		(void)memcpy(op, ip, lit);
+		op += lit;
+		ip += lit;
+
+		if (ip == iend) {
+			/* Last sequence has no match */
+			break;
+		}
+
+		if ((iend - ip) < 2) {
+			return -EINVAL;
+		}
+		offset = ip[0] | (ip[1] << 8);
+		ip += 2;
+		if ((offset == 0U) || (offset > (size_t)(op - dst))) {
+			return -EINVAL;
+		}
+
+		if ((mlen == 15U) && !get_len(&ip, iend, &mlen)) {
+			return -EINVAL;
+		}
+		mlen += MIN_MATCH;
+		if (mlen > (size_t)(oend - op)) {
+			return -EINVAL;
+		}
+
+		/* Source and destination overlap for offsets shorter than
+		 * the match, copy byte by byte
+		 */
+		for (ref = op - offset; mlen > 0U; mlen--) {
+			*op++ = *ref++;
+		}
+	}
+
+	return op - dst;
+}
+
+/*
+ * Chunk pool
+ */
+
+static uint16_t chunks_alloc(size_t count)
+{
+	uint16_t head = CHUNK_NONE;
+
+	__ASSERT(count <= free_chunks, "chunk pool overrun");
+
+	for (size_t i = 0; i < count; i++) {
+		uint16_t c = free_chunk;
+
+		free_chunk = chunk_next[c];
+		chunk_next[c] = head;
+		head = c;
+	}
+	free_chunks -= count;
+
+	return head;
+}
+
+static void chunks_free(uint16_t head)
+{
+	while (head != CHUNK_NONE) {
+		uint16_t next = chunk_next[head];
+
+		chunk_next[head] = free_chunk;
+		free_chunk = head;
+		free_chunks++;
+		head = next;
+	}
+}
+
+static void chunks_write(uint16_t head, const uint8_t *data, size_t len)
+{
+	for (uint16_t c = head; len > 0U; c = chunk_next[c]) {
+		size_t n = MIN(len, CHUNK_SIZE);
+
+		(void)memcpy(pool[c], data, n);
+		data += n;
+		len -= n;
+	}
+}
+
+static void chunks_read(uint16_t head, uint8_t *data, size_t len)
+{
+	for (uint16_t c = head; len > 0U; c = chunk_next[c]) {
+		size_t n = MIN(len, CHUNK_SIZE);
+
+		(void)memcpy(data, pool[c], n);
+		data += n;
+		len -= n;
+	}
+}
+
+static inline struct zentry *location_to_entry(uintptr_t location)
+{
+	__ASSERT(location % CONFIG_MMU_PAGE_SIZE == 0,
+		 "unaligned location 0x%lx", location);
+	__ASSERT(location < (NUM_ENTRIES * CONFIG_MMU_PAGE_SIZE),
+		 "bad location 0x%lx, past bounds of backing store", location);
+
+	return &entries[location / CONFIG_MMU_PAGE_SIZE];
+}
+
+static bool is_same_filled(const uint8_t *page)
+{
+	uint32_t word = read32(page);
+
+	if (word != (page[0] * 0x01010101U)) {
+		return false;
+	}
+
+	for (size_t i = sizeof(word); i < CONFIG_MMU_PAGE_SIZE;
+	     i += sizeof(word)) {
+		if (read32(page + i) != word) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/*
+ * Backing store APIs
+ */
+
+int k_mem_paging_backing_store_location_get(struct z_page_frame *pf,
+					    uintptr_t *location,
+					    bool page_fault)
+{
+	size_t needed = page_fault ? 1U : 2U;
+	k_spinlock_key_t key = k_spin_lock(&zlock);
+	uint16_t idx;
+
+	ARG_UNUSED(pf);
+
+	/* Keep room for one uncompressed page for page faults */
+	if ((num_free_entries < needed) ||
+	    ((free_chunks - reserved_chunks) < (needed * PAGE_CHUNKS))) {
+		k_spin_unlock(&zlock, key);
+		return -ENOMEM;
+	}
+
+	idx = free_entries[--num_free_entries];
+	entries[idx].state = ENTRY_RESERVED;
+	reserved_chunks += PAGE_CHUNKS;
+	*location = (uintptr_t)idx * CONFIG_MMU_PAGE_SIZE;
+
+	k_spin_unlock(&zlock, key);
+
+	return 0;
+}
+
+void k_mem_paging_backing_store_location_free(uintptr_t location)
+{
+	struct zentry *e = location_to_entry(location);
+	k_spinlock_key_t key = k_spin_lock(&zlock);
+
+	__ASSERT(e->state != ENTRY_FREE, "location 0x%lx already free",
+		 location);
+
+	if (e->state == ENTRY_RESERVED) {
+		reserved_chunks -= PAGE_CHUNKS;
+	} else {
+		size_t len = e->state - ENTRY_STORED;
+
+		if (len == 0U) {
+			zstats.same_filled--;
+		} else {
+			if (len == CONFIG_MMU_PAGE_SIZE) {
+				zstats.incompressible--;
+			}
+			zstats.stored_bytes -= ROUND_UP(len, CHUNK_SIZE);
+			chunks_free(e->head);
+		}
+		zstats.pages--;
+	}
+
+	e->state = ENTRY_FREE;
+	free_entries[num_free_entries++] = e - entries;
+
+	k_spin_unlock(&zlock, key);
+}
+
+void k_mem_paging_backing_store_page_out(uintptr_t location)
+{
+	struct zentry *e = location_to_entry(location);
+	const uint8_t *page = Z_SCRATCH_PAGE;
+	const uint8_t *data = zbuf;
+	k_spinlock_key_t key;
+	size_t len;
+
+	__ASSERT(e->state == ENTRY_RESERVED, "location 0x%lx not reserved",
+		 location);
+
+	if (is_same_filled(page)) {
+		len = 0U;
+	} else {
+		/* Only keep compressed data that saves at least a chunk */
+		len = lz_compress(page, CONFIG_MMU_PAGE_SIZE, zbuf,
+				  CONFIG_MMU_PAGE_SIZE - CHUNK_SIZE);
+		if (len == 0U) {
+			len = CONFIG_MMU_PAGE_SIZE;
+			data = page;
+		}
+	}
+
+	key = k_spin_lock(&zlock);
+
+	reserved_chunks -= PAGE_CHUNKS;
+	if (len == 0U) {
+		e->head = page[0];
+		zstats.same_filled++;
+	} else {
+		e->head = chunks_alloc(DIV_ROUND_UP(len, CHUNK_SIZE));
+		chunks_write(e->head, data, len);
+		if (len == CONFIG_MMU_PAGE_SIZE) {
+			zstats.incompressible++;
+		}
+		zstats.stored_bytes += ROUND_UP(len, CHUNK_SIZE);
+	}
+	e->state = ENTRY_STORED + len;
+	zstats.pages++;
+	zstats.page_outs++;
+
+	k_spin_unlock(&zlock, key);
+}
+
+void k_mem_paging_backing_store_page_in(uintptr_t location)
+{
+	struct zentry *e = location_to_entry(location);
+	uint8_t *page = Z_SCRATCH_PAGE;
+	uint32_t start = k_cycle_get_32();
+	size_t len = e->state - ENTRY_STORED;
+	k_spinlock_key_t key;
+	uint32_t cycles;
+
+	__ASSERT(e->state >= ENTRY_STORED, "location 0x%lx holds no page",
+		 location);
+
+	if (len == 0U) {
+		(void)memset(page, e->head, CONFIG_MMU_PAGE_SIZE);
+	} else if (len == CONFIG_MMU_PAGE_SIZE) {
+		chunks_read(e->head, page, len);
+	} else {
+		int ret;
+
+		chunks_read(e->head, zbuf, len);
+		ret = lz_decompress(zbuf, len, page, CONFIG_MMU_PAGE_SIZE);
+		__ASSERT(ret == CONFIG_MMU_PAGE_SIZE,
+			 "corrupted page at location 0x%lx", location);
+		(void)ret;
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	key = k_spin_lock(&zlock);
+	zstats.page_ins++;
+	zstats.page_in_cycles += cycles;
+	zstats.page_in_cycles_max = MAX(zstats.page_in_cycles_max, cycles);
+	k_spin_unlock(&zlock, key);
+}
+
+void k_mem_paging_backing_store_page_finalize(struct z_page_frame *pf,
+					      uintptr_t location)
+{
+	k_mem_paging_backing_store_location_free(location);
+}
+
+void k_mem_paging_backing_store_init(void)
+{
+	for (uint16_t c = 0; c < NUM_CHUNKS; c++) {
+		chunk_next[c] = (c + 1U < NUM_CHUNKS) ? (c + 1U) : CHUNK_NONE;
+	}
+	free_chunk = 0U;
+	free_chunks = NUM_CHUNKS;
+	reserved_chunks = 0U;
+
+	for (uint16_t i = 0; i < NUM_ENTRIES; i++) {
+		entries[i].state = ENTRY_FREE;
+		free_entries[i] = NUM_ENTRIES - 1U - i;
+	}
+	num_free_entries = NUM_ENTRIES;
+}
+
+void k_mem_paging_backing_store_compressed_stats_get(
+	struct k_mem_paging_backing_store_compressed_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&zlock);
+
+	(void)memcpy(stats, &zstats, sizeof(zstats));
+
+	k_spin_unlock(&zlock, key);
+}
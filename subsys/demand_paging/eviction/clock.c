@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Clock (second chance) eviction algorithm for demand paging
+ */
+#include <zephyr/kernel.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+#include <kernel_internal.h>
+
+#include <zephyr/kernel/mm/demand_paging.h>
+
+/* The page frames form a circular list swept by a clock hand. When a
+ * page frame needs to be evicted, the hand advances over the evictable
+ * page frames: one accessed since the hand last passed over it has its
+ * accessed bit cleared and gets a second chance, the first one that was
+ * not accessed is the victim. The hand stays where it stopped, so each
+ * eviction resumes the sweep and only examines as many page frames as
+ * were accessed since, which approximates LRU without rescanning all of
+ * memory on a periodic timer.
+ *
+ * Page frames of pages that have just been paged in are accessed by the
+ * faulting access itself, so they are always spared by the next pass of
+ * the hand.
+ */
+static size_t clock_hand;
+
+struct z_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	struct z_page_frame *pf = NULL;
+	unsigned long scanned = 0U, referenced = 0U;
+	uintptr_t flags = 0U;
+
+	/* Two full turns at most: after the first one, every evictable
+	 * page frame has had its accessed bit cleared.
+	 */
+	for (size_t n = 0; n < (2 * Z_NUM_PAGE_FRAMES); n++) {
+		struct z_page_frame *cur = &z_page_frames[clock_hand];
+
+		clock_hand = (clock_hand + 1) % Z_NUM_PAGE_FRAMES;
+
+		if (!z_page_frame_is_evictable(cur)) {
+			continue;
+		}
+
+		scanned++;
+
+		/* Fetch the states of the page and clear its accessed
+		 * bit in the page tables
+		 */
+		flags = arch_page_info_get(cur->addr, NULL, true);
+
+		/* Implies a mismatch with page frame ontology and page
+		 * tables
+		 */
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U,
+			 "non-present page, %s",
+			 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
+			 "un-mapped" : "paged out");
+
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) != 0UL) {
+			referenced++;
+			continue;
+		}
+
+		pf = cur;
+		break;
+	}
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(pf != NULL, "no page to evict");
+
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	z_paging_stats_eviction_scan(scanned, referenced);
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+
+	*dirty_ptr = (flags & ARCH_DATA_PAGE_DIRTY) != 0UL;
+
+	return pf;
+}
+
+void k_mem_paging_eviction_init(void)
+{
+	clock_hand = 0;
+}
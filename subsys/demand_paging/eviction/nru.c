@@ -8,6 +8,7 @@
 #include <zephyr/kernel.h>
 #include <mmu.h>
 #include <kernel_arch_interface.h>
+#include <kernel_internal.h>
 #include <zephyr/init.h>
 
 #include <zephyr/kernel/mm/demand_paging.h>
@@ -50,6 +51,7 @@ struct z_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
 	bool last_dirty = false;
 	bool dirty = false;
 	uintptr_t flags, phys;
+	unsigned long scanned = 0U, referenced = 0U;
 
 	Z_PAGE_FRAME_FOREACH(phys, pf) {
 		unsigned int prec;
@@ -70,6 +72,9 @@ struct z_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
 			 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
 			 "un-mapped" : "paged out");
 
+		scanned++;
+		referenced += accessed ? 1U : 0U;
+
 		prec = (dirty ? 1U : 0U) + (accessed ? 2U : 0U);
 		if (prec == 0) {
 			/* If we find a not accessed, clean page we're done */
@@ -87,6 +92,10 @@ struct z_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
 	/* Shouldn't ever happen unless every page is pinned */
 	__ASSERT(last_pf != NULL, "no page to evict");
 
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	z_paging_stats_eviction_scan(scanned, referenced);
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+
 	*dirty_ptr = last_dirty;
 
 	return last_pf;
@@ -105,6 +105,7 @@ static void shell_tdata_dump(const struct k_thread *cthread, void *user_data)
 	const char *tname;
 	int ret;
 	char state_str[32];
+	k_ticks_t timeout = 0;
 
 #ifdef CONFIG_THREAD_RUNTIME_STATS
 	k_thread_runtime_stats_t rt_stats_thread;
@@ -113,6 +114,11 @@ static void shell_tdata_dump(const struct k_thread *cthread, void *user_data)
 
 	tname = k_thread_name_get(thread);
 
+#ifdef CONFIG_SYS_CLOCK_EXISTS
+	/* The timeout backend may store an absolute expiry in dticks */
+	timeout = z_timeout_remaining(&thread->base.timeout);
+#endif /* CONFIG_SYS_CLOCK_EXISTS */
+
 	shell_print(sh, "%s%p %-10s",
 		      (thread == k_current_get()) ? "*" : " ",
 		      thread,
@@ -121,7 +127,7 @@ static void shell_tdata_dump(const struct k_thread *cthread, void *user_data)
 	shell_print(sh, "\toptions: 0x%x, priority: %d timeout: %" PRId64,
 		      thread->base.user_options,
 		      thread->base.prio,
-		      (int64_t)thread->base.timeout.dticks);
+		      (int64_t)timeout);
 	shell_print(sh, "\tstate: %s, entry: %p",
 		    k_thread_state_str(thread, state_str, sizeof(state_str)),
 		    thread->entry.pEntry);
@@ -264,6 +264,12 @@ extern "C" {
 #define sys_port_trace_k_msgq_get_enter(msgq, timeout)
 #define sys_port_trace_k_msgq_get_blocking(msgq, timeout)
 #define sys_port_trace_k_msgq_get_exit(msgq, timeout, ret)
+#define sys_port_trace_k_msgq_put_n_enter(msgq, timeout)
+#define sys_port_trace_k_msgq_put_n_blocking(msgq, timeout)
+#define sys_port_trace_k_msgq_put_n_exit(msgq, timeout, ret)
+#define sys_port_trace_k_msgq_get_n_enter(msgq, timeout)
+#define sys_port_trace_k_msgq_get_n_blocking(msgq, timeout)
+#define sys_port_trace_k_msgq_get_n_exit(msgq, timeout, ret)
 #define sys_port_trace_k_msgq_peek(msgq, ret)
 #define sys_port_trace_k_msgq_purge(msgq)
 
@@ -295,6 +301,16 @@ extern "C" {
 #define sys_port_trace_k_pipe_get_enter(pipe, timeout)
 #define sys_port_trace_k_pipe_get_blocking(pipe, timeout)
 #define sys_port_trace_k_pipe_get_exit(pipe, timeout, ret)
+#define sys_port_trace_k_pipe_put_claim_enter(pipe, timeout)
+#define sys_port_trace_k_pipe_put_claim_blocking(pipe, timeout)
+#define sys_port_trace_k_pipe_put_claim_exit(pipe, timeout, ret)
+#define sys_port_trace_k_pipe_put_finish_enter(pipe)
+#define sys_port_trace_k_pipe_put_finish_exit(pipe, ret)
+#define sys_port_trace_k_pipe_get_claim_enter(pipe, timeout)
+#define sys_port_trace_k_pipe_get_claim_blocking(pipe, timeout)
+#define sys_port_trace_k_pipe_get_claim_exit(pipe, timeout, ret)
+#define sys_port_trace_k_pipe_get_finish_enter(pipe)
+#define sys_port_trace_k_pipe_get_finish_exit(pipe, ret)
 
 #define sys_port_trace_k_heap_init(heap)
 #define sys_port_trace_k_heap_aligned_alloc_enter(heap, timeout)
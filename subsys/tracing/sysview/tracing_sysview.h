@@ -505,6 +505,12 @@ void sys_trace_thread_info(struct k_thread *thread);
 #define sys_port_trace_k_msgq_get_enter(msgq, timeout)
 #define sys_port_trace_k_msgq_get_blocking(msgq, timeout)
 #define sys_port_trace_k_msgq_get_exit(msgq, timeout, ret)
+#define sys_port_trace_k_msgq_put_n_enter(msgq, timeout)
+#define sys_port_trace_k_msgq_put_n_blocking(msgq, timeout)
+#define sys_port_trace_k_msgq_put_n_exit(msgq, timeout, ret)
+#define sys_port_trace_k_msgq_get_n_enter(msgq, timeout)
+#define sys_port_trace_k_msgq_get_n_blocking(msgq, timeout)
+#define sys_port_trace_k_msgq_get_n_exit(msgq, timeout, ret)
 #define sys_port_trace_k_msgq_peek(msgq, ret)
 #define sys_port_trace_k_msgq_purge(msgq)
 
@@ -536,6 +542,16 @@ void sys_trace_thread_info(struct k_thread *thread);
 #define sys_port_trace_k_pipe_get_enter(pipe, timeout)
 #define sys_port_trace_k_pipe_get_blocking(pipe, timeout)
 #define sys_port_trace_k_pipe_get_exit(pipe, timeout, ret)
+#define sys_port_trace_k_pipe_put_claim_enter(pipe, timeout)
+#define sys_port_trace_k_pipe_put_claim_blocking(pipe, timeout)
+#define sys_port_trace_k_pipe_put_claim_exit(pipe, timeout, ret)
+#define sys_port_trace_k_pipe_put_finish_enter(pipe)
+#define sys_port_trace_k_pipe_put_finish_exit(pipe, ret)
+#define sys_port_trace_k_pipe_get_claim_enter(pipe, timeout)
+#define sys_port_trace_k_pipe_get_claim_blocking(pipe, timeout)
+#define sys_port_trace_k_pipe_get_claim_exit(pipe, timeout, ret)
+#define sys_port_trace_k_pipe_get_finish_enter(pipe)
+#define sys_port_trace_k_pipe_get_finish_exit(pipe, ret)
 
 #define sys_port_trace_k_event_init(event)
 #define sys_port_trace_k_event_post_enter(event, events, events_mask)
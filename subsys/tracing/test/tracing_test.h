@@ -315,6 +315,18 @@
 	sys_trace_k_msgq_get_blocking(msgq, data, timeout)
 #define sys_port_trace_k_msgq_get_exit(msgq, timeout, ret)                                         \
 	sys_trace_k_msgq_get_exit(msgq, data, timeout, ret)
+#define sys_port_trace_k_msgq_put_n_enter(msgq, timeout)                                           \
+	sys_trace_k_msgq_put_n_enter(msgq, data, num_msgs, timeout)
+#define sys_port_trace_k_msgq_put_n_blocking(msgq, timeout)                                        \
+	sys_trace_k_msgq_put_n_blocking(msgq, data, num_msgs, timeout)
+#define sys_port_trace_k_msgq_put_n_exit(msgq, timeout, ret)                                       \
+	sys_trace_k_msgq_put_n_exit(msgq, data, num_msgs, timeout, ret)
+#define sys_port_trace_k_msgq_get_n_enter(msgq, timeout)                                           \
+	sys_trace_k_msgq_get_n_enter(msgq, data, num_msgs, timeout)
+#define sys_port_trace_k_msgq_get_n_blocking(msgq, timeout)                                        \
+	sys_trace_k_msgq_get_n_blocking(msgq, data, num_msgs, timeout)
+#define sys_port_trace_k_msgq_get_n_exit(msgq, timeout, ret)                                       \
+	sys_trace_k_msgq_get_n_exit(msgq, data, num_msgs, timeout, ret)
 #define sys_port_trace_k_msgq_peek(msgq, ret) sys_trace_k_msgq_peek(msgq, data, ret)
 #define sys_port_trace_k_msgq_purge(msgq) sys_trace_k_msgq_purge(msgq)
 
@@ -366,6 +378,24 @@
 	sys_trace_k_pipe_get_blocking(pipe, data, bytes_to_read, bytes_read, min_xfer, timeout)
 #define sys_port_trace_k_pipe_get_exit(pipe, timeout, ret)                                         \
 	sys_trace_k_pipe_get_exit(pipe, data, bytes_to_read, bytes_read, min_xfer, timeout, ret)
+#define sys_port_trace_k_pipe_put_claim_enter(pipe, timeout)                                       \
+	sys_trace_k_pipe_put_claim_enter(pipe, data, size, timeout)
+#define sys_port_trace_k_pipe_put_claim_blocking(pipe, timeout)                                    \
+	sys_trace_k_pipe_put_claim_blocking(pipe, data, size, timeout)
+#define sys_port_trace_k_pipe_put_claim_exit(pipe, timeout, ret)                                   \
+	sys_trace_k_pipe_put_claim_exit(pipe, data, size, timeout, ret)
+#define sys_port_trace_k_pipe_put_finish_enter(pipe) sys_trace_k_pipe_put_finish_enter(pipe, size)
+#define sys_port_trace_k_pipe_put_finish_exit(pipe, ret)                                           \
+	sys_trace_k_pipe_put_finish_exit(pipe, size, ret)
+#define sys_port_trace_k_pipe_get_claim_enter(pipe, timeout)                                       \
+	sys_trace_k_pipe_get_claim_enter(pipe, data, size, timeout)
+#define sys_port_trace_k_pipe_get_claim_blocking(pipe, timeout)                                    \
+	sys_trace_k_pipe_get_claim_blocking(pipe, data, size, timeout)
+#define sys_port_trace_k_pipe_get_claim_exit(pipe, timeout, ret)                                   \
+	sys_trace_k_pipe_get_claim_exit(pipe, data, size, timeout, ret)
+#define sys_port_trace_k_pipe_get_finish_enter(pipe) sys_trace_k_pipe_get_finish_enter(pipe, size)
+#define sys_port_trace_k_pipe_get_finish_exit(pipe, ret)                                           \
+	sys_trace_k_pipe_get_finish_exit(pipe, size, ret)
 
 #define sys_port_trace_k_heap_init(h) sys_trace_k_heap_init(h, mem, bytes)
 #define sys_port_trace_k_heap_aligned_alloc_enter(h, timeout)                                      \
@@ -630,6 +660,22 @@ void sys_trace_k_pipe_get_blocking(struct k_pipe *pipe, void *data, size_t bytes
 				   size_t *bytes_read, size_t min_xfer, k_timeout_t timeout);
 void sys_trace_k_pipe_get_exit(struct k_pipe *pipe, void *data, size_t bytes_to_read,
 			       size_t *bytes_read, size_t min_xfer, k_timeout_t timeout, int ret);
+void sys_trace_k_pipe_put_claim_enter(struct k_pipe *pipe, void **data, size_t size,
+				      k_timeout_t timeout);
+void sys_trace_k_pipe_put_claim_blocking(struct k_pipe *pipe, void **data, size_t size,
+					 k_timeout_t timeout);
+void sys_trace_k_pipe_put_claim_exit(struct k_pipe *pipe, void **data, size_t size,
+				     k_timeout_t timeout, int ret);
+void sys_trace_k_pipe_put_finish_enter(struct k_pipe *pipe, size_t size);
+void sys_trace_k_pipe_put_finish_exit(struct k_pipe *pipe, size_t size, int ret);
+void sys_trace_k_pipe_get_claim_enter(struct k_pipe *pipe, void **data, size_t size,
+				      k_timeout_t timeout);
+void sys_trace_k_pipe_get_claim_blocking(struct k_pipe *pipe, void **data, size_t size,
+					 k_timeout_t timeout);
+void sys_trace_k_pipe_get_claim_exit(struct k_pipe *pipe, void **data, size_t size,
+				     k_timeout_t timeout, int ret);
+void sys_trace_k_pipe_get_finish_enter(struct k_pipe *pipe, size_t size);
+void sys_trace_k_pipe_get_finish_exit(struct k_pipe *pipe, size_t size, int ret);
 
 void sys_trace_k_msgq_init(struct k_msgq *msgq);
 void sys_trace_k_msgq_alloc_init_enter(struct k_msgq *msgq, size_t msg_size, uint32_t max_msgs);
@@ -643,6 +689,18 @@ void sys_trace_k_msgq_put_exit(struct k_msgq *msgq, const void *data, k_timeout_
 void sys_trace_k_msgq_get_enter(struct k_msgq *msgq, const void *data, k_timeout_t timeout);
 void sys_trace_k_msgq_get_blocking(struct k_msgq *msgq, const void *data, k_timeout_t timeout);
 void sys_trace_k_msgq_get_exit(struct k_msgq *msgq, const void *data, k_timeout_t timeout, int ret);
+void sys_trace_k_msgq_put_n_enter(struct k_msgq *msgq, const void *data, uint32_t num_msgs,
+				  k_timeout_t timeout);
+void sys_trace_k_msgq_put_n_blocking(struct k_msgq *msgq, const void *data, uint32_t num_msgs,
+				     k_timeout_t timeout);
+void sys_trace_k_msgq_put_n_exit(struct k_msgq *msgq, const void *data, uint32_t num_msgs,
+				 k_timeout_t timeout, int ret);
+void sys_trace_k_msgq_get_n_enter(struct k_msgq *msgq, const void *data, uint32_t num_msgs,
+				  k_timeout_t timeout);
+void sys_trace_k_msgq_get_n_blocking(struct k_msgq *msgq, const void *data, uint32_t num_msgs,
+				     k_timeout_t timeout);
+void sys_trace_k_msgq_get_n_exit(struct k_msgq *msgq, const void *data, uint32_t num_msgs,
+				 k_timeout_t timeout, int ret);
 void sys_trace_k_msgq_peek(struct k_msgq *msgq, void *data, int ret);
 void sys_trace_k_msgq_purge(struct k_msgq *msgq);
 
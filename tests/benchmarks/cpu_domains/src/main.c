@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/multi_heap/shared_multi_heap.h>
+#include <string.h>
+
+/* Share of the work of threads, and of the accesses to their memory,
+ * that stays in the threads' home cache domain, with and without
+ * domain hints.
+ */
+
+#define NB_WORKERS	(2 * CONFIG_MP_MAX_NUM_CPUS)
+#define STACK_SIZE	(1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define WORKER_PRIO	K_PRIO_PREEMPT(1)
+#define RUN_TIME	K_MSEC(500)
+#define BUF_SIZE	256
+#define ARENA_SIZE	(NB_WORKERS * BUF_SIZE * 2)
+
+static K_THREAD_STACK_ARRAY_DEFINE(worker_stacks, NB_WORKERS, STACK_SIZE);
+static struct k_thread workers[NB_WORKERS];
+
+static uint8_t domain_arenas[CONFIG_MP_MAX_NUM_CPUS][ARENA_SIZE] __aligned(64);
+static uint8_t fallback_arena[ARENA_SIZE] __aligned(64);
+
+static atomic_t stop;
+
+struct worker_stats {
+	uint32_t iterations;
+	uint32_t home_hits;
+	uint32_t buf_hits;
+};
+
+static struct worker_stats stats[NB_WORKERS];
+
+/* Domain whose arena holds @buf, -1 for the fallback arena */
+static int buf_domain(const uint8_t *buf)
+{
+	for (int d = 0; d < k_cpu_domain_count(); d++) {
+		if ((buf >= domain_arenas[d]) &&
+		    (buf < (domain_arenas[d] + ARENA_SIZE))) {
+			return d;
+		}
+	}
+
+	return -1;
+}
+
+static void worker_entry(void *p1, void *p2, void *p3)
+{
+	int id = POINTER_TO_INT(p1);
+	int home = POINTER_TO_INT(p2);
+	struct worker_stats *ws = &stats[id];
+	volatile uint8_t *buf;
+	int buf_home;
+
+	ARG_UNUSED(p3);
+
+	buf = shared_multi_heap_alloc_local(BUF_SIZE);
+	if (buf == NULL) {
+		printk("worker %d: allocation failed\n", id);
+		return;
+	}
+	buf_home = buf_domain((const uint8_t *)buf);
+
+	while (atomic_get(&stop) == 0) {
+		int domain = k_cpu_domain_current();
+
+		for (int i = 0; i < BUF_SIZE; i++) {
+			buf[i]++;
+		}
+
+		ws->iterations++;
+		ws->home_hits += (domain == home) ? 1 : 0;
+		ws->buf_hits += (domain == buf_home) ? 1 : 0;
+
+		/* Yielding requeues the worker on its current CPU,
+		 * sleeping puts it back through a wakeup.
+		 */
+		if ((ws->iterations % 4U) == 0U) {
+			k_usleep(100);
+		} else {
+			k_yield();
+		}
+	}
+
+	shared_multi_heap_free((void *)buf);
+}
+
+static void run(bool hints)
+{
+	uint32_t iterations = 0U, home_hits = 0U, buf_hits = 0U;
+	int num_domains = k_cpu_domain_count();
+
+	memset(stats, 0, sizeof(stats));
+	atomic_set(&stop, 0);
+
+	for (int i = 0; i < NB_WORKERS; i++) {
+		int home = i % num_domains;
+
+		k_thread_create(&workers[i], worker_stacks[i], STACK_SIZE,
+				worker_entry, INT_TO_POINTER(i),
+				INT_TO_POINTER(home), NULL,
+				WORKER_PRIO, 0, K_FOREVER);
+		k_thread_domain_set(&workers[i],
+				    hints ? home : K_CPU_DOMAIN_ANY);
+	}
+
+	for (int i = 0; i < NB_WORKERS; i++) {
+		k_thread_start(&workers[i]);
+	}
+
+	k_sleep(RUN_TIME);
+	atomic_set(&stop, 1);
+
+	for (int i = 0; i < NB_WORKERS; i++) {
+		k_thread_join(&workers[i], K_FOREVER);
+		iterations += stats[i].iterations;
+		home_hits += stats[i].home_hits;
+		buf_hits += stats[i].buf_hits;
+	}
+
+	if (iterations == 0U) {
+		iterations = 1U;
+	}
+
+	printk("hints %s locality %u%% buffers %u%% iterations %u\n",
+	       hints ? "on" : "off",
+	       (uint32_t)((uint64_t)home_hits * 100U / iterations),
+	       (uint32_t)((uint64_t)buf_hits * 100U / iterations),
+	       iterations);
+}
+
+int main(void)
+{
+	struct shared_multi_heap_region region;
+
+	shared_multi_heap_pool_init();
+
+	for (int d = 0; d < k_cpu_domain_count(); d++) {
+		region.attr = SMH_REG_ATTR_DOMAIN(d);
+		region.addr = (uintptr_t)domain_arenas[d];
+		region.size = ARENA_SIZE;
+		shared_multi_heap_add(&region, NULL);
+	}
+
+	region.attr = SMH_REG_ATTR_CACHEABLE;
+	region.addr = (uintptr_t)fallback_arena;
+	region.size = ARENA_SIZE;
+	shared_multi_heap_add(&region, NULL);
+
+	printk("%d cpus in %d domains, %d workers\n", arch_num_cpus(),
+	       k_cpu_domain_count(), NB_WORKERS);
+
+	/* Main runs above the workers, so they are all queued before
+	 * any of them runs.
+	 */
+	k_thread_priority_set(k_current_get(), K_PRIO_PREEMPT(0));
+
+	run(false);
+	run(true);
+
+	printk("fin\n");
+
+	return 0;
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/mm/demand_paging.h>
+#include <zephyr/sys/printk.h>
+
+/* Page faults taken by a workload with a small hot set and a stream
+ * of cold pages, over a table that does not fit in RAM.
+ */
+
+#define TABLE_PAGES	96
+#define HOT_PAGES	16
+#define COLD_PAGES	(TABLE_PAGES - HOT_PAGES)
+#define HOT_PASSES	4
+#define COLD_WINDOW	4
+#define ROUNDS		200
+
+/* Initialized so that it lands in the paged read-only data */
+static const uint8_t table[TABLE_PAGES][CONFIG_MMU_PAGE_SIZE] = {
+	[0 ... TABLE_PAGES - 1] = { 1 },
+};
+
+static volatile uint32_t sink;
+
+static void run(void)
+{
+	unsigned int cold = 0U;
+	uint32_t sum = 0U;
+
+	for (int r = 0; r < ROUNDS; r++) {
+		for (int p = 0; p < HOT_PASSES; p++) {
+			for (int h = 0; h < HOT_PAGES; h++) {
+				sum += table[h][(r * 64) % CONFIG_MMU_PAGE_SIZE];
+			}
+		}
+
+		for (int c = 0; c < COLD_WINDOW; c++) {
+			sum += table[HOT_PAGES + cold][0];
+			cold = (cold + 1U) % COLD_PAGES;
+		}
+	}
+
+	sink = sum;
+}
+
+int main(void)
+{
+	struct k_mem_paging_stats_t before, after;
+	uint32_t start, cycles;
+	const char *name = IS_ENABLED(CONFIG_EVICTION_CLOCK) ? "clock" :
+			   IS_ENABLED(CONFIG_EVICTION_NRU) ? "nru" : "custom";
+
+	/* Warm up, so that the code and the hot set are paged in */
+	run();
+
+	k_mem_paging_stats_get(&before);
+	start = k_cycle_get_32();
+	run();
+	cycles = k_cycle_get_32() - start;
+	k_mem_paging_stats_get(&after);
+
+	printk("eviction %s faults %lu scanned %lu referenced %lu cycles %u\n",
+	       name, after.pagefaults.cnt - before.pagefaults.cnt,
+	       after.eviction.scanned - before.eviction.scanned,
+	       after.eviction.referenced - before.eviction.referenced,
+	       cycles);
+	printk("cold pages read %u\n", ROUNDS * COLD_WINDOW);
+
+	printk("fin\n");
+
+	return 0;
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* Cost of posting events to event objects with many waiting threads */
+
+#define NB_WAITERS	100
+#define NB_EVENTS	4
+#define WAITERS_PER_EVENT (NB_WAITERS / NB_EVENTS)
+#define MISS_EVENT	BIT(31)
+#define NB_ROUNDS	50
+#define STACK_SIZE	(512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define WAITER_PRIO	K_PRIO_PREEMPT(1)
+
+BUILD_ASSERT(WAITERS_PER_EVENT < 31, "too many waiters per event object");
+
+static K_THREAD_STACK_ARRAY_DEFINE(waiter_stacks, NB_WAITERS, STACK_SIZE);
+static struct k_thread waiters[NB_WAITERS];
+static struct k_event events[NB_EVENTS];
+
+static void waiter_entry(void *p1, void *p2, void *p3)
+{
+	struct k_event *event = p1;
+	uint32_t bit = POINTER_TO_UINT(p2);
+
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_event_wait(event, bit, false, K_FOREVER);
+		k_event_clear(event, bit);
+	}
+}
+
+int main(void)
+{
+	uint64_t wake_cycles = 0;
+	uint64_t miss_cycles = 0;
+	uint32_t start;
+
+	/* Posts never switch to the waiters */
+	k_thread_priority_set(k_current_get(), K_PRIO_COOP(1));
+
+	ARRAY_FOR_EACH(events, i) {
+		k_event_init(&events[i]);
+	}
+
+	for (int i = 0; i < NB_WAITERS; i++) {
+		k_thread_create(&waiters[i], waiter_stacks[i], STACK_SIZE,
+				waiter_entry, &events[i / WAITERS_PER_EVENT],
+				UINT_TO_POINTER(BIT(i % WAITERS_PER_EVENT)), NULL,
+				WAITER_PRIO, 0, K_NO_WAIT);
+	}
+
+	for (int round = 0; round < NB_ROUNDS; round++) {
+		/* Let the woken up waiters wait again */
+		k_msleep(1);
+
+		for (int i = 0; i < NB_WAITERS; i++) {
+			struct k_event *event = &events[i / WAITERS_PER_EVENT];
+
+			start = k_cycle_get_32();
+			k_event_post(event, MISS_EVENT);
+			miss_cycles += k_cycle_get_32() - start;
+			k_event_clear(event, MISS_EVENT);
+
+			start = k_cycle_get_32();
+			k_event_post(event, BIT(i % WAITERS_PER_EVENT));
+			wake_cycles += k_cycle_get_32() - start;
+		}
+	}
+
+	printk("post wake %u cycles\n",
+	       (uint32_t)(wake_cycles / (NB_ROUNDS * NB_WAITERS)));
+	printk("post miss %u cycles\n",
+	       (uint32_t)(miss_cycles / (NB_ROUNDS * NB_WAITERS)));
+
+	printk("fin\n");
+
+	return 0;
+}
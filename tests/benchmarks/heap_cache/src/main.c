@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/sys_heap.h>
+
+/* Multi-threaded heap throughput: every thread runs sys_heap_stress()
+ * against the same heap and the main thread reports the average cost
+ * of one heap operation across all of them.
+ */
+
+#define MAX_THREADS	MAX(CONFIG_MP_MAX_NUM_CPUS, 2)
+#define HEAP_SIZE	(32 * 1024)
+#define OPS_PER_THREAD	20000
+#define STACK_SIZE	(1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+/* sys_heap_stress() wants about half the heap share as scratch */
+#define SCRATCH_SIZE	(HEAP_SIZE / MAX_THREADS / 2)
+
+K_HEAP_DEFINE(bench_heap, HEAP_SIZE);
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, MAX_THREADS, STACK_SIZE);
+static struct k_thread threads[MAX_THREADS];
+static uint8_t scratch[MAX_THREADS][SCRATCH_SIZE] __aligned(sizeof(void *));
+static struct z_heap_stress_result results[MAX_THREADS];
+
+static unsigned int n_threads;
+
+static void *kheap_alloc(void *arg, size_t bytes)
+{
+	return k_heap_alloc(arg, bytes, K_NO_WAIT);
+}
+
+static void kheap_free(void *arg, void *p)
+{
+	k_heap_free(arg, p);
+}
+
+static void stress_thread(void *p1, void *p2, void *p3)
+{
+	unsigned int id = POINTER_TO_UINT(p1);
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	sys_heap_stress(kheap_alloc, kheap_free, &bench_heap,
+			HEAP_SIZE / n_threads, OPS_PER_THREAD,
+			scratch[id], sizeof(scratch[id]), 50, &results[id]);
+}
+
+static void run(unsigned int count)
+{
+	uint32_t start, cycles, ok = 0, allocs = 0;
+
+	/* sys_heap_stress() leaves blocks allocated: start from scratch */
+	k_heap_init(&bench_heap, bench_heap.heap.init_mem,
+		    bench_heap.heap.init_bytes);
+	n_threads = count;
+
+	start = k_cycle_get_32();
+	for (unsigned int i = 0; i < count; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE,
+				stress_thread, UINT_TO_POINTER(i), NULL,
+				NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	}
+	for (unsigned int i = 0; i < count; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+		ok += results[i].successful_allocs;
+		allocs += results[i].total_allocs;
+	}
+	cycles = k_cycle_get_32() - start;
+
+	printk("k_heap threads %u cycles/op %u allocs %u/%u\n", count,
+	       cycles / (count * OPS_PER_THREAD), ok, allocs);
+}
+
+static void print_stats(void)
+{
+	struct sys_memory_stats stats;
+
+	if (sys_heap_runtime_stats_get(&bench_heap.heap, &stats) != 0) {
+		return;
+	}
+
+	printk("k_heap free %zu allocated %zu\n", stats.free_bytes,
+	       stats.allocated_bytes);
+#ifdef CONFIG_SYS_HEAP_CACHE
+	printk("k_heap cache hits %zu misses %zu cached %zu bytes\n",
+	       stats.cache_hits, stats.cache_misses, stats.cached_bytes);
+#endif
+}
+
+int main(void)
+{
+	for (unsigned int count = 1; count <= MAX_THREADS; count++) {
+		run(count);
+	}
+
+	print_stats();
+
+	printk("fin\n");
+
+	return 0;
+}
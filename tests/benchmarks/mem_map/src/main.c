@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/internal/mm.h>
+#include <zephyr/sys/printk.h>
+
+/* Cost of mapping, accessing and unmapping a large physically contiguous
+ * region, and of finding room for small mappings in a fragmented address
+ * space.
+ */
+
+#define LARGE_PHYS	0x0UL
+#define LARGE_SIZE	MB(8)
+#define TOUCH_PASSES	16
+#define FRAG_MAPS	1024
+#define SMALL_MAPS	256
+#define SMALL_SIZE	(2 * CONFIG_MMU_PAGE_SIZE)
+
+static uint8_t small_page[SMALL_SIZE] __aligned(CONFIG_MMU_PAGE_SIZE);
+
+static uint8_t *frag[FRAG_MAPS];
+static uint8_t *small[SMALL_MAPS];
+
+static volatile uint32_t sink;
+
+static void large_map(void)
+{
+	uint32_t start, map_cycles, touch_cycles, unmap_cycles;
+	uint32_t sum = 0U;
+	uint8_t *virt;
+
+	start = k_cycle_get_32();
+	/* Aliases the low RAM, which is only read */
+	z_phys_map(&virt, LARGE_PHYS, LARGE_SIZE, K_MEM_CACHE_WB);
+	map_cycles = k_cycle_get_32() - start;
+
+	start = k_cycle_get_32();
+	for (int p = 0; p < TOUCH_PASSES; p++) {
+		for (size_t off = 0; off < LARGE_SIZE;
+		     off += CONFIG_MMU_PAGE_SIZE) {
+			sum += *(volatile uint32_t *)(virt + off);
+		}
+	}
+	touch_cycles = k_cycle_get_32() - start;
+	sink = sum;
+
+	start = k_cycle_get_32();
+	z_phys_unmap(virt, LARGE_SIZE);
+	unmap_cycles = k_cycle_get_32() - start;
+
+	printk("pages %s map cycles %u touch cycles %u unmap cycles %u\n",
+	       IS_ENABLED(CONFIG_X86_MMU_HUGE_PAGES) ? "2M" : "4K",
+	       map_cycles, touch_cycles, unmap_cycles);
+}
+
+static void small_maps(void)
+{
+	uintptr_t phys = z_mem_phys_addr(small_page);
+	uint32_t start, cycles;
+
+	/* Leave one page holes all over the address space, too small for
+	 * the mappings measured
+	 */
+	for (int i = 0; i < FRAG_MAPS; i++) {
+		z_phys_map(&frag[i], phys, CONFIG_MMU_PAGE_SIZE,
+			   K_MEM_PERM_RW | K_MEM_CACHE_WB);
+	}
+	for (int i = 0; i < FRAG_MAPS; i += 2) {
+		z_phys_unmap(frag[i], CONFIG_MMU_PAGE_SIZE);
+	}
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < SMALL_MAPS; i++) {
+		z_phys_map(&small[i], phys, SMALL_SIZE,
+			   K_MEM_PERM_RW | K_MEM_CACHE_WB);
+	}
+	cycles = k_cycle_get_32() - start;
+
+	for (int i = 0; i < SMALL_MAPS; i++) {
+		z_phys_unmap(small[i], SMALL_SIZE);
+	}
+	for (int i = 1; i < FRAG_MAPS; i += 2) {
+		z_phys_unmap(frag[i], CONFIG_MMU_PAGE_SIZE);
+	}
+
+	printk("allocator %s maps %u cycles %u\n",
+	       IS_ENABLED(CONFIG_KERNEL_VM_TREE) ? "tree" : "bitmap",
+	       SMALL_MAPS, cycles);
+}
+
+int main(void)
+{
+	large_map();
+	small_maps();
+
+	printk("fin\n");
+
+	return 0;
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* Cost per message of filling a message queue with a batch of messages
+ * and draining it again, one message per call against one batch per
+ * call, from a kernel thread and, with userspace, from a user thread.
+ */
+
+#define MSG_SIZE	16
+#define MAX_BATCH	32
+#define ROUNDS		1000
+#define STACK_SIZE	(1024 + MAX_BATCH * MSG_SIZE + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+K_MSGQ_DEFINE(bench_msgq, MSG_SIZE, MAX_BATCH, 4);
+
+static K_THREAD_STACK_DEFINE(bench_stack, STACK_SIZE);
+static struct k_thread bench_thread;
+
+static const uint32_t batches[] = { 1, 8, 32 };
+
+static void single_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t batch = POINTER_TO_UINT(p1);
+	uint8_t msgs[MAX_BATCH][MSG_SIZE];
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (int r = 0; r < ROUNDS; r++) {
+		for (uint32_t i = 0; i < batch; i++) {
+			(void)k_msgq_put(&bench_msgq, msgs[i], K_NO_WAIT);
+		}
+		for (uint32_t i = 0; i < batch; i++) {
+			(void)k_msgq_get(&bench_msgq, msgs[i], K_NO_WAIT);
+		}
+	}
+}
+
+static void batch_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t batch = POINTER_TO_UINT(p1);
+	uint8_t msgs[MAX_BATCH][MSG_SIZE];
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (int r = 0; r < ROUNDS; r++) {
+		(void)k_msgq_put_n(&bench_msgq, msgs, batch, K_NO_WAIT);
+		(void)k_msgq_get_n(&bench_msgq, msgs, batch, K_NO_WAIT);
+	}
+}
+
+/* Cycles per message for ROUNDS rounds of @a batch messages */
+static uint32_t run(k_thread_entry_t entry, uint32_t batch, uint32_t options)
+{
+	uint32_t start, cycles;
+
+	k_thread_create(&bench_thread, bench_stack, STACK_SIZE, entry,
+			UINT_TO_POINTER(batch), NULL, NULL, K_PRIO_PREEMPT(1),
+			options | K_INHERIT_PERMS, K_FOREVER);
+#ifdef CONFIG_USERSPACE
+	k_thread_access_grant(&bench_thread, &bench_msgq);
+#endif /* CONFIG_USERSPACE */
+
+	start = k_cycle_get_32();
+	k_thread_start(&bench_thread);
+	k_thread_join(&bench_thread, K_FOREVER);
+	cycles = k_cycle_get_32() - start;
+
+	return cycles / (ROUNDS * batch * 2U);
+}
+
+static void run_all(const char *mode, uint32_t options)
+{
+	for (int i = 0; i < ARRAY_SIZE(batches); i++) {
+		uint32_t single = run(single_entry, batches[i], options);
+		uint32_t batched = run(batch_entry, batches[i], options);
+
+		printk("%s batch %u single %u batched %u cycles/msg\n", mode,
+		       batches[i], single, batched);
+	}
+}
+
+int main(void)
+{
+	run_all("kernel", 0);
+#ifdef CONFIG_USERSPACE
+	run_all("user", K_USER);
+#endif /* CONFIG_USERSPACE */
+
+	printk("fin\n");
+
+	return 0;
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <string.h>
+
+/* Latency of the handoff of a contended mutex between two CPUs, for
+ * several critical section lengths.
+ */
+
+#define NB_WORKERS	2
+#define STACK_SIZE	(1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define WORKER_PRIO	K_PRIO_PREEMPT(1)
+#define RUN_TIME	K_MSEC(500)
+#define OUTSIDE_LOOPS	50
+
+static const int hold_loops[] = { 10, 100, 1000, 10000 };
+
+static K_THREAD_STACK_ARRAY_DEFINE(worker_stacks, NB_WORKERS, STACK_SIZE);
+static struct k_thread workers[NB_WORKERS];
+static K_MUTEX_DEFINE(bench_mutex);
+
+static volatile uint32_t shared_counter;
+static atomic_t stop;
+static atomic_t ready;
+
+/* Protected by bench_mutex */
+static uint32_t unlock_stamp;
+static int last_owner = -1;
+
+struct worker_stats {
+	uint64_t handoff_cycles;
+	uint32_t handoffs;
+	uint32_t locks;
+};
+
+static struct worker_stats stats[NB_WORKERS];
+
+static void worker_entry(void *p1, void *p2, void *p3)
+{
+	int id = POINTER_TO_INT(p1);
+	int hold = POINTER_TO_INT(p2);
+	struct worker_stats *ws = &stats[id];
+
+	ARG_UNUSED(p3);
+
+	atomic_inc(&ready);
+	while (atomic_get(&ready) != NB_WORKERS) {
+		arch_spin_relax();
+	}
+
+	while (atomic_get(&stop) == 0) {
+		k_mutex_lock(&bench_mutex, K_FOREVER);
+
+		if ((last_owner >= 0) && (last_owner != id)) {
+			ws->handoff_cycles += k_cycle_get_32() - unlock_stamp;
+			ws->handoffs++;
+		}
+		last_owner = id;
+		ws->locks++;
+
+		for (int i = 0; i < hold; i++) {
+			shared_counter++;
+		}
+
+		unlock_stamp = k_cycle_get_32();
+		k_mutex_unlock(&bench_mutex);
+
+		/* Let the other thread take the mutex */
+		for (int i = 0; i < OUTSIDE_LOOPS; i++) {
+			shared_counter++;
+		}
+	}
+}
+
+static void run(int hold)
+{
+	uint64_t handoff_cycles = 0;
+	uint32_t handoffs = 0;
+	uint32_t locks = 0;
+
+	memset(stats, 0, sizeof(stats));
+	last_owner = -1;
+	atomic_set(&stop, 0);
+	atomic_set(&ready, 0);
+
+	for (int i = 0; i < NB_WORKERS; i++) {
+		k_thread_create(&workers[i], worker_stacks[i], STACK_SIZE,
+				worker_entry, INT_TO_POINTER(i), INT_TO_POINTER(hold),
+				NULL, WORKER_PRIO, 0, K_FOREVER);
+		k_thread_cpu_pin(&workers[i], i);
+	}
+	for (int i = 0; i < NB_WORKERS; i++) {
+		k_thread_start(&workers[i]);
+	}
+
+	k_sleep(RUN_TIME);
+	atomic_set(&stop, 1);
+
+	for (int i = 0; i < NB_WORKERS; i++) {
+		k_thread_join(&workers[i], K_FOREVER);
+
+		handoff_cycles += stats[i].handoff_cycles;
+		handoffs += stats[i].handoffs;
+		locks += stats[i].locks;
+	}
+
+	printk("hold %d handoff %u cycles (%u handoffs, %u locks)\n", hold,
+	       (uint32_t)(handoff_cycles / MAX(handoffs, 1U)), handoffs, locks);
+}
+
+int main(void)
+{
+	ARRAY_FOR_EACH(hold_loops, i) {
+		run(hold_loops[i]);
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
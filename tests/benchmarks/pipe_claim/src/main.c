@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* Throughput of a producer and a consumer thread streaming data through a
+ * pipe, copying in and out with k_pipe_put() and k_pipe_get() against
+ * claiming the pipe buffer directly.
+ */
+
+#define PIPE_SIZE	8192
+#define MAX_CHUNK	4096
+#define STREAM_BYTES	(256 * 1024)
+#define STACK_SIZE	(1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define BENCH_PRIO	K_PRIO_PREEMPT(1)
+
+K_PIPE_DEFINE(bench_pipe, PIPE_SIZE, 4);
+
+static K_THREAD_STACK_DEFINE(producer_stack, STACK_SIZE);
+static K_THREAD_STACK_DEFINE(consumer_stack, STACK_SIZE);
+static struct k_thread producer_thread;
+static struct k_thread consumer_thread;
+
+static uint8_t src_buf[MAX_CHUNK];
+static uint8_t dst_buf[MAX_CHUNK];
+static volatile uint32_t checksum;
+
+static const size_t chunks[] = { 64, 256, 1024, 4096 };
+
+static uint32_t consume(const uint8_t *data, size_t len)
+{
+	uint32_t sum = 0;
+
+	for (size_t i = 0; i < len; i += 64) {
+		sum += data[i];
+	}
+
+	return sum;
+}
+
+static void copy_producer(void *p1, void *p2, void *p3)
+{
+	size_t chunk = POINTER_TO_UINT(p1);
+	size_t written;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (size_t sent = 0; sent < STREAM_BYTES; sent += chunk) {
+		(void)k_pipe_put(&bench_pipe, src_buf, chunk, &written, chunk,
+				 K_FOREVER);
+	}
+}
+
+static void copy_consumer(void *p1, void *p2, void *p3)
+{
+	size_t chunk = POINTER_TO_UINT(p1);
+	size_t read;
+	uint32_t sum = 0;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (size_t received = 0; received < STREAM_BYTES; received += chunk) {
+		(void)k_pipe_get(&bench_pipe, dst_buf, chunk, &read, chunk,
+				 K_FOREVER);
+		sum += consume(dst_buf, chunk);
+	}
+
+	checksum = sum;
+}
+
+static void claim_producer(void *p1, void *p2, void *p3)
+{
+	size_t chunk = POINTER_TO_UINT(p1);
+	void *data;
+	int len;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (size_t sent = 0; sent < STREAM_BYTES; sent += chunk) {
+		/* A claim stops at the end of the buffer */
+		for (size_t done = 0; done < chunk; done += len) {
+			len = k_pipe_put_claim(&bench_pipe, &data, chunk - done,
+					       K_FOREVER);
+			memcpy(data, &src_buf[done], len);
+			(void)k_pipe_put_finish(&bench_pipe, len);
+		}
+	}
+}
+
+static void claim_consumer(void *p1, void *p2, void *p3)
+{
+	size_t chunk = POINTER_TO_UINT(p1);
+	void *data;
+	uint32_t sum = 0;
+	int len;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (size_t received = 0; received < STREAM_BYTES; received += len) {
+		len = k_pipe_get_claim(&bench_pipe, &data, chunk, K_FOREVER);
+		sum += consume(data, len);
+		(void)k_pipe_get_finish(&bench_pipe, len);
+	}
+
+	checksum = sum;
+}
+
+/* KiB per second streamed in chunks of @a chunk bytes */
+static uint32_t run(k_thread_entry_t producer, k_thread_entry_t consumer,
+		    size_t chunk)
+{
+	uint32_t start, cycles;
+
+	k_pipe_flush(&bench_pipe);
+
+	k_thread_create(&consumer_thread, consumer_stack, STACK_SIZE, consumer,
+			UINT_TO_POINTER(chunk), NULL, NULL, BENCH_PRIO, 0,
+			K_FOREVER);
+	k_thread_create(&producer_thread, producer_stack, STACK_SIZE, producer,
+			UINT_TO_POINTER(chunk), NULL, NULL, BENCH_PRIO, 0,
+			K_FOREVER);
+
+	start = k_cycle_get_32();
+	k_thread_start(&consumer_thread);
+	k_thread_start(&producer_thread);
+	k_thread_join(&producer_thread, K_FOREVER);
+	k_thread_join(&consumer_thread, K_FOREVER);
+	cycles = MAX(k_cycle_get_32() - start, 1U);
+
+	return (uint32_t)(((uint64_t)(STREAM_BYTES / 1024) *
+			   sys_clock_hw_cycles_per_sec()) / cycles);
+}
+
+int main(void)
+{
+	for (size_t i = 0; i < sizeof(src_buf); i++) {
+		src_buf[i] = (uint8_t)i;
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(chunks); i++) {
+		uint32_t copy = run(copy_producer, copy_consumer, chunks[i]);
+		uint32_t claim = run(claim_producer, claim_consumer, chunks[i]);
+
+		printk("chunk %u copy %u claim %u KiB/s\n", (uint32_t)chunks[i],
+		       copy, claim);
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* Round trip cost of waking a server thread that waits on many
+ * semaphores with k_poll() against waiting on them with a poll set.
+ */
+
+#define MAX_EVENTS	256
+#define ROUNDS		1000
+#define STACK_SIZE	(1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define SERVER_PRIO	K_PRIO_PREEMPT(0)
+
+static struct k_sem sems[MAX_EVENTS];
+static struct k_poll_event events[MAX_EVENTS];
+static struct k_poll_set_entry set_entries[MAX_EVENTS];
+static struct k_poll_set set;
+
+static K_THREAD_STACK_DEFINE(server_stack, STACK_SIZE);
+static struct k_thread server_thread;
+
+static const int num_events[] = { 8, 64, 256 };
+
+static void poll_server(void *p1, void *p2, void *p3)
+{
+	int n = POINTER_TO_INT(p1);
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (int i = 0; i < n; i++) {
+		k_poll_event_init(&events[i], K_POLL_TYPE_SEM_AVAILABLE,
+				  K_POLL_MODE_NOTIFY_ONLY, &sems[i]);
+	}
+
+	for (int r = 0; r < ROUNDS; r++) {
+		(void)k_poll(events, n, K_FOREVER);
+		for (int i = 0; i < n; i++) {
+			if (events[i].state != K_POLL_STATE_NOT_READY) {
+				events[i].state = K_POLL_STATE_NOT_READY;
+				(void)k_sem_take(&sems[i], K_NO_WAIT);
+			}
+		}
+	}
+}
+
+static void set_server(void *p1, void *p2, void *p3)
+{
+	int n = POINTER_TO_INT(p1);
+	struct k_poll_event ready[4];
+	int count;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_poll_set_init(&set, set_entries, n);
+	for (int i = 0; i < n; i++) {
+		(void)k_poll_set_add(&set, K_POLL_TYPE_SEM_AVAILABLE, &sems[i],
+				     0, 0);
+	}
+
+	for (int r = 0; r < ROUNDS; r++) {
+		count = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+					K_FOREVER);
+		for (int i = 0; i < count; i++) {
+			(void)k_sem_take(ready[i].sem, K_NO_WAIT);
+		}
+	}
+
+	for (int i = 0; i < n; i++) {
+		(void)k_poll_set_remove(&set, K_POLL_TYPE_SEM_AVAILABLE,
+					&sems[i]);
+	}
+}
+
+/* Cycles per wakeup of a server waiting on @a n semaphores */
+static uint32_t run(k_thread_entry_t server, int n)
+{
+	uint32_t start, cycles;
+
+	k_thread_create(&server_thread, server_stack, STACK_SIZE, server,
+			INT_TO_POINTER(n), NULL, NULL, SERVER_PRIO, 0,
+			K_NO_WAIT);
+
+	/* let the server register its events and block */
+	k_yield();
+
+	start = k_cycle_get_32();
+	for (int r = 0; r < ROUNDS; r++) {
+		k_sem_give(&sems[(r * 7) % n]);
+	}
+	cycles = k_cycle_get_32() - start;
+
+	k_thread_join(&server_thread, K_FOREVER);
+
+	return cycles / ROUNDS;
+}
+
+int main(void)
+{
+	for (int i = 0; i < MAX_EVENTS; i++) {
+		k_sem_init(&sems[i], 0, 1);
+	}
+
+	/* Run below the server so that each give wakes it up right away */
+	k_thread_priority_set(k_current_get(), K_PRIO_PREEMPT(1));
+
+	for (int i = 0; i < ARRAY_SIZE(num_events); i++) {
+		uint32_t poll = run(poll_server, num_events[i]);
+		uint32_t set_cycles = run(set_server, num_events[i]);
+
+		printk("events %d k_poll %u poll set %u cycles/wakeup\n",
+		       num_events[i], poll, set_cycles);
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
@@ -51,6 +51,10 @@ uint32_t stamps[NUM_STAMP_STATES];
 
 static struct k_spinlock lock;
 
+#ifdef CONFIG_SMP
+void smp_throughput_run(void);
+#endif /* CONFIG_SMP */
+
 static inline int _stamp(int state)
 {
 	uint32_t t;
@@ -150,6 +154,11 @@ int main(void)
 		       stamps[4] - stamps[3],
 		       whole, avg);
 	}
+
+#ifdef CONFIG_SMP
+	smp_throughput_run();
+#endif /* CONFIG_SMP */
+
 	printk("fin\n");
 	return 0;
 }
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* SMP scalability companion to the latency benchmark in main.c.  For
+ * every N from 1 to the number of CPUs, N independent pairs of threads
+ * ping-pong over a pair of semaphores for a fixed window, so each
+ * round trip costs two wakeups and two context switches.  With a
+ * perfectly scalable scheduler the aggregate number of switches per
+ * second grows linearly with N, contention on the scheduler lock and
+ * run queue(s) shows up as the curve flattening.
+ */
+
+#define WINDOW_MS  500
+#define STACK_SIZE 1024
+
+struct pair {
+	struct k_sem ping;
+	struct k_sem pong;
+	struct k_thread threads[2];
+	volatile uint32_t round_trips;
+};
+
+static struct pair pairs[CONFIG_MP_MAX_NUM_CPUS];
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, 2 * CONFIG_MP_MAX_NUM_CPUS,
+				   STACK_SIZE);
+
+static void pinger(void *p1, void *p2, void *p3)
+{
+	struct pair *pair = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_give(&pair->ping);
+		k_sem_take(&pair->pong, K_FOREVER);
+		pair->round_trips++;
+	}
+}
+
+static void ponger(void *p1, void *p2, void *p3)
+{
+	struct pair *pair = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&pair->ping, K_FOREVER);
+		k_sem_give(&pair->pong);
+	}
+}
+
+static uint32_t run_pairs(int n_pairs, int prio)
+{
+	uint32_t total = 0;
+
+	for (int i = 0; i < n_pairs; i++) {
+		struct pair *pair = &pairs[i];
+
+		k_sem_init(&pair->ping, 0, 1);
+		k_sem_init(&pair->pong, 0, 1);
+		pair->round_trips = 0;
+
+		k_thread_create(&pair->threads[0], stacks[2 * i], STACK_SIZE,
+				pinger, pair, NULL, NULL, prio, 0, K_NO_WAIT);
+		k_thread_create(&pair->threads[1], stacks[2 * i + 1],
+				STACK_SIZE, ponger, pair, NULL, NULL, prio, 0,
+				K_NO_WAIT);
+	}
+
+	k_sleep(K_MSEC(WINDOW_MS));
+
+	for (int i = 0; i < n_pairs; i++) {
+		k_thread_abort(&pairs[i].threads[0]);
+		k_thread_abort(&pairs[i].threads[1]);
+		total += pairs[i].round_trips;
+	}
+
+	return total;
+}
+
+void smp_throughput_run(void)
+{
+	/* Workers run below main so the end of each window preempts them */
+	int prio = k_thread_priority_get(k_current_get()) + 1;
+	unsigned int num_cpus = arch_num_cpus();
+
+	printk("SMP context switch throughput (%s run queues)\n",
+	       IS_ENABLED(CONFIG_SCHED_PER_CPU_RUNQ) ? "per-CPU" : "global");
+
+	for (unsigned int n = 1; n <= num_cpus; n++) {
+		uint32_t round_trips = run_pairs(n, prio);
+		uint32_t per_sec = round_trips * (MSEC_PER_SEC / WINDOW_MS);
+
+		/* Two context switches per round trip */
+		printk("cpus %u pairs %u switches/s %u\n", n, n, 2 * per_sec);
+	}
+}
@@ -6,6 +6,7 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/sys/printk.h>
+#include <zephyr/sys/syscall_batch.h>
 
 /* private kernel APIs */
 #include <wait_q.h>
@@ -117,6 +118,70 @@ static int exec_test(uint8_t nb_threads)
 }
 
 
+K_SEM_DEFINE(bench_sem, 0, K_SEM_MAX_LIMIT);
+K_APPMEM_PARTITION_DEFINE(batch_partition);
+K_APP_BMEM(batch_partition) struct k_syscall_batch_entry batch_entries[MAX_BATCH_LEN];
+
+static int batcher_status;
+
+void batcher_entry(void *_thread, void *_batch_len, void *p3)
+{
+	struct k_app_thread *thread = (struct k_app_thread *) _thread;
+	int ret;
+
+	struct k_mem_partition *parts[] = {
+		thread->partition,
+		&batch_partition,
+	};
+
+	ret = k_mem_domain_init(&thread->domain, ARRAY_SIZE(parts), parts);
+	if (ret != 0) {
+		printk("k_mem_domain_init failed %d\n", ret);
+		batcher_status = 1;
+		return;
+	}
+
+	k_mem_domain_add_thread(&thread->domain, k_current_get());
+
+	if ((uintptr_t)_batch_len == 1) {
+		k_thread_user_mode_enter(syscall_single, &bench_sem, NULL, NULL);
+	} else {
+		k_thread_user_mode_enter(syscall_batched, &bench_sem, batch_entries,
+					 _batch_len);
+	}
+}
+
+static int exec_batch_test(uint32_t batch_len)
+{
+	k_tid_t tid;
+
+	batcher_status = 0;
+	k_sem_reset(&bench_sem);
+
+	app_threads[0].partition = app_partitions[0];
+	app_threads[0].stack = &app_thread_stacks[0];
+
+	tid = k_thread_create(&app_threads[0].thread, app_thread_stacks[0],
+			      APP_STACKSIZE, batcher_entry, &app_threads[0],
+			      (void *)(uintptr_t)batch_len, NULL, THREADS_PRIO, 0,
+			      K_FOREVER);
+	k_object_access_grant(&bench_sem, tid);
+
+	stamp(MEAS_START);
+	k_thread_start(tid);
+	k_thread_join(tid, K_FOREVER);
+	stamp(MEAS_END);
+
+	uint32_t full_time = stamps[MEAS_END] - stamps[MEAS_START];
+	uint64_t time_ns = k_cyc_to_ns_near64(full_time)/NB_SYSCALLS;
+
+	printk("Batching %2u syscalls: %8" PRIu32 " cyc & %6" PRIu32 " calls -> %6"
+				PRIu64 " ns per call\n", batch_len, full_time,
+				NB_SYSCALLS, time_ns);
+
+	return batcher_status;
+}
+
 int main(void)
 {
 	int ret;
@@ -136,6 +201,19 @@ int main(void)
 		}
 	}
 
+	uint32_t batch_len_list[] = {1, 4, 16, MAX_BATCH_LEN, 0};
+
+	printk("============================\n");
+	printk("user k_sem_give, one trap per batch\n");
+
+	for (size_t i = 0; batch_len_list[i] > 0; i++) {
+		ret = exec_batch_test(batch_len_list[i]);
+		if (ret != 0) {
+			printk("FAIL\n");
+			return 0;
+		}
+	}
+
 	printk("SUCCESS\n");
 	return 0;
 }
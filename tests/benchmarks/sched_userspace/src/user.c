@@ -7,6 +7,7 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <zephyr/kernel.h>
+#include <zephyr/sys/syscall_batch.h>
 
 #include "user.h"
 
@@ -19,3 +20,29 @@ void context_switch_yield(void *p1, void *p2, void *p3)
 		k_yield();
 	}
 }
+
+void syscall_single(void *p1, void *p2, void *p3)
+{
+	struct k_sem *sem = p1;
+
+	for (uint32_t i = 0; i < NB_SYSCALLS; i++) {
+		k_sem_give(sem);
+	}
+}
+
+void syscall_batched(void *p1, void *p2, void *p3)
+{
+	struct k_sem *sem = p1;
+	struct k_syscall_batch_entry *entries = p2;
+	uint32_t batch_len = (uint32_t)(uintptr_t) p3;
+	struct k_syscall_batch batch;
+
+	k_syscall_batch_init(&batch, entries, batch_len);
+
+	for (uint32_t i = 0; i < NB_SYSCALLS; i += batch_len) {
+		for (uint32_t j = 0; j < batch_len; j++) {
+			(void)k_syscall_batch_sem_give(&batch, sem);
+		}
+		(void)k_syscall_batch_flush(&batch);
+	}
+}
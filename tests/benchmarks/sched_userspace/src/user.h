@@ -5,5 +5,9 @@
  */
 
 #define NB_YIELDS UINT32_C(1000000)
+#define NB_SYSCALLS UINT32_C(65536)
+#define MAX_BATCH_LEN 64
 
 void context_switch_yield(void *p1, void *p2, void *p3);
+void syscall_single(void *p1, void *p2, void *p3);
+void syscall_batched(void *p1, void *p2, void *p3);
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <string.h>
+
+/* Spinlock acquisition latency and fairness as the number of contending
+ * CPUs grows.
+ */
+
+#define MAX_CPUS	CONFIG_MP_MAX_NUM_CPUS
+#define STACK_SIZE	(1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define WORKER_PRIO	K_PRIO_PREEMPT(1)
+#define RUN_TIME	K_MSEC(500)
+#define HOLD_LOOPS	100
+
+static K_THREAD_STACK_ARRAY_DEFINE(worker_stacks, MAX_CPUS, STACK_SIZE);
+static struct k_thread workers[MAX_CPUS];
+
+static struct k_spinlock bench_lock;
+static volatile uint32_t shared_counter;
+static atomic_t stop;
+static atomic_t ready;
+
+struct worker_stats {
+	uint64_t lock_cycles;
+	uint32_t acquisitions;
+};
+
+static struct worker_stats stats[MAX_CPUS];
+
+static void worker_entry(void *p1, void *p2, void *p3)
+{
+	struct worker_stats *ws = p1;
+	int nb_cpus = POINTER_TO_INT(p2);
+
+	ARG_UNUSED(p3);
+
+	/* Start contending together */
+	atomic_inc(&ready);
+	while (atomic_get(&ready) != nb_cpus) {
+		arch_spin_relax();
+	}
+
+	while (atomic_get(&stop) == 0) {
+		uint32_t start = k_cycle_get_32();
+		k_spinlock_key_t key = k_spin_lock(&bench_lock);
+
+		ws->lock_cycles += k_cycle_get_32() - start;
+		ws->acquisitions++;
+
+		for (int i = 0; i < HOLD_LOOPS; i++) {
+			shared_counter++;
+		}
+
+		k_spin_unlock(&bench_lock, key);
+	}
+}
+
+static void run(int nb_cpus)
+{
+	uint64_t lock_cycles = 0;
+	uint32_t acquisitions = 0;
+	uint32_t min = UINT32_MAX;
+	uint32_t max = 0;
+
+	memset(stats, 0, sizeof(stats));
+	atomic_set(&stop, 0);
+	atomic_set(&ready, 0);
+
+	for (int cpu = 0; cpu < nb_cpus; cpu++) {
+		k_thread_create(&workers[cpu], worker_stacks[cpu], STACK_SIZE,
+				worker_entry, &stats[cpu], INT_TO_POINTER(nb_cpus),
+				NULL, WORKER_PRIO, 0, K_FOREVER);
+		k_thread_cpu_pin(&workers[cpu], cpu);
+	}
+	for (int cpu = 0; cpu < nb_cpus; cpu++) {
+		k_thread_start(&workers[cpu]);
+	}
+
+	/* The workers are preemptible: the main thread gets back its CPU
+	 * when the sleep expires
+	 */
+	k_sleep(RUN_TIME);
+	atomic_set(&stop, 1);
+
+	for (int cpu = 0; cpu < nb_cpus; cpu++) {
+		k_thread_join(&workers[cpu], K_FOREVER);
+
+		lock_cycles += stats[cpu].lock_cycles;
+		acquisitions += stats[cpu].acquisitions;
+		min = MIN(min, stats[cpu].acquisitions);
+		max = MAX(max, stats[cpu].acquisitions);
+	}
+
+	printk("cpus %d lock %u cycles fairness %u%% (%u acquisitions)\n",
+	       nb_cpus, (uint32_t)(lock_cycles / MAX(acquisitions, 1U)),
+	       (uint32_t)(((uint64_t)min * 100U) / MAX(max, 1U)), acquisitions);
+}
+
+int main(void)
+{
+	for (int n = 1; n <= arch_num_cpus(); n++) {
+		run(n);
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
@@ -14,6 +14,9 @@ struct k_fifo fifo2;
 
 static struct k_fifo sync_fifo; /* for synchronization */
 
+/* elements for the burst test, one per loop */
+static intptr_t burst[NUMBER_OF_LOOPS][2];
+
 
 /**
  *
@@ -251,5 +254,34 @@ int fifo_test(void)
 		k_fifo_put(&sync_fifo, element);
 	}
 
+	/* test put throughput with no waiting thread, then drain */
+	fprintf(output_file, sz_test_case_fmt,
+			"FIFO #4");
+	fprintf(output_file, sz_description,
+			"\n\tk_fifo_init"
+			"\n\tk_fifo_put (no waiter)"
+			"\n\tk_fifo_get(K_NO_WAIT)");
+	printf(sz_test_start_fmt);
+
+	fifo_test_init();
+
+	t = BENCH_START();
+
+	for (i = 0; i < number_of_loops; i++) {
+		burst[i][1] = i;
+		k_fifo_put(&fifo1, burst[i]);
+	}
+	for (i = 0; i < number_of_loops; i++) {
+		intptr_t *pelement = k_fifo_get(&fifo1, K_NO_WAIT);
+
+		if ((pelement == NULL) || (pelement[1] != i)) {
+			break;
+		}
+	}
+
+	t = TIME_STAMP_DELTA_GET(t);
+
+	return_value += check_result(i, t);
+
 	return return_value;
 }
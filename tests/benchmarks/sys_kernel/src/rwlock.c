@@ -0,0 +1,244 @@
+/* rwlock.c */
+
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+
+#include "syskernel.h"
+
+#define TABLE_SIZE 16
+
+static struct k_spinlock spinlock;
+static struct k_rwspinlock rwspinlock;
+static struct k_seqlock seqlock;
+
+/* Read-mostly data protected by the lock under test */
+static volatile uint32_t table[TABLE_SIZE];
+
+enum lock_kind {
+	LOCK_SPIN,
+	LOCK_RWSPIN,
+	LOCK_SEQ,
+	NUM_LOCK_KINDS
+};
+
+/**
+ *
+ * @brief Read the whole table under the given lock
+ *
+ * @return Sum of the table entries
+ */
+static uint32_t table_read(enum lock_kind kind)
+{
+	k_spinlock_key_t key;
+	uint32_t sum, seq;
+
+	switch (kind) {
+	case LOCK_SPIN:
+		key = k_spin_lock(&spinlock);
+		sum = 0;
+		for (int i = 0; i < TABLE_SIZE; i++) {
+			sum += table[i];
+		}
+		k_spin_unlock(&spinlock, key);
+		break;
+	case LOCK_RWSPIN:
+		key = k_rwspin_read_lock(&rwspinlock);
+		sum = 0;
+		for (int i = 0; i < TABLE_SIZE; i++) {
+			sum += table[i];
+		}
+		k_rwspin_read_unlock(&rwspinlock, key);
+		break;
+	default:
+		do {
+			seq = k_seqlock_read_begin(&seqlock);
+			sum = 0;
+			for (int i = 0; i < TABLE_SIZE; i++) {
+				sum += table[i];
+			}
+		} while (k_seqlock_read_retry(&seqlock, seq));
+		break;
+	}
+
+	return sum;
+}
+
+static int table_read_test(enum lock_kind kind, int no_of_loops)
+{
+	int i;
+
+	for (i = 0; i < no_of_loops; i++) {
+		if (table_read(kind) != 0) {
+			return i;
+		}
+	}
+
+	return i;
+}
+
+static int table_write_test(int no_of_loops)
+{
+	int i;
+
+	for (i = 0; i < no_of_loops; i++) {
+		k_spinlock_key_t key = k_rwspin_write_lock(&rwspinlock);
+
+		table[i % TABLE_SIZE] = 0;
+		k_rwspin_write_unlock(&rwspinlock, key);
+	}
+
+	return i;
+}
+
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_CPU_MASK)
+
+#define SCALING_LOOPS 10000
+
+static K_THREAD_STACK_ARRAY_DEFINE(reader_stacks, CONFIG_MP_MAX_NUM_CPUS,
+				   STACK_SIZE);
+static struct k_thread readers[CONFIG_MP_MAX_NUM_CPUS];
+static atomic_t readers_ready;
+
+/**
+ *
+ * @brief Reader thread, pinned to its own CPU
+ *
+ * @param par1   Lock kind.
+ * @param par2   Number of reader threads.
+ * @param par3   Unused
+ *
+ */
+static void reader_thread(void *par1, void *par2, void *par3)
+{
+	enum lock_kind kind = POINTER_TO_INT(par1);
+	int nb_readers = POINTER_TO_INT(par2);
+
+	ARG_UNUSED(par3);
+
+	/* Start reading together */
+	atomic_inc(&readers_ready);
+	while (atomic_get(&readers_ready) != nb_readers) {
+		arch_spin_relax();
+	}
+
+	(void)table_read_test(kind, SCALING_LOOPS);
+}
+
+/**
+ *
+ * @brief Measure the aggregate read throughput of nb_readers CPUs
+ *
+ * @return Reads per millisecond
+ */
+static uint32_t reader_scaling(enum lock_kind kind, int nb_readers)
+{
+	uint32_t start, cycles;
+
+	atomic_set(&readers_ready, 0);
+
+	for (int cpu = 0; cpu < nb_readers; cpu++) {
+		k_thread_create(&readers[cpu], reader_stacks[cpu], STACK_SIZE,
+				reader_thread, INT_TO_POINTER(kind),
+				INT_TO_POINTER(nb_readers), NULL,
+				K_PRIO_COOP(3), 0, K_FOREVER);
+		k_thread_cpu_pin(&readers[cpu], cpu);
+	}
+
+	/* Keep our CPU until all readers are started: they wait for each
+	 * other before reading
+	 */
+	k_sched_lock();
+	start = k_cycle_get_32();
+	for (int cpu = 0; cpu < nb_readers; cpu++) {
+		k_thread_start(&readers[cpu]);
+	}
+	k_sched_unlock();
+	for (int cpu = 0; cpu < nb_readers; cpu++) {
+		k_thread_join(&readers[cpu], K_FOREVER);
+	}
+	cycles = MAX(k_cycle_get_32() - start, 1U);
+
+	return (uint32_t)(((uint64_t)SCALING_LOOPS * nb_readers *
+			   sys_clock_hw_cycles_per_sec()) / (cycles * 1000ULL));
+}
+
+static void rwlock_scaling_test(void)
+{
+	fprintf(output_file, sz_test_case_fmt,
+			"Reader scaling");
+	fprintf(output_file, sz_description,
+			"\n\tk_spin_lock"
+			"\n\tk_rwspin_read_lock"
+			"\n\tk_seqlock_read_begin");
+
+	for (int n = 1; n <= arch_num_cpus(); n++) {
+		uint32_t spin = reader_scaling(LOCK_SPIN, n);
+		uint32_t rwspin = reader_scaling(LOCK_RWSPIN, n);
+		uint32_t seq = reader_scaling(LOCK_SEQ, n);
+
+		fprintf(output_file,
+			"\nreaders %d: spinlock %u rwspinlock %u seqlock %u reads/ms",
+			n, spin, rwspin, seq);
+	}
+
+	fprintf(output_file, sz_case_end_fmt);
+}
+
+#endif /* CONFIG_SMP && CONFIG_SCHED_CPU_MASK */
+
+/**
+ *
+ * @brief The main test entry
+ *
+ * @return number of successful test cases
+ */
+int rwlock_test(void)
+{
+	static const char *const read_cases[NUM_LOCK_KINDS][2] = {
+		[LOCK_SPIN] = { "Spinlock #1", "\n\tk_spin_lock\n\tk_spin_unlock" },
+		[LOCK_RWSPIN] = { "RW spinlock #1",
+				  "\n\tk_rwspin_read_lock\n\tk_rwspin_read_unlock" },
+		[LOCK_SEQ] = { "Seqlock #1",
+			       "\n\tk_seqlock_read_begin\n\tk_seqlock_read_retry" },
+	};
+	uint32_t t;
+	int i;
+	int return_value = 0;
+
+	for (int kind = 0; kind < NUM_LOCK_KINDS; kind++) {
+		fprintf(output_file, sz_test_case_fmt, read_cases[kind][0]);
+		fprintf(output_file, sz_description, read_cases[kind][1]);
+		printf(sz_test_start_fmt);
+
+		t = BENCH_START();
+		i = table_read_test(kind, number_of_loops);
+		t = TIME_STAMP_DELTA_GET(t);
+
+		return_value += check_result(i, t);
+	}
+
+	fprintf(output_file, sz_test_case_fmt,
+		"RW spinlock #2");
+	fprintf(output_file, sz_description,
+		"\n\tk_rwspin_write_lock"
+		"\n\tk_rwspin_write_unlock");
+	printf(sz_test_start_fmt);
+
+	t = BENCH_START();
+	i = table_write_test(number_of_loops);
+	t = TIME_STAMP_DELTA_GET(t);
+
+	return_value += check_result(i, t);
+
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_CPU_MASK)
+	rwlock_scaling_test();
+#endif /* CONFIG_SMP && CONFIG_SCHED_CPU_MASK */
+
+	return return_value;
+}
@@ -162,10 +162,11 @@ int main(void)
 		test_result += fifo_test();
 		test_result += stack_test();
 		test_result += mem_slab_test();
+		test_result += rwlock_test();
 
 		if (test_result) {
-			/* sema/lifo/fifo/stack/mem_slab account for 14 tests in total */
-			if (test_result == 14) {
+			/* sema/lifo/fifo/stack/mem_slab/rwlock account for 19 tests in total */
+			if (test_result == 19) {
 				fprintf(output_file, sz_module_result_fmt,
 					sz_success);
 			} else {
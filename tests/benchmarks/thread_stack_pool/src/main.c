@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* Rate of thread create/join cycles for each source of thread stacks */
+
+#define NB_CYCLES	2000
+#define NB_IDLERS	8
+#define IDLER_STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define WORKER_PRIO	K_PRIO_PREEMPT(1)
+#define WORKER_LOAD	128
+
+#define SMALL_SIZE	CONFIG_DYNAMIC_THREAD_SMALL_STACK_SIZE
+#define POOL_SIZE	CONFIG_DYNAMIC_THREAD_STACK_SIZE
+#define HEAP_SIZE	(2 * CONFIG_DYNAMIC_THREAD_STACK_SIZE)
+
+static K_THREAD_STACK_DEFINE(static_stack, POOL_SIZE);
+static K_THREAD_STACK_ARRAY_DEFINE(idler_stacks, NB_IDLERS, IDLER_STACK_SIZE);
+static struct k_thread idlers[NB_IDLERS];
+static struct k_thread worker;
+static K_SEM_DEFINE(idle_sem, 0, NB_IDLERS);
+
+static volatile uint32_t result;
+
+static void idler_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_sem_take(&idle_sem, K_FOREVER);
+}
+
+static void worker_entry(void *p1, void *p2, void *p3)
+{
+	volatile uint8_t load[WORKER_LOAD];
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	/* Use a bit of stack, as a real thread would */
+	for (int i = 0; i < WORKER_LOAD; i++) {
+		load[i] = (uint8_t)i;
+	}
+	result = load[POINTER_TO_UINT(p1) % WORKER_LOAD];
+}
+
+static void run(const char *name, size_t size, bool dynamic)
+{
+	uint64_t cycles = 0;
+	k_thread_stack_t *stack = static_stack;
+
+	for (int i = 0; i < NB_CYCLES; i++) {
+		uint32_t start = k_cycle_get_32();
+
+		if (dynamic) {
+			stack = k_thread_stack_alloc(size, 0);
+			if (stack == NULL) {
+				printk("%s: cannot allocate a stack of %zu bytes\n",
+				       name, size);
+				return;
+			}
+		}
+
+		k_thread_create(&worker, stack, size, worker_entry,
+				UINT_TO_POINTER(i), NULL, NULL, WORKER_PRIO, 0,
+				K_NO_WAIT);
+		k_thread_join(&worker, K_FOREVER);
+
+		if (dynamic) {
+			(void)k_thread_stack_free(stack);
+		}
+
+		cycles += k_cycle_get_32() - start;
+	}
+
+	printk("create/join %s %u per sec (%u cycles)\n", name,
+	       (uint32_t)(((uint64_t)NB_CYCLES * sys_clock_hw_cycles_per_sec()) /
+			  MAX(cycles, 1U)),
+	       (uint32_t)(cycles / NB_CYCLES));
+}
+
+int main(void)
+{
+	for (int i = 0; i < NB_IDLERS; i++) {
+		k_thread_create(&idlers[i], idler_stacks[i], IDLER_STACK_SIZE,
+				idler_entry, NULL, NULL, NULL, WORKER_PRIO, 0,
+				K_NO_WAIT);
+	}
+
+	run("static", POOL_SIZE, false);
+	run("small", SMALL_SIZE, true);
+	run("pool", POOL_SIZE, true);
+	run("heap", HEAP_SIZE, true);
+
+	for (int i = 0; i < NB_IDLERS; i++) {
+		k_sem_give(&idle_sem);
+	}
+	for (int i = 0; i < NB_IDLERS; i++) {
+		k_thread_join(&idlers[i], K_FOREVER);
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
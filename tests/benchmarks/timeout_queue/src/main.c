@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <timeout_q.h>
+
+/* Timeout queue microbenchmark: arms N_TIMEOUTS kernel timeouts
+ * with z_add_timeout(), queries the next expiry and then cancels all
+ * of them with z_abort_timeout(), reporting the average number of
+ * cycles per operation for each step.  The timeouts are spread
+ * between one second and a few minutes in the future so none of them
+ * fires while being measured.
+ */
+
+#define N_TIMEOUTS 10000
+#define N_PASSES   5
+#define N_QUERIES  1000
+
+static struct _timeout timeouts[N_TIMEOUTS];
+static uint16_t order[N_TIMEOUTS];
+
+static uint32_t rand_state = 1;
+
+/* Small deterministic LCG, so every backend sees the same sequence */
+static uint32_t next_rand(void)
+{
+	rand_state = rand_state * 1103515245U + 12345U;
+	return rand_state >> 8;
+}
+
+static void timeout_fn(struct _timeout *t)
+{
+	ARG_UNUSED(t);
+
+	printk("ERROR: timeout fired during benchmark\n");
+}
+
+static void shuffle_order(void)
+{
+	for (int i = N_TIMEOUTS - 1; i > 0; i--) {
+		int j = next_rand() % (i + 1);
+		uint16_t tmp = order[i];
+
+		order[i] = order[j];
+		order[j] = tmp;
+	}
+}
+
+static uint32_t arm_all(void)
+{
+	k_ticks_t base = k_ms_to_ticks_ceil32(MSEC_PER_SEC);
+	k_ticks_t spread = k_ms_to_ticks_ceil32(180 * MSEC_PER_SEC);
+	uint32_t start, end;
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < N_TIMEOUTS; i++) {
+		z_add_timeout(&timeouts[order[i]], timeout_fn,
+			      K_TICKS(base + next_rand() % spread));
+	}
+	end = k_cycle_get_32();
+
+	return (end - start) / N_TIMEOUTS;
+}
+
+static uint32_t query_next(void)
+{
+	volatile int32_t next;
+	uint32_t start, end;
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < N_QUERIES; i++) {
+		next = z_get_next_timeout_expiry();
+	}
+	end = k_cycle_get_32();
+
+	ARG_UNUSED(next);
+
+	return (end - start) / N_QUERIES;
+}
+
+static uint32_t cancel_all(void)
+{
+	uint32_t start, end;
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < N_TIMEOUTS; i++) {
+		(void)z_abort_timeout(&timeouts[order[i]]);
+	}
+	end = k_cycle_get_32();
+
+	return (end - start) / N_TIMEOUTS;
+}
+
+int main(void)
+{
+	for (int i = 0; i < N_TIMEOUTS; i++) {
+		z_init_timeout(&timeouts[i]);
+		order[i] = i;
+	}
+
+	printk("Timeout queue benchmark: %d timeouts, %s backend\n",
+	       N_TIMEOUTS,
+	       IS_ENABLED(CONFIG_TIMEOUT_QUEUE_WHEEL) ? "wheel" : "dlist");
+
+	for (int pass = 0; pass < N_PASSES; pass++) {
+		uint32_t arm, next, cancel;
+
+		shuffle_order();
+		arm = arm_all();
+		next = query_next();
+		shuffle_order();
+		cancel = cancel_all();
+
+		printk("pass %d: arm %6u cycles/op next %6u cycles/op "
+		       "cancel %6u cycles/op\n", pass, arm, next, cancel);
+	}
+
+	printk("fin\n");
+	return 0;
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* Wakeups caused by a set of periodic timers with staggered periods, as
+ * the number of distinct ticks at which any of them expired, for growing
+ * amounts of timer slack.
+ */
+
+#define NUM_TIMERS	8
+#define BASE_PERIOD_MS	100
+#define PERIOD_STEP_MS	13
+#define RUN_TIME_MS	10000
+
+static const uint32_t slack_ms[] = { 0, 5, 20, 50 };
+
+static struct k_timer timers[NUM_TIMERS];
+
+static uint32_t expiries;
+static uint32_t wakeups;
+static int64_t last_tick = -1;
+
+static void bench_expire(struct k_timer *timer)
+{
+	int64_t now = k_uptime_ticks();
+
+	ARG_UNUSED(timer);
+
+	/* Expiry functions run from the timer ISR, in order */
+	expiries++;
+	if (now != last_tick) {
+		last_tick = now;
+		wakeups++;
+	}
+}
+
+static void run(uint32_t slack)
+{
+	uint32_t merged = sys_clock_merged_wakeups_get();
+
+	expiries = 0;
+	wakeups = 0;
+	last_tick = -1;
+
+	/* tick align */
+	k_usleep(1);
+
+	for (int i = 0; i < NUM_TIMERS; i++) {
+		k_timeout_t period = K_MSEC(BASE_PERIOD_MS + i * PERIOD_STEP_MS);
+
+		if (slack == 0U) {
+			k_timer_start(&timers[i], period, period);
+		} else {
+			k_timer_start_slack(&timers[i], period, period,
+					    K_MSEC(slack));
+		}
+	}
+
+	k_msleep(RUN_TIME_MS);
+
+	for (int i = 0; i < NUM_TIMERS; i++) {
+		k_timer_stop(&timers[i]);
+	}
+
+	printk("slack %u ms expiries %u wakeups %u merged %u\n", slack,
+	       expiries, wakeups, sys_clock_merged_wakeups_get() - merged);
+}
+
+int main(void)
+{
+	for (int i = 0; i < NUM_TIMERS; i++) {
+		k_timer_init(&timers[i], bench_expire, NULL);
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(slack_ms); i++) {
+		run(slack_ms[i]);
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* Work queue scaling with the number of worker threads: submit to run
+ * latency on an idle queue, and throughput of bursts of CPU bound and
+ * of blocking work items.
+ */
+
+#define MAX_WORKERS	4
+#define STACK_SIZE	(1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define WORKER_PRIO	K_PRIO_COOP(1)
+#define LATENCY_RUNS	100
+#define BURST_ITEMS	64
+#define SPIN_US		50
+
+static K_THREAD_STACK_ARRAY_DEFINE(queue_stacks, MAX_WORKERS, STACK_SIZE);
+static struct k_work_q queues[MAX_WORKERS];
+
+K_WORK_QUEUE_WORKERS_DEFINE(workers_2, 1, STACK_SIZE);
+K_WORK_QUEUE_WORKERS_DEFINE(workers_3, 2, STACK_SIZE);
+K_WORK_QUEUE_WORKERS_DEFINE(workers_4, 3, STACK_SIZE);
+
+static struct k_work_queue_workers *const workers[MAX_WORKERS] = {
+	NULL, &workers_2, &workers_3, &workers_4,
+};
+
+static struct k_work items[BURST_ITEMS];
+static K_SEM_DEFINE(done_sem, 0, BURST_ITEMS);
+
+static volatile uint32_t submit_cycles;
+static volatile uint32_t run_cycles;
+
+static void latency_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	run_cycles = k_cycle_get_32();
+	k_sem_give(&done_sem);
+}
+
+static void spin_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_busy_wait(SPIN_US);
+	k_sem_give(&done_sem);
+}
+
+static void sleep_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_sleep(K_TICKS(1));
+	k_sem_give(&done_sem);
+}
+
+static uint32_t measure_latency(struct k_work_q *queue)
+{
+	uint64_t total = 0;
+
+	k_work_init(&items[0], latency_handler);
+
+	for (int i = 0; i < LATENCY_RUNS; i++) {
+		submit_cycles = k_cycle_get_32();
+		(void)k_work_submit_to_queue(queue, &items[0]);
+		(void)k_sem_take(&done_sem, K_FOREVER);
+		total += run_cycles - submit_cycles;
+	}
+
+	return (uint32_t)(total / LATENCY_RUNS);
+}
+
+/* Items per second for a burst of BURST_ITEMS items */
+static uint32_t measure_burst(struct k_work_q *queue, k_work_handler_t handler)
+{
+	uint32_t start, cycles;
+
+	for (int i = 0; i < BURST_ITEMS; i++) {
+		k_work_init(&items[i], handler);
+	}
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < BURST_ITEMS; i++) {
+		(void)k_work_submit_to_queue(queue, &items[i]);
+	}
+	for (int i = 0; i < BURST_ITEMS; i++) {
+		(void)k_sem_take(&done_sem, K_FOREVER);
+	}
+	cycles = MAX(k_cycle_get_32() - start, 1U);
+
+	return (uint32_t)(((uint64_t)BURST_ITEMS * sys_clock_hw_cycles_per_sec()) /
+			  cycles);
+}
+
+int main(void)
+{
+	for (int n = 1; n <= MAX_WORKERS; n++) {
+		struct k_work_q *queue = &queues[n - 1];
+		struct k_work_queue_config cfg = {
+			.name = "bench_wq",
+			.num_workers = n,
+			.workers = workers[n - 1],
+			.pin_workers = true,
+		};
+		uint32_t latency, spin, sleep;
+
+		k_work_queue_start(queue, queue_stacks[n - 1],
+				   K_THREAD_STACK_SIZEOF(queue_stacks[n - 1]),
+				   WORKER_PRIO, &cfg);
+
+		latency = measure_latency(queue);
+		spin = measure_burst(queue, spin_handler);
+		sleep = measure_burst(queue, sleep_handler);
+
+		printk("workers %d latency %u cycles spin %u items/s sleep %u items/s\n",
+		       n, latency, spin, sleep);
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
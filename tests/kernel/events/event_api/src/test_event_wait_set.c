@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#define WAITER_STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define WAITER_TIMEOUT	K_MSEC(1000)
+#define WAITER_DELAY	K_MSEC(50)
+
+struct waiter {
+	uint32_t events;
+	bool all;
+	uint32_t result;
+};
+
+/* Bits 0 and 8 share a wait queue with the default number of queues */
+static struct waiter waiters[] = {
+	{ .events = BIT(0) },
+	{ .events = BIT(8) },
+	{ .events = BIT(1), .all = true },
+	{ .events = BIT(5) | BIT(6) },
+	{ .events = BIT(9) | BIT(10), .all = true },
+};
+
+static K_THREAD_STACK_ARRAY_DEFINE(waiter_stacks, ARRAY_SIZE(waiters),
+				   WAITER_STACK_SIZE);
+static struct k_thread waiter_threads[ARRAY_SIZE(waiters)];
+static K_EVENT_DEFINE(index_event);
+
+static void waiter_entry(void *p1, void *p2, void *p3)
+{
+	struct waiter *w = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	if (w->all) {
+		w->result = k_event_wait_all(&index_event, w->events, false,
+					     WAITER_TIMEOUT);
+	} else {
+		w->result = k_event_wait(&index_event, w->events, false,
+					 WAITER_TIMEOUT);
+	}
+}
+
+static void post_and_check(uint32_t events, uint32_t woken)
+{
+	k_event_post(&index_event, events);
+	k_sleep(WAITER_DELAY);
+
+	ARRAY_FOR_EACH(waiters, i) {
+		if ((woken & BIT(i)) != 0U) {
+			zassert_ok(k_thread_join(&waiter_threads[i], K_NO_WAIT),
+				   "waiter %zu not woken by %#x", i, events);
+		} else if (waiters[i].result == UINT32_MAX) {
+			zassert_equal(k_thread_join(&waiter_threads[i], K_NO_WAIT),
+				      -EBUSY, "waiter %zu woken by %#x", i, events);
+		}
+	}
+}
+
+/**
+ * @brief Verify that a post wakes up exactly the threads waiting for it
+ */
+ZTEST(events_api, test_event_wait_index)
+{
+	k_event_clear(&index_event, UINT32_MAX);
+
+	ARRAY_FOR_EACH(waiters, i) {
+		waiters[i].result = UINT32_MAX;
+		k_thread_create(&waiter_threads[i], waiter_stacks[i],
+				WAITER_STACK_SIZE, waiter_entry, &waiters[i],
+				NULL, NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	}
+	k_sleep(WAITER_DELAY);
+
+	post_and_check(BIT(0), BIT(0));
+	zassert_equal(waiters[0].result, BIT(0));
+
+	post_and_check(BIT(1) | BIT(6), BIT(2) | BIT(3));
+	zassert_equal(waiters[2].result, BIT(1));
+	zassert_equal(waiters[3].result, BIT(6));
+
+	/* Half of a wait for all events does not wake up, and neither does
+	 * setting events which are already there
+	 */
+	post_and_check(BIT(9), 0);
+	post_and_check(BIT(9), 0);
+
+	post_and_check(BIT(10) | BIT(8), BIT(1) | BIT(4));
+	zassert_equal(waiters[1].result, BIT(8));
+	zassert_equal(waiters[4].result, BIT(9) | BIT(10));
+}
+
+#ifdef CONFIG_EVENTS_WAIT_SET
+
+static K_EVENT_DEFINE(set_event0);
+static K_EVENT_DEFINE(set_event1);
+static K_THREAD_STACK_DEFINE(poster_stack, WAITER_STACK_SIZE);
+static struct k_thread poster_thread;
+
+static void poster_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p3);
+
+	k_sleep(WAITER_DELAY);
+	k_event_post(p1, POINTER_TO_UINT(p2));
+}
+
+static void set_reset(struct k_event_wait_desc *descs)
+{
+	k_event_clear(&set_event0, UINT32_MAX);
+	k_event_clear(&set_event1, UINT32_MAX);
+
+	descs[0].event = &set_event0;
+	descs[0].events = BIT(0) | BIT(1);
+	descs[1].event = &set_event1;
+	descs[1].events = BIT(2);
+}
+
+/**
+ * @brief Verify waiting for events on several event objects
+ */
+ZTEST(events_api, test_event_wait_any_of_set)
+{
+	struct k_event_wait_desc descs[2];
+
+	set_reset(descs);
+	zassert_equal(k_event_wait_any_of_set(descs, 0, K_NO_WAIT), -EINVAL);
+	zassert_equal(k_event_wait_any_of_set(descs, 2, K_NO_WAIT), -EAGAIN);
+	zassert_equal(k_event_wait_any_of_set(descs, 2, WAITER_DELAY), -EAGAIN);
+	zassert_equal(descs[0].matched, 0);
+	zassert_equal(descs[1].matched, 0);
+
+	/* Events already there */
+	k_event_post(&set_event1, BIT(2) | BIT(3));
+	zassert_equal(k_event_wait_any_of_set(descs, 2, K_NO_WAIT), 1);
+	zassert_equal(descs[1].matched, BIT(2));
+
+	/* Events posted while waiting, on either object */
+	set_reset(descs);
+	k_thread_create(&poster_thread, poster_stack, WAITER_STACK_SIZE,
+			poster_entry, &set_event1, UINT_TO_POINTER(BIT(2) | BIT(4)),
+			NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	zassert_equal(k_event_wait_any_of_set(descs, 2, WAITER_TIMEOUT), 1);
+	zassert_equal(descs[0].matched, 0);
+	zassert_equal(descs[1].matched, BIT(2));
+	k_thread_join(&poster_thread, K_FOREVER);
+
+	set_reset(descs);
+	k_thread_create(&poster_thread, poster_stack, WAITER_STACK_SIZE,
+			poster_entry, &set_event0, UINT_TO_POINTER(BIT(1)),
+			NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	zassert_equal(k_event_wait_any_of_set(descs, 2, WAITER_TIMEOUT), 0);
+	zassert_equal(descs[0].matched, BIT(1));
+	k_thread_join(&poster_thread, K_FOREVER);
+
+	/* Events not awaited do not wake up */
+	set_reset(descs);
+	k_thread_create(&poster_thread, poster_stack, WAITER_STACK_SIZE,
+			poster_entry, &set_event0, UINT_TO_POINTER(BIT(2)),
+			NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	zassert_equal(k_event_wait_any_of_set(descs, 2, K_MSEC(200)), -EAGAIN);
+	k_thread_join(&poster_thread, K_FOREVER);
+}
+
+#endif /* CONFIG_EVENTS_WAIT_SET */
@@ -265,3 +265,90 @@ ZTEST(k_heap_api, test_k_heap_alloc_pending_null)
 
 	k_heap_free(&k_heap_test, p);
 }
+
+#if defined(CONFIG_SYS_HEAP_CACHE) && defined(CONFIG_SYS_HEAP_RUNTIME_STATS)
+/**
+ * @brief Test the per-CPU k_heap allocation cache
+ *
+ * @details A small block freed to the heap is cached by the current CPU
+ * and handed out again by the next allocation of the same size class,
+ * which the heap statistics count as a cache hit.
+ *
+ * @ingroup kernel_heap_tests
+ */
+ZTEST(k_heap_api, test_k_heap_cache)
+{
+	struct sys_memory_stats before, after;
+	unsigned int key = irq_lock();
+	void *p, *q;
+
+	/* Stay on this CPU so that the same magazine is used */
+	zassert_ok(sys_heap_runtime_stats_get(&k_heap_test.heap, &before));
+
+	p = k_heap_alloc(&k_heap_test, 24, K_NO_WAIT);
+	zassert_not_null(p, "k_heap_alloc operation failed");
+	k_heap_free(&k_heap_test, p);
+
+	q = k_heap_alloc(&k_heap_test, 32, K_NO_WAIT);
+	zassert_equal(p, q, "freed block not reused from the cache");
+
+	zassert_ok(sys_heap_runtime_stats_get(&k_heap_test.heap, &after));
+	irq_unlock(key);
+
+	zassert_true(after.cache_hits > before.cache_hits, "no cache hit");
+
+	k_heap_free(&k_heap_test, q);
+}
+
+#define CACHE_BLOCK_SIZE 32
+#define CACHE_BLOCKS (HEAP_SIZE / CACHE_BLOCK_SIZE)
+
+static void thread_alloc_cached(void *p1, void *p2, void *p3)
+{
+	void **block = p1;
+
+	*block = k_heap_alloc(&k_heap_test, CACHE_BLOCK_SIZE, K_MSEC(TIMEOUT));
+}
+
+/**
+ * @brief Test that a cached free wakes up a blocked allocation
+ *
+ * @details Exhaust the heap with small blocks, so that a thread pends
+ * allocating one more.  Freeing a single block, which the current CPU
+ * caches, must hand it over to the pending thread.
+ *
+ * @ingroup kernel_heap_tests
+ */
+ZTEST(k_heap_api, test_k_heap_cache_waiter)
+{
+	static void *blocks[CACHE_BLOCKS];
+	void *block = NULL;
+	int n;
+
+	for (n = 0; n < CACHE_BLOCKS; n++) {
+		blocks[n] = k_heap_alloc(&k_heap_test, CACHE_BLOCK_SIZE,
+					 K_NO_WAIT);
+		if (blocks[n] == NULL) {
+			break;
+		}
+	}
+	zassert_true(n > 0, "k_heap_alloc operation failed");
+
+	k_tid_t tid = k_thread_create(&tdata, tstack, STACK_SIZE,
+				      thread_alloc_cached, &block, NULL, NULL,
+				      K_PRIO_PREEMPT(5), 0, K_NO_WAIT);
+
+	/* Sleep long enough for child thread to go into pending */
+	k_msleep(5);
+
+	k_heap_free(&k_heap_test, blocks[--n]);
+	k_thread_join(tid, K_FOREVER);
+
+	zassert_not_null(block, "pending allocation not woken up by a free");
+
+	k_heap_free(&k_heap_test, block);
+	while (n > 0) {
+		k_heap_free(&k_heap_test, blocks[--n]);
+	}
+}
+#endif /* CONFIG_SYS_HEAP_CACHE && CONFIG_SYS_HEAP_RUNTIME_STATS */
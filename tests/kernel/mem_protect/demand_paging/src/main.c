@@ -11,12 +11,16 @@
 #include <mmu.h>
 #include <zephyr/linker/sections.h>
 
-#ifdef CONFIG_BACKING_STORE_RAM_PAGES
-#define EXTRA_PAGES	(CONFIG_BACKING_STORE_RAM_PAGES - 1)
+#if defined(CONFIG_BACKING_STORE_RAM_PAGES)
+#define BACKING_STORE_PAGES	CONFIG_BACKING_STORE_RAM_PAGES
+#elif defined(CONFIG_BACKING_STORE_COMPRESSED_PAGES)
+#define BACKING_STORE_PAGES	CONFIG_BACKING_STORE_COMPRESSED_PAGES
 #else
 #error "Unsupported configuration"
 #endif
 
+#define EXTRA_PAGES	(BACKING_STORE_PAGES - 1)
+
 #ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
 #ifdef CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS
 
@@ -105,6 +109,10 @@ static void print_paging_stats(struct k_mem_paging_stats_t *stats, const char *s
 #ifndef CONFIG_DEMAND_PAGING_ALLOW_IRQ
 	printk("    - in ISR: %lu\n", stats->pagefaults.in_isr);
 #endif
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	printk("    - Pages read ahead: %lu\n", stats->pagefaults.read_ahead);
+	printk("    - Avoided: %lu\n", stats->pagefaults.avoided);
+#endif
 
 	printk("* Eviction (%s):\n", scope);
 	printk("    - Total pages evicted: %lu\n",
@@ -113,6 +121,19 @@ static void print_paging_stats(struct k_mem_paging_stats_t *stats, const char *s
 	       stats->eviction.clean);
 	printk("    - Dirty pages evicted: %lu\n",
 	       stats->eviction.dirty);
+	printk("    - Page frames scanned: %lu\n",
+	       stats->eviction.scanned);
+	printk("    - Page frames referenced: %lu\n",
+	       stats->eviction.referenced);
+#ifdef CONFIG_DEMAND_PAGING_CLEANER
+
+	printk("* Page cleaner (%s):\n", scope);
+	printk("    - Runs: %lu\n", stats->cleaner.runs);
+	printk("    - Clean pages evicted: %lu\n", stats->cleaner.clean);
+	printk("    - Dirty pages evicted: %lu\n", stats->cleaner.dirty);
+	printk("    - Page faults without free page frame: %lu\n",
+	       stats->cleaner.misses);
+#endif
 }
 
 ZTEST(demand_paging, test_touch_anon_pages)
@@ -155,6 +176,35 @@ ZTEST(demand_paging, test_touch_anon_pages)
 	print_paging_stats(&stats, "kernel");
 	zassert_not_equal(stats.eviction.dirty, 0UL,
 			  "there should be dirty pages being evicted.");
+	zassert_true(stats.eviction.scanned >=
+		     stats.eviction.clean + stats.eviction.dirty,
+		     "evicted more page frames than scanned.");
+	zassert_true(stats.eviction.referenced <= stats.eviction.scanned,
+		     "referenced more page frames than scanned.");
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	zassert_not_equal(stats.pagefaults.read_ahead, 0UL,
+			  "sequential page faults were not read ahead.");
+	zassert_true(stats.pagefaults.avoided <= stats.pagefaults.read_ahead,
+		     "avoided more page faults than pages read ahead.");
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
+
+#ifdef CONFIG_DEMAND_PAGING_CLEANER
+	/* Page faults ran out of free page frames, so the page cleaner was
+	 * woken up. It runs as soon as the test thread sleeps.
+	 */
+	k_msleep(10);
+	k_mem_paging_stats_get(&stats);
+	print_paging_stats(&stats, "kernel");
+	zassert_not_equal(stats.cleaner.runs, 0UL,
+			  "page cleaner was not woken up.");
+	zassert_not_equal(stats.cleaner.clean + stats.cleaner.dirty, 0UL,
+			  "page cleaner did not evict any page.");
+	zassert_true(stats.cleaner.clean <= stats.eviction.clean &&
+		     stats.cleaner.dirty <= stats.eviction.dirty,
+		     "page cleaner evictions not accounted as evictions.");
+	zassert_true(stats.cleaner.misses <= stats.pagefaults.cnt,
+		     "more page faults without free page frame than faults.");
+#endif /* CONFIG_DEMAND_PAGING_CLEANER */
 
 #ifdef CONFIG_EVICTION_NRU
 	k_msleep(CONFIG_EVICTION_NRU_PERIOD * 2);
@@ -196,6 +246,10 @@ static void test_k_mem_page_out(void)
 {
 	unsigned long faults;
 	int key, ret;
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	struct k_mem_paging_stats_t stats;
+	unsigned long read_ahead;
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
 
 	/* Lock IRQs to prevent other pagefaults from happening while we
 	 * are measuring stuff
@@ -204,6 +258,10 @@ static void test_k_mem_page_out(void)
 	faults = z_num_pagefaults_get();
 	ret = k_mem_page_out(arena, HALF_BYTES);
 	zassert_equal(ret, 0, "k_mem_page_out failed with %d", ret);
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	k_mem_paging_stats_get(&stats);
+	read_ahead = stats.pagefaults.read_ahead;
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
 
 	/* Write to the supposedly evicted region */
 	for (size_t i = 0; i < HALF_BYTES; i++) {
@@ -212,9 +270,20 @@ static void test_k_mem_page_out(void)
 	faults = z_num_pagefaults_get() - faults;
 	irq_unlock(key);
 
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	/* Each page either faulted or was read ahead by a prior fault */
+	k_mem_paging_stats_get(&stats);
+	read_ahead = stats.pagefaults.read_ahead - read_ahead;
+	zassert_true(faults < HALF_PAGES,
+		     "no page faults avoided, got %lu", faults);
+	zassert_true(faults + read_ahead >= HALF_PAGES,
+		     "unexpected num pagefaults %lu and read ahead %lu",
+		     faults, read_ahead);
+#else
 	zassert_equal(faults, HALF_PAGES,
 		      "unexpected num pagefaults expected %lu got %d",
 		      HALF_PAGES, faults);
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
 
 	ret = k_mem_page_out(arena, arena_size);
 	zassert_equal(ret, -ENOMEM, "k_mem_page_out should have failed");
@@ -248,6 +317,50 @@ ZTEST(demand_paging_api, test_k_mem_page_in)
 		      faults);
 }
 
+#ifdef CONFIG_BACKING_STORE_COMPRESSED
+ZTEST(demand_paging_api, test_k_mem_page_compressed)
+{
+	struct k_mem_paging_backing_store_compressed_stats before, after;
+	unsigned long page_ins;
+	int key, ret;
+
+	key = irq_lock();
+	k_mem_paging_backing_store_compressed_stats_get(&before);
+
+	/* The first half of the arena holds a repeated pattern */
+	ret = k_mem_page_out(arena, HALF_BYTES);
+	zassert_equal(ret, 0, "k_mem_page_out failed with %d", ret);
+
+	k_mem_paging_backing_store_compressed_stats_get(&after);
+	irq_unlock(key);
+
+	printk("compressed store: %lu pages in %lu bytes, %lu same-filled, "
+	       "%lu incompressible\n", after.pages, after.stored_bytes,
+	       after.same_filled, after.incompressible);
+
+	zassert_true(after.page_outs - before.page_outs >= HALF_PAGES,
+		     "pages not paged out to the compressed store");
+	zassert_true(after.pages >= HALF_PAGES, "pages not stored");
+	zassert_true(after.stored_bytes <
+		     (after.pages - after.same_filled) * CONFIG_MMU_PAGE_SIZE,
+		     "pattern pages were not compressed");
+
+	/* Read back through page faults, decompressing the pages */
+	for (size_t i = 0; i < HALF_BYTES; i++) {
+		zassert_equal(arena[i], nums[i % 10],
+			      "arena corrupted at index %d (%p): got 0x%hhx expected 0x%hhx",
+			      i, &arena[i], arena[i], nums[i % 10]);
+	}
+
+	k_mem_paging_backing_store_compressed_stats_get(&after);
+	page_ins = after.page_ins - before.page_ins;
+	zassert_true(page_ins >= HALF_PAGES, "pages not paged in");
+	printk("average page-in %llu cycles, max %u cycles\n",
+	       (after.page_in_cycles - before.page_in_cycles) / page_ins,
+	       after.page_in_cycles_max);
+}
+#endif /* CONFIG_BACKING_STORE_COMPRESSED */
+
 ZTEST(demand_paging_api, test_k_mem_pin)
 {
 	unsigned long faults;
@@ -297,7 +410,7 @@ ZTEST(demand_paging_stat, test_backing_store_capacity)
 	char *mem, *ret;
 	unsigned int key;
 	unsigned long faults;
-	size_t size = (((CONFIG_BACKING_STORE_RAM_PAGES - 1) - HALF_PAGES) *
+	size_t size = (((BACKING_STORE_PAGES - 1) - HALF_PAGES) *
 		       CONFIG_MMU_PAGE_SIZE);
 
 	/* Consume the rest of memory */
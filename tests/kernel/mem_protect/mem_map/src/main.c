@@ -13,6 +13,10 @@
 #include <zephyr/kernel/mm/demand_paging.h>
 #endif /* CONFIG_DEMAND_PAGING */
 
+#ifdef CONFIG_X86_MMU_HUGE_PAGES
+#include <x86_mmu.h>
+#endif /* CONFIG_X86_MMU_HUGE_PAGES */
+
 /* 32-bit IA32 page tables have no mechanism to restrict execution */
 #if defined(CONFIG_X86) && !defined(CONFIG_X86_64) && !defined(CONFIG_X86_PAE)
 #define SKIP_EXECUTE_TESTS
@@ -258,6 +262,86 @@ ZTEST(mem_map, test_z_phys_map_unmap_reclaim_addr)
 	zassert_equal(mapped, mapped_old, "Virtual memory region not reclaimed!");
 }
 
+#ifdef CONFIG_X86_MMU_HUGE_PAGES
+#define HUGE_PAGE_SIZE	MB(2)
+#define HUGE_MAP_SIZE	MB(4)
+/* Upper half of RAM, not used by the kernel image */
+#define HUGE_MAP_PHYS	MB(16)
+
+/* Levels of page directory and page table entries on x86_64 */
+#define PD_LEVEL	2
+#define PT_LEVEL	3
+
+static void huge_page_entry_check(uint8_t *virt, int expected_level)
+{
+	pentry_t entry;
+	int level;
+
+	z_x86_pentry_get(&level, &entry, z_x86_kernel_ptables, virt);
+	zassert_equal(level, expected_level,
+		      "%p mapped at paging level %d, expected %d",
+		      virt, level, expected_level);
+	if (expected_level == PD_LEVEL) {
+		zassert_true((entry & MMU_P) != 0U, "%p not present", virt);
+		zassert_true((entry & MMU_PS) != 0U, "%p not a 2MB page", virt);
+	} else {
+		zassert_true((entry & MMU_P) == 0U, "%p still mapped", virt);
+	}
+}
+#endif /* CONFIG_X86_MMU_HUGE_PAGES */
+
+/**
+ * Show that a large, 2MB aligned region is mapped with 2MB pages, and that
+ * the page tables they displace are linked back in when it is unmapped.
+ *
+ * @ingroup kernel_memprotect_tests
+ */
+ZTEST(mem_map, test_z_phys_map_huge_pages)
+{
+#ifdef CONFIG_X86_MMU_HUGE_PAGES
+	static const size_t offsets[] = {
+		0, CONFIG_MMU_PAGE_SIZE, CONFIG_MMU_PAGE_SIZE + 123,
+		HUGE_PAGE_SIZE / 2, HUGE_PAGE_SIZE - 1, HUGE_PAGE_SIZE,
+		HUGE_PAGE_SIZE + 5 * CONFIG_MMU_PAGE_SIZE + 7,
+		HUGE_MAP_SIZE - 1,
+	};
+	uint8_t *mapped;
+	uintptr_t phys;
+
+	expect_fault = false;
+
+	z_phys_map(&mapped, HUGE_MAP_PHYS, HUGE_MAP_SIZE, BASE_FLAGS);
+	zassert_not_null(mapped, "failed to map %d bytes", HUGE_MAP_SIZE);
+	zassert_equal(POINTER_TO_UINT(mapped) % HUGE_PAGE_SIZE, 0,
+		      "%p is not 2MB aligned", mapped);
+
+	for (size_t i = 0; i < ARRAY_SIZE(offsets); i++) {
+		zassert_equal(arch_page_phys_get(mapped + offsets[i], &phys), 0,
+			      "offset 0x%zx not mapped", offsets[i]);
+		zassert_equal(phys, HUGE_MAP_PHYS + offsets[i],
+			      "offset 0x%zx mapped to 0x%lx", offsets[i], phys);
+	}
+
+	for (size_t off = 0; off < HUGE_MAP_SIZE; off += HUGE_PAGE_SIZE) {
+		huge_page_entry_check(mapped + off, PD_LEVEL);
+	}
+
+	/* The mapping is readable through the 2MB pages */
+	(void)*(volatile uint8_t *)(mapped + HUGE_PAGE_SIZE + 42);
+
+	z_phys_unmap(mapped, HUGE_MAP_SIZE);
+
+	/* Lookups now go down to the restored, empty page tables */
+	for (size_t off = 0; off < HUGE_MAP_SIZE; off += HUGE_PAGE_SIZE) {
+		huge_page_entry_check(mapped + off, PT_LEVEL);
+		zassert_not_equal(arch_page_phys_get(mapped + off, NULL), 0,
+				  "%p still mapped", mapped + off);
+	}
+#else
+	ztest_test_skip();
+#endif /* CONFIG_X86_MMU_HUGE_PAGES */
+}
+
 /**
  * Basic k_mem_map() and k_mem_unmap() functionality
  *
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/syscall_batch.h>
+#include <zephyr/ztest.h>
+
+#ifdef CONFIG_SYSCALL_BATCH
+
+#define BATCH_LEN 8
+
+K_SEM_DEFINE(batch_sem, 0, 10);
+K_MSGQ_DEFINE(batch_msgq, sizeof(uint32_t), 1, 4);
+struct k_poll_signal batch_signal;
+
+void test_syscall_batch_user(void *p1, void *p2, void *p3)
+{
+	struct k_syscall_batch_entry entries[BATCH_LEN];
+	struct k_syscall_batch batch;
+	struct k_syscall_batch_entry *put, *overflow, *raise;
+	uint32_t msg[2] = { 0x1234, 0x5678 };
+	unsigned int signaled;
+	int result;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_syscall_batch_init(&batch, entries, BATCH_LEN);
+	zassert_equal(k_syscall_batch_flush(&batch), 0);
+
+	zassert_not_null(k_syscall_batch_sem_give(&batch, &batch_sem));
+	zassert_not_null(k_syscall_batch_sem_give(&batch, &batch_sem));
+	put = k_syscall_batch_msgq_put(&batch, &batch_msgq, &msg[0], K_NO_WAIT);
+	overflow = k_syscall_batch_msgq_put(&batch, &batch_msgq, &msg[1], K_NO_WAIT);
+	raise = k_syscall_batch_poll_signal_raise(&batch, &batch_signal, -42);
+
+	zassert_equal(k_syscall_batch_flush(&batch), 5);
+	zassert_equal(batch.count, 0);
+
+	/* Each entry got its own return value */
+	zassert_equal((int)put->result, 0);
+	zassert_equal((int)overflow->result, -ENOMSG);
+	zassert_equal((int)raise->result, 0);
+
+	zassert_equal(k_sem_count_get(&batch_sem), 2);
+	zassert_equal(k_msgq_get(&batch_msgq, &msg[1], K_NO_WAIT), 0);
+	zassert_equal(msg[1], msg[0]);
+	k_poll_signal_check(&batch_signal, &signaled, &result);
+	zassert_true(signaled);
+	zassert_equal(result, -42);
+
+	/* A full buffer refuses further calls */
+	for (int i = 0; i < BATCH_LEN; i++) {
+		zassert_not_null(k_syscall_batch_sem_give(&batch, &batch_sem));
+	}
+	zassert_is_null(k_syscall_batch_sem_give(&batch, &batch_sem));
+	zassert_equal(k_syscall_batch_flush(&batch), BATCH_LEN);
+	zassert_equal(k_sem_count_get(&batch_sem), 2 + BATCH_LEN);
+}
+
+/* Show that a batch runs several system calls with one submission */
+ZTEST(syscalls, test_syscall_batch)
+{
+	struct k_syscall_batch_entry entry;
+
+	k_sem_reset(&batch_sem);
+	k_msgq_purge(&batch_msgq);
+	k_poll_signal_init(&batch_signal);
+
+	/* Supervisor threads have no privilege elevation to save */
+	zassert_equal(k_syscall_batch_submit(&entry, 1), -ENOTSUP);
+
+	k_thread_access_grant(k_current_get(), &batch_sem, &batch_msgq,
+			      &batch_signal);
+
+	/* Remainder of the test in user mode */
+	k_thread_user_mode_enter(test_syscall_batch_user, NULL, NULL, NULL);
+}
+
+#endif /* CONFIG_SYSCALL_BATCH */
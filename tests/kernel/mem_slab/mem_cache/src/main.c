@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define SMALL_SZ	32
+#define SMALL_NUM	4
+#define MEDIUM_SZ	128
+#define MEDIUM_NUM	2
+#define LARGE_SZ	512
+#define LARGE_NUM	1
+
+#define TOTAL_BYTES	(SMALL_SZ * SMALL_NUM + MEDIUM_SZ * MEDIUM_NUM + \
+			 LARGE_SZ * LARGE_NUM)
+
+static int ctor_calls;
+static int dtor_calls;
+
+static void obj_ctor(void *obj, size_t size)
+{
+	memset(obj, 0xa5, size);
+	ctor_calls++;
+}
+
+static void obj_dtor(void *obj, size_t size)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(size);
+	dtor_calls++;
+}
+
+K_MEM_SLAB_DEFINE_STATIC(small_slab, SMALL_SZ, SMALL_NUM, 4);
+K_MEM_SLAB_DEFINE_STATIC(medium_slab, MEDIUM_SZ, MEDIUM_NUM, 4);
+K_MEM_SLAB_DEFINE_STATIC(large_slab, LARGE_SZ, LARGE_NUM, 4);
+
+K_MEM_CACHE_DEFINE(cache, obj_ctor, obj_dtor, small_slab, medium_slab,
+		   large_slab);
+
+static bool in_slab(struct k_mem_slab *slab, void *obj)
+{
+	return ((char *)obj >= slab->buffer) &&
+	       ((char *)obj < slab->buffer +
+		(slab->info.block_size * slab->info.num_blocks));
+}
+
+static void mem_cache_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_mem_cache_flush(&cache);
+	ctor_calls = 0;
+	dtor_calls = 0;
+#ifdef CONFIG_OBJ_CORE_STATS_MEM_CACHE
+	k_obj_core_stats_reset(K_OBJ_CORE(&cache));
+#endif /* CONFIG_OBJ_CORE_STATS_MEM_CACHE */
+}
+
+/**
+ * @brief Verify that allocations are served by the best fitting class
+ */
+ZTEST(mem_cache, test_mem_cache_best_fit)
+{
+	void *obj[4];
+
+	obj[0] = k_mem_cache_alloc(&cache, 1, K_NO_WAIT);
+	obj[1] = k_mem_cache_alloc(&cache, SMALL_SZ + 1, K_NO_WAIT);
+	obj[2] = k_mem_cache_alloc(&cache, MEDIUM_SZ, K_NO_WAIT);
+	obj[3] = k_mem_cache_alloc(&cache, MEDIUM_SZ + 1, K_NO_WAIT);
+
+	zassert_true(in_slab(&small_slab, obj[0]), "1 byte not in small class");
+	zassert_true(in_slab(&medium_slab, obj[1]), "33 bytes not in medium class");
+	zassert_true(in_slab(&medium_slab, obj[2]), "128 bytes not in medium class");
+	zassert_true(in_slab(&large_slab, obj[3]), "129 bytes not in large class");
+
+	zassert_is_null(k_mem_cache_alloc(&cache, 0, K_NO_WAIT),
+			"zero sized allocation succeeded");
+	zassert_is_null(k_mem_cache_alloc(&cache, LARGE_SZ + 1, K_NO_WAIT),
+			"oversized allocation succeeded");
+
+	for (int i = 0; i < ARRAY_SIZE(obj); i++) {
+		k_mem_cache_free(&cache, obj[i]);
+	}
+}
+
+/**
+ * @brief Verify that exhausted classes fall back to larger ones
+ */
+ZTEST(mem_cache, test_mem_cache_fallback)
+{
+	void *small[SMALL_NUM];
+	void *medium, *large;
+
+	for (int i = 0; i < SMALL_NUM; i++) {
+		small[i] = k_mem_cache_alloc(&cache, SMALL_SZ, K_NO_WAIT);
+		zassert_true(in_slab(&small_slab, small[i]), "not in small class");
+	}
+
+	medium = k_mem_cache_alloc(&cache, SMALL_SZ, K_NO_WAIT);
+	zassert_true(in_slab(&medium_slab, medium), "no fallback to medium");
+
+	large = k_mem_cache_alloc(&cache, LARGE_SZ, K_NO_WAIT);
+	zassert_not_null(large, "large class allocation failed");
+	zassert_is_null(k_mem_cache_alloc(&cache, LARGE_SZ, K_MSEC(10)),
+			"allocation from exhausted cache succeeded");
+
+	/* Freed objects go back to the class they came from */
+	k_mem_cache_free(&cache, medium);
+	k_mem_cache_free(&cache, large);
+	for (int i = 0; i < SMALL_NUM; i++) {
+		k_mem_cache_free(&cache, small[i]);
+	}
+	k_mem_cache_flush(&cache);
+
+	zassert_equal(k_mem_slab_num_free_get(&small_slab), SMALL_NUM, NULL);
+	zassert_equal(k_mem_slab_num_free_get(&medium_slab), MEDIUM_NUM, NULL);
+	zassert_equal(k_mem_slab_num_free_get(&large_slab), LARGE_NUM, NULL);
+}
+
+/**
+ * @brief Verify constructor and destructor calls
+ */
+ZTEST(mem_cache, test_mem_cache_ctor_dtor)
+{
+	uint8_t *obj, *again;
+
+	obj = k_mem_cache_alloc(&cache, 8, K_NO_WAIT);
+	zassert_not_null(obj, "allocation failed");
+	zassert_equal(ctor_calls, 1, "constructor not called");
+	zassert_equal(obj[SMALL_SZ - 1], 0xa5, "constructor not given class size");
+
+	k_mem_cache_free(&cache, obj);
+	again = k_mem_cache_alloc(&cache, 8, K_NO_WAIT);
+
+#if CONFIG_MEM_CACHE_PER_CPU_DEPTH > 0
+	/* Served from the per-CPU cache, still constructed */
+	zassert_equal_ptr(obj, again, "cached object not reused");
+	zassert_equal(ctor_calls, 1, "cached object constructed again");
+	zassert_equal(dtor_calls, 0, "cached object destroyed");
+#else
+	zassert_equal(ctor_calls, 2, "constructor not called");
+	zassert_equal(dtor_calls, 1, "destructor not called");
+#endif /* CONFIG_MEM_CACHE_PER_CPU_DEPTH > 0 */
+
+	k_mem_cache_free(&cache, again);
+	k_mem_cache_flush(&cache);
+	zassert_equal(dtor_calls, ctor_calls, "objects left constructed");
+}
+
+/**
+ * @brief Verify the memory cache statistics
+ */
+ZTEST(mem_cache, test_mem_cache_stats)
+{
+	struct sys_memory_stats stats;
+	void *obj[SMALL_NUM + 1];
+
+	zassert_equal(k_mem_cache_runtime_stats_get(NULL, &stats), -EINVAL, NULL);
+	zassert_equal(k_mem_cache_runtime_stats_get(&cache, NULL), -EINVAL, NULL);
+
+	for (int i = 0; i < ARRAY_SIZE(obj); i++) {
+		obj[i] = k_mem_cache_alloc(&cache, SMALL_SZ, K_NO_WAIT);
+		zassert_not_null(obj[i], "allocation failed");
+	}
+
+	zassert_equal(k_mem_cache_runtime_stats_get(&cache, &stats), 0, NULL);
+	zassert_equal(stats.allocated_bytes, SMALL_SZ * SMALL_NUM + MEDIUM_SZ, NULL);
+	zassert_equal(stats.free_bytes + stats.allocated_bytes, TOTAL_BYTES, NULL);
+
+	/* Cached objects are reported as free */
+	for (int i = 0; i < ARRAY_SIZE(obj); i++) {
+		k_mem_cache_free(&cache, obj[i]);
+	}
+	zassert_equal(k_mem_cache_runtime_stats_get(&cache, &stats), 0, NULL);
+	zassert_equal(stats.allocated_bytes, 0, NULL);
+	zassert_equal(stats.free_bytes, TOTAL_BYTES, NULL);
+
+#ifdef CONFIG_OBJ_CORE_STATS_MEM_CACHE
+	struct k_mem_cache_info info;
+
+	obj[0] = k_mem_cache_alloc(&cache, SMALL_SZ, K_NO_WAIT);
+	zassert_is_null(k_mem_cache_alloc(&cache, LARGE_SZ + 1, K_NO_WAIT), NULL);
+	k_mem_cache_free(&cache, obj[0]);
+
+	zassert_equal(k_obj_core_stats_raw(K_OBJ_CORE(&cache), &info,
+					   sizeof(info)), 0, NULL);
+	zassert_equal(info.fallbacks, 1, "expected 1 fallback, got %u",
+		      info.fallbacks);
+	zassert_equal(info.failures, 1, "expected 1 failure, got %u",
+		      info.failures);
+	zassert_equal(info.hits + info.misses, ARRAY_SIZE(obj) + 1, NULL);
+#if CONFIG_MEM_CACHE_PER_CPU_DEPTH > 0
+	zassert_true(info.hits > 0, "no per-CPU cache hits");
+#endif /* CONFIG_MEM_CACHE_PER_CPU_DEPTH > 0 */
+#endif /* CONFIG_OBJ_CORE_STATS_MEM_CACHE */
+}
+
+/**
+ * @brief Verify that the statistics of each size class are kept apart
+ */
+ZTEST(mem_cache, test_mem_cache_class_stats)
+{
+	struct sys_memory_stats before[3], after;
+	void *obj;
+
+	zassert_equal(k_mem_cache_class_runtime_stats_get(&cache, 3, &after),
+		      -EINVAL, NULL);
+
+	for (int cls = 0; cls < ARRAY_SIZE(before); cls++) {
+		zassert_equal(k_mem_cache_class_runtime_stats_get(&cache, cls,
+								  &before[cls]),
+			      0, NULL);
+	}
+
+	obj = k_mem_cache_alloc(&cache, MEDIUM_SZ, K_NO_WAIT);
+	zassert_true(in_slab(&medium_slab, obj), "not in medium class");
+
+	for (int cls = 0; cls < ARRAY_SIZE(before); cls++) {
+		size_t used = (cls == 1) ? MEDIUM_SZ : 0;
+
+		zassert_equal(k_mem_cache_class_runtime_stats_get(&cache, cls,
+								  &after),
+			      0, NULL);
+		zassert_equal(after.allocated_bytes,
+			      before[cls].allocated_bytes + used,
+			      "class %d allocated bytes", cls);
+		zassert_equal(after.free_bytes, before[cls].free_bytes - used,
+			      "class %d free bytes", cls);
+	}
+
+#ifdef CONFIG_OBJ_CORE_STATS_MEM_CACHE
+	struct k_mem_cache_info info;
+
+	zassert_is_null(k_mem_cache_alloc(&cache, LARGE_SZ + 1, K_NO_WAIT), NULL);
+
+	for (int cls = 0; cls < cache.num_classes; cls++) {
+		struct k_obj_core *obj_core = K_OBJ_CORE(&cache.classes[cls]);
+		uint32_t served = (cls == 1) ? 1 : 0;
+
+		zassert_equal(k_obj_core_stats_raw(obj_core, &info,
+						   sizeof(info)), 0, NULL);
+		zassert_equal(info.hits + info.misses, served,
+			      "class %d served %u allocations", cls,
+			      info.hits + info.misses);
+		zassert_equal(info.fallbacks, 0, "class %d fallbacks", cls);
+		zassert_equal(info.failures, 0, "class %d failures", cls);
+
+		zassert_equal(k_obj_core_stats_query(obj_core, &after,
+						     sizeof(after)), 0, NULL);
+		zassert_equal(after.allocated_bytes,
+			      before[cls].allocated_bytes + served * MEDIUM_SZ,
+			      "class %d query allocated bytes", cls);
+	}
+
+	/* Oversized requests only count against the whole cache */
+	zassert_equal(k_obj_core_stats_raw(K_OBJ_CORE(&cache), &info,
+					   sizeof(info)), 0, NULL);
+	zassert_equal(info.failures, 1, "expected 1 failure, got %u",
+		      info.failures);
+#endif /* CONFIG_OBJ_CORE_STATS_MEM_CACHE */
+
+	k_mem_cache_free(&cache, obj);
+	k_mem_cache_flush(&cache);
+}
+
+#define WAITER_STACK_SIZE	(512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static K_THREAD_STACK_DEFINE(waiter_stack, WAITER_STACK_SIZE);
+static struct k_thread waiter_thread;
+static void *waiter_obj;
+
+static void waiter_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	waiter_obj = k_mem_cache_alloc(&cache, LARGE_SZ, K_FOREVER);
+}
+
+/**
+ * @brief Verify that an object freed to the cache wakes up a waiting thread
+ */
+ZTEST(mem_cache, test_mem_cache_waiter)
+{
+	void *large = k_mem_cache_alloc(&cache, LARGE_SZ, K_NO_WAIT);
+
+	zassert_not_null(large, "large class allocation failed");
+
+	waiter_obj = NULL;
+	k_thread_create(&waiter_thread, waiter_stack, WAITER_STACK_SIZE,
+			waiter_entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(10);
+	zassert_is_null(waiter_obj, "allocation from exhausted cache succeeded");
+
+	/* Cached for reuse by this CPU, but the waiter must get it */
+	k_mem_cache_free(&cache, large);
+	zassert_equal(k_thread_join(&waiter_thread, K_MSEC(100)), 0,
+		      "waiter not woken up");
+	zassert_equal_ptr(waiter_obj, large, "waiter not given the freed object");
+
+	k_mem_cache_free(&cache, waiter_obj);
+	k_mem_cache_flush(&cache);
+}
+
+/**
+ * @brief Verify run-time initialization of a memory cache
+ */
+ZTEST(mem_cache, test_mem_cache_init)
+{
+	static struct k_mem_cache dyn_cache;
+	/* Must outlive the cache, which links its classes to object cores */
+	static struct k_mem_cache_class sorted[] = { { .slab = &small_slab },
+						     { .slab = &large_slab } };
+	struct k_mem_cache_class unsorted[] = { { .slab = &large_slab },
+						{ .slab = &small_slab } };
+	void *obj;
+
+	zassert_equal(k_mem_cache_init(&dyn_cache, unsorted, ARRAY_SIZE(unsorted),
+				       NULL, NULL), -EINVAL, NULL);
+	zassert_equal(k_mem_cache_init(&dyn_cache, sorted, 0, NULL, NULL),
+		      -EINVAL, NULL);
+
+	zassert_equal(k_mem_cache_init(&dyn_cache, sorted, ARRAY_SIZE(sorted),
+				       NULL, NULL), 0, NULL);
+	obj = k_mem_cache_alloc(&dyn_cache, MEDIUM_SZ, K_NO_WAIT);
+	zassert_true(in_slab(&large_slab, obj), "not in large class");
+	k_mem_cache_free(&dyn_cache, obj);
+	k_mem_cache_flush(&dyn_cache);
+}
+
+ZTEST_SUITE(mem_cache, NULL, NULL, mem_cache_before, NULL, NULL);
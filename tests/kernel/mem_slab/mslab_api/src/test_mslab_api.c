@@ -182,6 +182,23 @@ static void helper_thread(void *p0, void *p1, void *p2)
 
 }  /* helper thread */
 
+static void helper_free_n_thread(void *p0, void *p1, void *p2)
+{
+	void **blocks = p0;
+	uint32_t count = POINTER_TO_UINT(p1);
+
+	ARG_UNUSED(p2);
+
+	/* One block short of the waiting request, nothing is taken */
+	k_msleep(10);
+	k_mem_slab_free_n(&mslab, blocks, count - 1);
+	k_msleep(10);
+	zassert_equal(k_mem_slab_num_free_get(&mslab), count - 1,
+		      "blocks held by an incomplete request");
+
+	k_mem_slab_free_n(&mslab, &blocks[count - 1], 1);
+}
+
 /*test cases*/
 /**
  * @brief Initialize the memory slab using k_mem_slab_init()
@@ -338,3 +355,62 @@ ZTEST(mslab_api, test_mslab_pending)
 	/* Free memory block */
 	k_mem_slab_free(&kmslab, b);
 }
+
+/**
+ * @brief Verify batched allocation and release of blocks
+ *
+ * @details Check that requesting more blocks than the slab holds with
+ * @see k_mem_slab_alloc_n() fails with -EINVAL, whether waiting or not.
+ * Request more blocks than are left and check that all available blocks
+ * are returned. Check that further requests fail with -ENOMEM
+ * or -EAGAIN, then check that a waiting request takes no block until
+ * enough are released with @see k_mem_slab_free_n() from another thread.
+ *
+ * @ingroup kernel_memory_slab_tests
+ */
+ZTEST(mslab_api, test_mslab_alloc_free_n)
+{
+	void *block[BLK_NUM + 1];
+	void *extra[2];
+	int ret;
+
+	zassert_equal(k_mem_slab_alloc_n(&mslab, block, BLK_NUM + 1, K_NO_WAIT),
+		      -EINVAL);
+	zassert_equal(k_mem_slab_alloc_n(&mslab, block, BLK_NUM + 1, K_FOREVER),
+		      -EINVAL);
+	zassert_equal(k_mem_slab_num_free_get(&mslab), BLK_NUM);
+
+	zassert_equal(k_mem_slab_alloc(&mslab, &block[0], K_NO_WAIT), 0);
+	ret = k_mem_slab_alloc_n(&mslab, &block[1], BLK_NUM, K_NO_WAIT);
+	zassert_equal(ret, BLK_NUM - 1, "Expected %d blocks, got %d",
+		      BLK_NUM - 1, ret);
+	zassert_equal(k_mem_slab_num_free_get(&mslab), 0);
+	for (int i = 0; i < BLK_NUM; i++) {
+		zassert_not_null(block[i], NULL);
+		for (int j = 0; j < i; j++) {
+			zassert_not_equal(block[i], block[j], "duplicate block");
+		}
+	}
+
+	zassert_equal(k_mem_slab_alloc_n(&mslab, extra, 1, K_NO_WAIT), -ENOMEM);
+	zassert_equal(k_mem_slab_alloc_n(&mslab, extra, 1, K_MSEC(10)), -EAGAIN);
+	zassert_equal(k_mem_slab_alloc_n(&mslab, extra, 0, K_NO_WAIT), 0);
+
+	if (IS_ENABLED(CONFIG_MULTITHREADING)) {
+		/* Two blocks are freed while this thread waits */
+		k_thread_create(&HELPER, stack, STACKSIZE, helper_free_n_thread,
+				block, UINT_TO_POINTER(2), NULL,
+				K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+		ret = k_mem_slab_alloc_n(&mslab, extra, 2, K_FOREVER);
+		zassert_equal(ret, 2, "Expected 2 blocks, got %d", ret);
+		k_thread_join(&HELPER, K_FOREVER);
+
+		block[0] = extra[0];
+		block[1] = extra[1];
+	}
+
+	k_mem_slab_free_n(&mslab, block, BLK_NUM);
+	zassert_equal(k_mem_slab_num_used_get(&mslab), 0);
+	zassert_equal(k_mem_slab_num_free_get(&mslab), BLK_NUM);
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+#define BATCH_LEN 5
+
+K_MSGQ_DEFINE(batch_msgq, sizeof(uint32_t), BATCH_LEN, 4);
+static K_THREAD_STACK_DEFINE(batch_stack, STACK_SIZE);
+static struct k_thread batch_thread;
+
+static uint32_t batch_tx[2 * BATCH_LEN];
+static uint32_t batch_rx[2 * BATCH_LEN];
+static int batch_result;
+
+static void batch_fill(uint32_t first)
+{
+	for (int i = 0; i < ARRAY_SIZE(batch_tx); i++) {
+		batch_tx[i] = first + i;
+	}
+	memset(batch_rx, 0, sizeof(batch_rx));
+}
+
+static void batch_put_entry(void *p1, void *p2, void *p3)
+{
+	batch_result = k_msgq_put_n(&batch_msgq, p1, POINTER_TO_UINT(p2),
+				    K_FOREVER);
+}
+
+static void batch_get_entry(void *p1, void *p2, void *p3)
+{
+	batch_result = k_msgq_get_n(&batch_msgq, p1, POINTER_TO_UINT(p2),
+				    K_FOREVER);
+}
+
+static void batch_spawn(k_thread_entry_t entry, void *buf, uint32_t num)
+{
+	k_thread_create(&batch_thread, batch_stack, STACK_SIZE, entry, buf,
+			UINT_TO_POINTER(num), NULL, K_PRIO_PREEMPT(0), 0,
+			K_NO_WAIT);
+	/* let it block on the message queue */
+	k_msleep(TIMEOUT_MS);
+}
+
+/**
+ * @brief Verify batch put and get across the end of the ring buffer
+ */
+ZTEST(msgq_api_1cpu, test_msgq_put_get_n)
+{
+	uint32_t msg;
+
+	k_msgq_purge(&batch_msgq);
+	batch_fill(100);
+
+	zassert_equal(k_msgq_put_n(&batch_msgq, batch_tx, 0, K_NO_WAIT), 0);
+	zassert_equal(k_msgq_get_n(&batch_msgq, batch_rx, 0, K_NO_WAIT), 0);
+
+	/* Move the ring pointers so that batches wrap around */
+	for (int i = 0; i < 3; i++) {
+		zassert_equal(k_msgq_put(&batch_msgq, &batch_tx[i], K_NO_WAIT), 0);
+		zassert_equal(k_msgq_get(&batch_msgq, &msg, K_NO_WAIT), 0);
+	}
+
+	zassert_equal(k_msgq_put_n(&batch_msgq, batch_tx, ARRAY_SIZE(batch_tx),
+				   K_NO_WAIT), BATCH_LEN);
+	zassert_equal(k_msgq_num_used_get(&batch_msgq), BATCH_LEN);
+	zassert_equal(k_msgq_put_n(&batch_msgq, batch_tx, 1, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_put_n(&batch_msgq, batch_tx, 1, TIMEOUT), -EAGAIN);
+
+	zassert_equal(k_msgq_get_n(&batch_msgq, batch_rx, 3, K_NO_WAIT), 3);
+	zassert_equal(k_msgq_get_n(&batch_msgq, &batch_rx[3],
+				   ARRAY_SIZE(batch_rx) - 3, K_NO_WAIT),
+		      BATCH_LEN - 3);
+	for (int i = 0; i < BATCH_LEN; i++) {
+		zassert_equal(batch_rx[i], batch_tx[i], "message %d is %u", i,
+			      batch_rx[i]);
+	}
+
+	zassert_equal(k_msgq_get_n(&batch_msgq, batch_rx, 1, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_get_n(&batch_msgq, batch_rx, 1, TIMEOUT), -EAGAIN);
+}
+
+/**
+ * @brief Verify that a batch get takes the messages of blocked senders
+ */
+ZTEST(msgq_api_1cpu, test_msgq_get_n_pending_sender)
+{
+	static uint32_t pending_tx[2] = { 0xdead, 0xbeef };
+
+	k_msgq_purge(&batch_msgq);
+	batch_fill(200);
+
+	zassert_equal(k_msgq_put_n(&batch_msgq, batch_tx, BATCH_LEN, K_NO_WAIT),
+		      BATCH_LEN);
+
+	/* Queue is full: the sender blocks for its first message only */
+	batch_spawn(batch_put_entry, pending_tx, ARRAY_SIZE(pending_tx));
+
+	zassert_equal(k_msgq_get_n(&batch_msgq, batch_rx, ARRAY_SIZE(batch_rx),
+				   K_NO_WAIT), BATCH_LEN + 1);
+	for (int i = 0; i < BATCH_LEN; i++) {
+		zassert_equal(batch_rx[i], batch_tx[i]);
+	}
+	zassert_equal(batch_rx[BATCH_LEN], pending_tx[0]);
+
+	k_thread_join(&batch_thread, K_FOREVER);
+	zassert_equal(batch_result, 1, "sender sent %d messages", batch_result);
+	zassert_equal(k_msgq_num_used_get(&batch_msgq), 0);
+}
+
+/**
+ * @brief Verify that a batch put hands messages to blocked receivers
+ */
+ZTEST(msgq_api_1cpu, test_msgq_put_n_pending_receiver)
+{
+	uint32_t msg;
+
+	k_msgq_purge(&batch_msgq);
+	batch_fill(300);
+
+	/* Queue is empty: the receiver blocks for a single message */
+	batch_spawn(batch_get_entry, batch_rx, ARRAY_SIZE(batch_rx));
+
+	zassert_equal(k_msgq_put_n(&batch_msgq, batch_tx, 3, K_NO_WAIT), 3);
+
+	k_thread_join(&batch_thread, K_FOREVER);
+	zassert_equal(batch_result, 1, "receiver got %d messages", batch_result);
+	zassert_equal(batch_rx[0], batch_tx[0]);
+
+	zassert_equal(k_msgq_num_used_get(&batch_msgq), 2);
+	for (int i = 1; i < 3; i++) {
+		zassert_equal(k_msgq_get(&batch_msgq, &msg, K_NO_WAIT), 0);
+		zassert_equal(msg, batch_tx[i]);
+	}
+}
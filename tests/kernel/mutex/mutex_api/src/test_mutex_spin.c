@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+
+#define SPIN_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define SPIN_MAIN_PRIO	K_PRIO_PREEMPT(1)
+#define SPIN_OWNER_PRIO	K_PRIO_PREEMPT(5)
+
+static K_THREAD_STACK_DEFINE(spin_stack, SPIN_STACK_SIZE);
+static struct k_thread spin_thread;
+static K_MUTEX_DEFINE(spin_mutex);
+static K_SEM_DEFINE(spin_sem, 0, 1);
+
+static int owner_prio;
+static int main_prio;
+
+/* Hold the mutex for p1 milliseconds, sleeping if p2 is set */
+static void owner_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p3);
+
+	k_mutex_lock(&spin_mutex, K_FOREVER);
+	k_sem_give(&spin_sem);
+
+	if (p2 != NULL) {
+		k_msleep(POINTER_TO_INT(p1));
+	} else {
+		k_busy_wait(POINTER_TO_INT(p1) * USEC_PER_MSEC);
+	}
+
+	owner_prio = k_thread_priority_get(k_current_get());
+	k_mutex_unlock(&spin_mutex);
+}
+
+static void owner_start(int ms, bool sleep)
+{
+	k_thread_priority_set(k_current_get(), SPIN_MAIN_PRIO);
+	owner_prio = 0;
+	k_thread_create(&spin_thread, spin_stack, SPIN_STACK_SIZE, owner_entry,
+			INT_TO_POINTER(ms), sleep ? INT_TO_POINTER(1) : NULL, NULL,
+			SPIN_OWNER_PRIO, 0, K_NO_WAIT);
+	k_sem_take(&spin_sem, K_FOREVER);
+}
+
+/**
+ * @brief Verify that a mutex released by an owner running on another CPU
+ * is taken
+ */
+ZTEST(mutex_spin, test_mutex_spin_running_owner)
+{
+	owner_start(1, false);
+
+	zassert_ok(k_mutex_lock(&spin_mutex, K_FOREVER));
+	zassert_ok(k_mutex_unlock(&spin_mutex));
+	zassert_ok(k_thread_join(&spin_thread, K_FOREVER));
+}
+
+/**
+ * @brief Verify that a thread stops spinning when the owner blocks, and
+ * that the owner inherits its priority
+ */
+ZTEST(mutex_spin, test_mutex_spin_sleeping_owner)
+{
+#ifdef CONFIG_SCHED_THREAD_USAGE
+	k_thread_runtime_stats_t before, after;
+#endif /* CONFIG_SCHED_THREAD_USAGE */
+
+	owner_start(50, true);
+
+#ifdef CONFIG_SCHED_THREAD_USAGE
+	k_thread_runtime_stats_get(k_current_get(), &before);
+#endif /* CONFIG_SCHED_THREAD_USAGE */
+	zassert_ok(k_mutex_lock(&spin_mutex, K_FOREVER));
+#ifdef CONFIG_SCHED_THREAD_USAGE
+	k_thread_runtime_stats_get(k_current_get(), &after);
+
+	/* Pended for the sleep instead of spinning through the budget */
+	zassert_true(after.execution_cycles - before.execution_cycles <
+		     CONFIG_MUTEX_SPIN_CYCLES / 2, "spun for %llu cycles",
+		     after.execution_cycles - before.execution_cycles);
+#endif /* CONFIG_SCHED_THREAD_USAGE */
+	zassert_equal(owner_prio, SPIN_MAIN_PRIO, "owner priority %d", owner_prio);
+	zassert_ok(k_mutex_unlock(&spin_mutex));
+	zassert_ok(k_thread_join(&spin_thread, K_FOREVER));
+}
+
+/**
+ * @brief Verify that spinning is bounded and that the timeout still
+ * applies to a long critical section
+ */
+ZTEST(mutex_spin, test_mutex_spin_timeout)
+{
+	int64_t start;
+
+	owner_start(200, false);
+
+	start = k_uptime_get();
+	zassert_equal(k_mutex_lock(&spin_mutex, K_MSEC(20)), -EAGAIN);
+	zassert_true(k_uptime_get() - start < 150, "spun for the whole critical section");
+
+	zassert_ok(k_thread_join(&spin_thread, K_FOREVER));
+	zassert_equal(owner_prio, SPIN_OWNER_PRIO, "owner priority %d", owner_prio);
+}
+
+static void mutex_spin_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	main_prio = k_thread_priority_get(k_current_get());
+}
+
+static void mutex_spin_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_thread_priority_set(k_current_get(), main_prio);
+}
+
+ZTEST_SUITE(mutex_spin, NULL, NULL, mutex_spin_before, mutex_spin_after, NULL);
+
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
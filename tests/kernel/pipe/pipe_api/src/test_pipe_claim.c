@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @brief Tests for direct access to the pipe buffer
+ * @ingroup kernel_pipe_tests
+ * @{
+ */
+
+#include <zephyr/ztest.h>
+
+#define CLAIM_PIPE_LEN	16
+#define CLAIM_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define CLAIM_TIMEOUT	K_MSEC(50)
+
+static unsigned char __aligned(4) claim_buf[CLAIM_PIPE_LEN];
+static struct k_pipe claim_pipe;
+static struct k_pipe bufferless;
+static K_THREAD_STACK_DEFINE(claim_stack, CLAIM_STACK_SIZE);
+static struct k_thread claim_thread;
+
+static const unsigned char claim_data[] = "0123456789abcdefghijklmnopqrstuv";
+static unsigned char claim_rx[CLAIM_PIPE_LEN];
+static size_t claim_bytes;
+static int claim_result;
+
+static void claim_reader_entry(void *p1, void *p2, void *p3)
+{
+	claim_result = k_pipe_get(&claim_pipe, claim_rx, POINTER_TO_UINT(p1),
+				  &claim_bytes, POINTER_TO_UINT(p1), K_FOREVER);
+}
+
+static void claim_writer_entry(void *p1, void *p2, void *p3)
+{
+	claim_result = k_pipe_put(&claim_pipe, claim_data, POINTER_TO_UINT(p1),
+				  &claim_bytes, POINTER_TO_UINT(p1), K_FOREVER);
+}
+
+static void claim_spawn(k_thread_entry_t entry, size_t len)
+{
+	k_thread_create(&claim_thread, claim_stack, CLAIM_STACK_SIZE, entry,
+			UINT_TO_POINTER(len), NULL, NULL, K_PRIO_PREEMPT(0), 0,
+			K_NO_WAIT);
+	/* let it block on the pipe */
+	k_sleep(CLAIM_TIMEOUT);
+}
+
+static void claim_reset(void)
+{
+	k_pipe_init(&claim_pipe, claim_buf, sizeof(claim_buf));
+	claim_result = 1;
+	claim_bytes = 0;
+	memset(claim_rx, 0, sizeof(claim_rx));
+}
+
+/**
+ * @brief Verify claims stop at the end of the ring buffer
+ */
+ZTEST(pipe_api_1cpu, test_pipe_claim_wrap)
+{
+	size_t bytes;
+	void *ptr;
+
+	claim_reset();
+
+	zassert_equal(k_pipe_put_claim(&bufferless, &ptr, 1, K_NO_WAIT), -ENOTSUP);
+	zassert_equal(k_pipe_get_claim(&bufferless, &ptr, 1, K_NO_WAIT), -ENOTSUP);
+	zassert_equal(k_pipe_put_finish(&claim_pipe, 0), -EINVAL);
+	zassert_equal(k_pipe_get_claim(&claim_pipe, &ptr, 1, K_NO_WAIT), -EIO);
+	zassert_equal(k_pipe_get_claim(&claim_pipe, &ptr, 1, CLAIM_TIMEOUT), -EAGAIN);
+
+	/* Move the buffer indices to the middle of the buffer */
+	zassert_ok(k_pipe_put(&claim_pipe, claim_data, 10, &bytes, 10, K_NO_WAIT));
+	zassert_ok(k_pipe_get(&claim_pipe, claim_rx, 10, &bytes, 10, K_NO_WAIT));
+
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &ptr, CLAIM_PIPE_LEN, K_NO_WAIT),
+		      CLAIM_PIPE_LEN - 10);
+	zassert_equal_ptr(ptr, &claim_buf[10]);
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &ptr, 1, K_NO_WAIT), -EBUSY);
+
+	/* The claimed space belongs to the claim, not to k_pipe_put() */
+	zassert_equal(k_pipe_put(&claim_pipe, claim_data, 1, &bytes, 1, K_NO_WAIT),
+		      -EIO);
+
+	memcpy(ptr, claim_data, 4);
+	zassert_ok(k_pipe_put_finish(&claim_pipe, 4));
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 4);
+
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &ptr, CLAIM_PIPE_LEN, K_NO_WAIT),
+		      CLAIM_PIPE_LEN - 14);
+	memcpy(ptr, &claim_data[4], 2);
+	zassert_ok(k_pipe_put_finish(&claim_pipe, 2));
+
+	/* The next claim wraps to the start of the buffer */
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &ptr, 3, K_NO_WAIT), 3);
+	zassert_equal_ptr(ptr, &claim_buf[0]);
+	memcpy(ptr, &claim_data[6], 3);
+	zassert_equal(k_pipe_put_finish(&claim_pipe, 4), -EINVAL);
+	zassert_ok(k_pipe_put_finish(&claim_pipe, 3));
+
+	zassert_equal(k_pipe_get_claim(&claim_pipe, &ptr, CLAIM_PIPE_LEN, K_NO_WAIT), 6);
+	zassert_mem_equal(ptr, claim_data, 6);
+	zassert_equal(k_pipe_get_claim(&claim_pipe, &ptr, 1, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_pipe_get(&claim_pipe, claim_rx, 1, &bytes, 1, K_NO_WAIT), -EIO);
+	zassert_ok(k_pipe_get_finish(&claim_pipe, 6));
+
+	zassert_ok(k_pipe_get(&claim_pipe, claim_rx, 3, &bytes, 3, K_NO_WAIT));
+	zassert_mem_equal(claim_rx, &claim_data[6], 3);
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 0);
+}
+
+/**
+ * @brief Verify finishing a write claim serves a blocked reader
+ */
+ZTEST(pipe_api_1cpu, test_pipe_claim_pending_reader)
+{
+	void *ptr;
+
+	claim_reset();
+
+	claim_spawn(claim_reader_entry, 8);
+
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &ptr, 12, K_NO_WAIT), 12);
+	memcpy(ptr, claim_data, 12);
+	zassert_ok(k_pipe_put_finish(&claim_pipe, 12));
+
+	k_thread_join(&claim_thread, K_FOREVER);
+	zassert_ok(claim_result);
+	zassert_equal(claim_bytes, 8);
+	zassert_mem_equal(claim_rx, claim_data, 8);
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 4);
+}
+
+/**
+ * @brief Verify finishing a read claim lets a blocked writer refill the pipe
+ */
+ZTEST(pipe_api_1cpu, test_pipe_claim_pending_writer)
+{
+	size_t bytes;
+	void *ptr;
+
+	claim_reset();
+
+	zassert_ok(k_pipe_put(&claim_pipe, claim_data, CLAIM_PIPE_LEN, &bytes,
+			      CLAIM_PIPE_LEN, K_NO_WAIT));
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &ptr, 1, CLAIM_TIMEOUT), -EAGAIN);
+
+	/* The pipe is full: the writer blocks */
+	claim_spawn(claim_writer_entry, 4);
+	zassert_equal(claim_result, 1);
+
+	zassert_equal(k_pipe_get_claim(&claim_pipe, &ptr, 4, K_NO_WAIT), 4);
+	zassert_mem_equal(ptr, claim_data, 4);
+	zassert_ok(k_pipe_get_finish(&claim_pipe, 4));
+
+	k_thread_join(&claim_thread, K_FOREVER);
+	zassert_ok(claim_result);
+	zassert_equal(claim_bytes, 4);
+	zassert_equal(k_pipe_read_avail(&claim_pipe), CLAIM_PIPE_LEN);
+
+	zassert_ok(k_pipe_get(&claim_pipe, claim_rx, CLAIM_PIPE_LEN, &bytes,
+			      CLAIM_PIPE_LEN, K_NO_WAIT));
+	zassert_mem_equal(claim_rx, &claim_data[4], CLAIM_PIPE_LEN - 4);
+	zassert_mem_equal(&claim_rx[CLAIM_PIPE_LEN - 4], claim_data, 4);
+}
+
+/**
+ * @}
+ */
@@ -15,12 +15,14 @@
 K_HEAP_DEFINE(test_heap, MAX_SZ * 4);
 extern void poll_test_grant_access(void);
 extern void poll_fail_grant_access(void);
+extern void poll_set_grant_access(void);
 
 /*test case main entry*/
 static void *poll_setup(void)
 {
 	poll_test_grant_access();
 	poll_fail_grant_access();
+	poll_set_grant_access();
 
 	k_thread_heap_assign(k_current_get(), &test_heap);
 
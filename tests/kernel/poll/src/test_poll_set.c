@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#define SET_SIZE 3
+#define SET_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+K_POLL_SET_DEFINE(test_set, SET_SIZE);
+K_SEM_DEFINE(set_sem_a, 0, 1);
+K_SEM_DEFINE(set_sem_b, 0, 1);
+K_SEM_DEFINE(set_sem_c, 0, 1);
+static struct k_poll_signal set_signal;
+
+static K_THREAD_STACK_DEFINE(set_stack, SET_STACK_SIZE);
+static struct k_thread set_thread;
+static struct k_poll_event set_thread_event;
+static int set_thread_result;
+
+static void set_clear(void)
+{
+	(void)k_poll_set_remove(&test_set, K_POLL_TYPE_SEM_AVAILABLE, &set_sem_a);
+	(void)k_poll_set_remove(&test_set, K_POLL_TYPE_SEM_AVAILABLE, &set_sem_b);
+	(void)k_poll_set_remove(&test_set, K_POLL_TYPE_SEM_AVAILABLE, &set_sem_c);
+	(void)k_poll_set_remove(&test_set, K_POLL_TYPE_SIGNAL, &set_signal);
+	k_sem_reset(&set_sem_a);
+	k_sem_reset(&set_sem_b);
+	k_sem_reset(&set_sem_c);
+	k_poll_signal_reset(&set_signal);
+}
+
+/**
+ * @brief Test level triggered events of a poll set
+ *
+ * @ingroup kernel_poll_tests
+ */
+ZTEST_USER(poll_api_1cpu, test_poll_set_level)
+{
+	struct k_poll_event events[SET_SIZE];
+
+	set_clear();
+
+	zassert_ok(k_poll_set_add(&test_set, K_POLL_TYPE_SEM_AVAILABLE,
+				  &set_sem_a, 1, 0));
+	zassert_ok(k_poll_set_add(&test_set, K_POLL_TYPE_SEM_AVAILABLE,
+				  &set_sem_b, 2, 0));
+	zassert_equal(k_poll_set_add(&test_set, K_POLL_TYPE_SEM_AVAILABLE,
+				     &set_sem_a, 1, 0), -EEXIST);
+	zassert_equal(k_poll_set_add(&test_set, K_POLL_TYPE_IGNORE,
+				     &set_sem_c, 3, 0), -EINVAL);
+	zassert_ok(k_poll_set_add(&test_set, K_POLL_TYPE_SEM_AVAILABLE,
+				  &set_sem_c, 3, 0));
+	zassert_equal(k_poll_set_add(&test_set, K_POLL_TYPE_SIGNAL,
+				     &set_signal, 4, 0), -ENOMEM);
+
+	zassert_equal(k_poll_set_wait(&test_set, events, SET_SIZE, K_NO_WAIT),
+		      -EAGAIN);
+
+	k_sem_give(&set_sem_b);
+	zassert_equal(k_poll_set_wait(&test_set, events, SET_SIZE, K_NO_WAIT), 1);
+	zassert_equal(events[0].tag, 2);
+	zassert_equal(events[0].state, K_POLL_STATE_SEM_AVAILABLE);
+	zassert_equal_ptr(events[0].sem, &set_sem_b);
+
+	/* Still ready until the semaphore is taken */
+	zassert_equal(k_poll_set_wait(&test_set, events, SET_SIZE, K_NO_WAIT), 1);
+	zassert_equal_ptr(events[0].sem, &set_sem_b);
+	zassert_ok(k_sem_take(&set_sem_b, K_NO_WAIT));
+	zassert_equal(k_poll_set_wait(&test_set, events, SET_SIZE, K_NO_WAIT),
+		      -EAGAIN);
+
+	/* Ready events that do not fit are reported by the next call */
+	k_sem_give(&set_sem_a);
+	k_sem_give(&set_sem_c);
+	zassert_equal(k_poll_set_wait(&test_set, events, 1, K_NO_WAIT), 1);
+	zassert_equal_ptr(events[0].sem, &set_sem_a);
+	zassert_equal(k_poll_set_wait(&test_set, events, 1, K_NO_WAIT), 1);
+	zassert_equal_ptr(events[0].sem, &set_sem_c);
+
+	zassert_ok(k_poll_set_remove(&test_set, K_POLL_TYPE_SEM_AVAILABLE,
+				     &set_sem_a));
+	zassert_equal(k_poll_set_remove(&test_set, K_POLL_TYPE_SEM_AVAILABLE,
+					&set_sem_a), -ENOENT);
+	zassert_equal(k_poll_set_wait(&test_set, events, SET_SIZE, K_NO_WAIT), 1);
+	zassert_equal_ptr(events[0].sem, &set_sem_c);
+}
+
+/**
+ * @brief Test edge triggered events of a poll set
+ *
+ * @ingroup kernel_poll_tests
+ */
+ZTEST_USER(poll_api_1cpu, test_poll_set_edge)
+{
+	struct k_poll_event events[SET_SIZE];
+
+	set_clear();
+
+	zassert_ok(k_poll_set_add(&test_set, K_POLL_TYPE_SIGNAL, &set_signal, 7,
+				  K_POLL_SET_EDGE));
+	zassert_equal(k_poll_set_wait(&test_set, events, SET_SIZE, K_NO_WAIT),
+		      -EAGAIN);
+
+	for (int i = 0; i < 2; i++) {
+		zassert_ok(k_poll_signal_raise(&set_signal, i));
+		zassert_equal(k_poll_set_wait(&test_set, events, SET_SIZE,
+					      K_NO_WAIT), 1);
+		zassert_equal(events[0].tag, 7);
+		zassert_equal(events[0].state, K_POLL_STATE_SIGNALED);
+
+		/* Reported once although the signal stays raised */
+		zassert_equal(k_poll_set_wait(&test_set, events, SET_SIZE,
+					      K_NO_WAIT), -EAGAIN);
+	}
+}
+
+static void set_waiter(void *p1, void *p2, void *p3)
+{
+	set_thread_result = k_poll_set_wait(&test_set, &set_thread_event, 1,
+					    K_FOREVER);
+}
+
+/**
+ * @brief Test that a thread waiting on a poll set is woken by its events
+ *
+ * @ingroup kernel_poll_tests
+ */
+ZTEST(poll_api_1cpu, test_poll_set_wait)
+{
+	struct k_poll_event events[SET_SIZE];
+
+	set_clear();
+
+	zassert_ok(k_poll_set_add(&test_set, K_POLL_TYPE_SEM_AVAILABLE,
+				  &set_sem_a, 1, 0));
+	zassert_ok(k_poll_set_add(&test_set, K_POLL_TYPE_SEM_AVAILABLE,
+				  &set_sem_b, 2, 0));
+	zassert_equal(k_poll_set_wait(&test_set, events, SET_SIZE, K_MSEC(50)),
+		      -EAGAIN);
+
+	k_thread_create(&set_thread, set_stack, SET_STACK_SIZE, set_waiter,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_sleep(K_MSEC(50));
+
+	/* The registrations survive the wait that timed out */
+	k_sem_give(&set_sem_b);
+	k_thread_join(&set_thread, K_FOREVER);
+
+	zassert_equal(set_thread_result, 1);
+	zassert_equal(set_thread_event.tag, 2);
+	zassert_equal_ptr(set_thread_event.sem, &set_sem_b);
+	zassert_equal(k_sem_count_get(&set_sem_b), 1);
+}
+
+void poll_set_grant_access(void)
+{
+	k_poll_signal_init(&set_signal);
+	k_thread_access_grant(k_current_get(), &test_set, &set_sem_a,
+			      &set_sem_b, &set_sem_c, &set_signal);
+}
@@ -757,6 +757,187 @@ ZTEST(smp, test_smp_ipi)
 }
 #endif
 
+#ifdef CONFIG_ARCH_HAS_DIRECTED_IPIS
+/**
+ * @brief Test directed scheduler IPIs
+ *
+ * @ingroup kernel_smp_integration_tests
+ *
+ * @details Send a scheduler IPI to each other CPU in turn with
+ * arch_sched_directed_ipi() and check that it was received.
+ *
+ * @see arch_sched_directed_ipi()
+ */
+ZTEST(smp, test_smp_directed_ipi)
+{
+#ifndef CONFIG_TRACE_SCHED_IPI
+	ztest_test_skip();
+#endif
+
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		unsigned int key = arch_irq_lock();
+		bool self = (i == _current_cpu->id);
+
+		sched_ipi_has_called = 0;
+		arch_sched_directed_ipi(BIT(i));
+		arch_irq_unlock(key);
+
+		k_msleep(100);
+
+		if (!self) {
+			zassert_true(sched_ipi_has_called != 0,
+				     "CPU %u did not receive IPI", i);
+		}
+	}
+}
+#endif /* CONFIG_ARCH_HAS_DIRECTED_IPIS */
+
+#ifdef CONFIG_SCHED_IPI_STATS
+/**
+ * @brief Test scheduler IPI statistics
+ *
+ * @ingroup kernel_smp_integration_tests
+ *
+ * @details Wake a thread that other CPUs may run and check that the
+ * IPIs it caused are accounted for in the CPU runtime statistics.
+ */
+ZTEST(smp, test_smp_ipi_stats)
+{
+	k_thread_runtime_stats_t before, after;
+	unsigned int num_cpus = arch_num_cpus();
+	int prio = k_thread_priority_get(k_current_get());
+	k_tid_t tid;
+
+	zassert_ok(k_thread_runtime_stats_all_get(&before));
+
+	for (int i = 0; i < 10; i++) {
+		tid = k_thread_create(&t2, t2_stack,
+					      T2_STACK_SIZE, thread_entry_fn,
+					      NULL, NULL, NULL,
+					      K_PRIO_COOP(2), 0, K_NO_WAIT);
+
+		k_thread_join(tid, K_FOREVER);
+	}
+
+	zassert_ok(k_thread_runtime_stats_all_get(&after));
+
+	zassert_true((after.ipis_sent + after.ipis_avoided) >
+		     (before.ipis_sent + before.ipis_avoided),
+		     "no IPI accounted for");
+	zassert_true(after.ipis_sent >= before.ipis_sent, "");
+	zassert_true(after.ipis_avoided >= before.ipis_avoided, "");
+
+	if (!IS_ENABLED(CONFIG_IPI_OPTIMIZE)) {
+		return;
+	}
+
+	/* Keep every other CPU busy with a cooperative thread, so that
+	 * waking a preemptible one needs no IPI at all.
+	 */
+	k_thread_priority_set(k_current_get(), K_PRIO_COOP(0));
+
+	for (unsigned int i = 0; i < num_cpus - 1; i++) {
+		tinfo[i].tid = k_thread_create(&tthread[i], tstack[i],
+					       STACK_SIZE, thread_entry_fn,
+					       INT_TO_POINTER(i), NULL, NULL,
+					       K_PRIO_COOP(1), 0, K_NO_WAIT);
+	}
+	k_busy_wait(DELAY_US / 2);
+
+	zassert_ok(k_thread_runtime_stats_all_get(&before));
+
+	tid = k_thread_create(&t2, t2_stack, T2_STACK_SIZE, thread_entry_fn,
+			      INT_TO_POINTER(num_cpus - 1), NULL, NULL,
+			      K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+
+	zassert_ok(k_thread_runtime_stats_all_get(&after));
+
+	zassert_true(after.ipis_avoided >= before.ipis_avoided + num_cpus - 1,
+		     "CPUs spared by an empty IPI mask not accounted for");
+
+	k_thread_priority_set(k_current_get(), prio);
+
+	for (unsigned int i = 0; i < num_cpus - 1; i++) {
+		k_thread_join(tinfo[i].tid, K_FOREVER);
+	}
+	k_thread_join(tid, K_FOREVER);
+}
+#endif /* CONFIG_SCHED_IPI_STATS */
+
+#ifdef CONFIG_CPU_DOMAINS
+static volatile int domain_thread_cpu;
+
+static void domain_thread_entry(void *p1, void *p2, void *p3)
+{
+	domain_thread_cpu = curr_cpu();
+}
+
+/**
+ * @brief Test cache domain hints
+ *
+ * @ingroup kernel_smp_integration_tests
+ *
+ * @details Check the CPU domain API, then give a thread the domain of
+ * a CPU other than the current one and check that it is queued, and
+ * so run, on that CPU rather than on the one that started it.
+ */
+ZTEST(smp, test_cpu_domain_hint)
+{
+	int cpu = curr_cpu();
+	int other = (cpu + 1) % arch_num_cpus();
+	int domain = k_cpu_domain_get(other);
+	k_tid_t tid;
+
+	zassert_equal(k_cpu_domain_get(-1), -EINVAL, "");
+	zassert_equal(k_cpu_domain_get(arch_num_cpus()), -EINVAL, "");
+	zassert_true(k_cpu_domain_count() >= 1, "no domain");
+	for (int i = 0; i < arch_num_cpus(); i++) {
+		zassert_true(k_cpu_domain_get(i) < k_cpu_domain_count(),
+			     "cpu %d domain out of range", i);
+	}
+
+	zassert_equal(k_thread_domain_set(k_current_get(), 0), -EINVAL,
+		      "hint changed on a runnable thread");
+
+	tid = k_thread_create(&t2, t2_stack, T2_STACK_SIZE,
+			      domain_thread_entry, NULL, NULL, NULL,
+			      k_thread_priority_get(k_current_get()),
+			      0, K_FOREVER);
+
+	zassert_equal(k_thread_domain_set(tid, k_cpu_domain_count()),
+		      -EINVAL, "bad domain accepted");
+	zassert_ok(k_thread_domain_set(tid, K_CPU_DOMAIN_ANY));
+	zassert_ok(k_thread_domain_set(tid, domain));
+
+	if (!IS_ENABLED(CONFIG_SCHED_PER_CPU_RUNQ) ||
+	    !IS_ENABLED(CONFIG_SCHED_IPI_SUPPORTED) ||
+	    (domain == k_cpu_domain_get(cpu))) {
+		/* The hint can only be seen at work when the thread
+		 * is queued on a CPU that runs nothing else and is
+		 * told about it.
+		 */
+		k_thread_start(tid);
+		k_thread_join(tid, K_FOREVER);
+		ztest_test_skip();
+	}
+
+	domain_thread_cpu = -1;
+
+	/* Equal priority, so this CPU does not preempt itself to steal
+	 * the thread while the hinted CPU idles.
+	 */
+	k_thread_start(tid);
+	k_busy_wait(DELAY_US);
+	k_thread_join(tid, K_FOREVER);
+
+	zassert_equal(k_cpu_domain_get(domain_thread_cpu), domain,
+		      "thread ran on cpu %d outside its domain",
+		      domain_thread_cpu);
+}
+#endif /* CONFIG_CPU_DOMAINS */
+
 void k_sys_fatal_error_handler(unsigned int reason, const z_arch_esf_t *esf)
 {
 	static int trigger;
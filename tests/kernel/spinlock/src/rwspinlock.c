@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+
+#define RW_STACK_SIZE	1024
+#define RW_LOOPS	10000
+#define RW_WAIT_US	10000
+
+static K_THREAD_STACK_DEFINE(rw_stack, RW_STACK_SIZE);
+static struct k_thread rw_thread;
+
+static struct k_rwspinlock rwlock;
+static struct k_seqlock seqlock;
+
+static volatile int rw_go, rw_done;
+static volatile uint32_t data_a, data_b;
+
+static void rw_start(k_thread_entry_t entry, void *arg)
+{
+	rw_go = 0;
+	rw_done = 0;
+	data_a = 0;
+	data_b = 0;
+
+	k_thread_create(&rw_thread, rw_stack, RW_STACK_SIZE, entry,
+			arg, NULL, NULL, 0, 0, K_NO_WAIT);
+}
+
+/* Wait up to RW_WAIT_US for the other CPU to be done */
+static bool rw_wait_done(void)
+{
+	for (int i = 0; i < RW_WAIT_US && !rw_done; i++) {
+		k_busy_wait(1);
+	}
+
+	return rw_done;
+}
+
+static void reader_fn(void *p1, void *p2, void *p3)
+{
+	k_spinlock_key_t key;
+
+	while (!rw_go) {
+	}
+
+	key = k_rwspin_read_lock(&rwlock);
+	rw_done = 1;
+	k_rwspin_read_unlock(&rwlock, key);
+}
+
+static void writer_fn(void *p1, void *p2, void *p3)
+{
+	k_spinlock_key_t key;
+
+	while (!rw_go) {
+	}
+
+	key = k_rwspin_write_lock(&rwlock);
+	rw_done = 1;
+	k_rwspin_write_unlock(&rwlock, key);
+}
+
+/**
+ * @brief Test that readers share a reader-writer spinlock
+ *
+ * @ingroup kernel_spinlock_tests
+ *
+ * @see k_rwspin_read_lock(), k_rwspin_read_unlock()
+ */
+ZTEST(rwspinlock, test_rwspinlock_shared_read)
+{
+	k_spinlock_key_t key;
+
+	rw_start(reader_fn, NULL);
+
+	key = k_rwspin_read_lock(&rwlock);
+	rw_go = 1;
+	zassert_true(rw_wait_done(), "reader excluded by another reader");
+	k_rwspin_read_unlock(&rwlock, key);
+
+	k_thread_join(&rw_thread, K_FOREVER);
+}
+
+/**
+ * @brief Test that writers wait for readers and exclude them
+ *
+ * @ingroup kernel_spinlock_tests
+ *
+ * @see k_rwspin_write_lock(), k_rwspin_write_unlock()
+ */
+ZTEST(rwspinlock, test_rwspinlock_exclusive_write)
+{
+	k_spinlock_key_t key;
+
+	rw_start(writer_fn, NULL);
+
+	key = k_rwspin_read_lock(&rwlock);
+	rw_go = 1;
+	zassert_false(rw_wait_done(), "writer got in along with a reader");
+	k_rwspin_read_unlock(&rwlock, key);
+
+	k_thread_join(&rw_thread, K_FOREVER);
+	zassert_true(rw_done);
+
+	rw_start(reader_fn, NULL);
+
+	key = k_rwspin_write_lock(&rwlock);
+	rw_go = 1;
+	zassert_false(rw_wait_done(), "reader got in along with a writer");
+	k_rwspin_write_unlock(&rwlock, key);
+
+	k_thread_join(&rw_thread, K_FOREVER);
+	zassert_true(rw_done);
+}
+
+static void rw_updater_fn(void *p1, void *p2, void *p3)
+{
+	bool seq = POINTER_TO_INT(p1);
+
+	for (int i = 0; i < RW_LOOPS; i++) {
+		k_spinlock_key_t key;
+
+		if (seq) {
+			key = k_seqlock_write_lock(&seqlock);
+		} else {
+			key = k_rwspin_write_lock(&rwlock);
+		}
+
+		data_a++;
+		data_b++;
+
+		if (seq) {
+			k_seqlock_write_unlock(&seqlock, key);
+		} else {
+			k_rwspin_write_unlock(&rwlock, key);
+		}
+	}
+
+	rw_done = 1;
+}
+
+/**
+ * @brief Test that readers never see a partial update
+ *
+ * @ingroup kernel_spinlock_tests
+ *
+ * @see k_rwspin_read_lock(), k_rwspin_write_lock()
+ */
+ZTEST(rwspinlock, test_rwspinlock_consistency)
+{
+	rw_start(rw_updater_fn, INT_TO_POINTER(false));
+
+	while (!rw_done) {
+		k_spinlock_key_t key = k_rwspin_read_lock(&rwlock);
+		uint32_t a = data_a, b = data_b;
+
+		k_rwspin_read_unlock(&rwlock, key);
+		zassert_equal(a, b, "torn read %u/%u", a, b);
+	}
+
+	k_thread_join(&rw_thread, K_FOREVER);
+	zassert_equal(data_a, RW_LOOPS);
+}
+
+/**
+ * @brief Test that sequence lock readers retry on concurrent updates
+ *
+ * @ingroup kernel_spinlock_tests
+ *
+ * @see k_seqlock_read_begin(), k_seqlock_read_retry()
+ */
+ZTEST(rwspinlock, test_seqlock_consistency)
+{
+	uint32_t a, b, seq;
+
+	rw_start(rw_updater_fn, INT_TO_POINTER(true));
+
+	while (!rw_done) {
+		do {
+			seq = k_seqlock_read_begin(&seqlock);
+			a = data_a;
+			b = data_b;
+		} while (k_seqlock_read_retry(&seqlock, seq));
+
+		zassert_equal(a, b, "torn read %u/%u", a, b);
+	}
+
+	k_thread_join(&rw_thread, K_FOREVER);
+	zassert_equal(data_a, RW_LOOPS);
+
+	/* A read section overlapping a write section must be retried */
+	k_spinlock_key_t key;
+
+	seq = k_seqlock_read_begin(&seqlock);
+	zassert_false(k_seqlock_read_retry(&seqlock, seq),
+		      "retry without a write section");
+
+	key = k_seqlock_write_lock(&seqlock);
+	zassert_true(k_seqlock_read_retry(&seqlock, seq),
+		     "no retry during a write section");
+	k_seqlock_write_unlock(&seqlock, key);
+	zassert_true(k_seqlock_read_retry(&seqlock, seq),
+		     "no retry after a write section");
+}
+
+ZTEST_SUITE(rwspinlock, NULL, NULL, NULL, NULL, NULL);
@@ -168,6 +168,101 @@ ZTEST(dynamic_thread_stack, test_dynamic_thread_stack_alloc)
 	}
 }
 
+static K_SEM_DEFINE(hold_sem, 0, 1);
+
+static void hold_func(void *arg1, void *arg2, void *arg3)
+{
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	k_sem_take(&hold_sem, K_FOREVER);
+	func(arg1, NULL, NULL);
+}
+
+static size_t hold_run(k_thread_stack_t *stack, size_t size, bool check_busy)
+{
+	static struct k_thread th;
+	size_t unused;
+	k_tid_t tid;
+
+	tflag[0] = false;
+	tid = k_thread_create(&th, stack, size, hold_func, &tflag[0], NULL, NULL,
+			      0, 0, K_NO_WAIT);
+
+	if (check_busy) {
+		/* the thread is blocked: its stack must not be released */
+		k_msleep(10);
+		zassert_equal(k_thread_stack_free(stack), -EBUSY);
+	}
+
+	k_sem_give(&hold_sem);
+	zassert_ok(k_thread_join(tid, K_MSEC(TIMEOUT_MS)));
+	zassert_true(tflag[0]);
+	zassert_ok(k_thread_stack_space_get(tid, &unused));
+
+	return unused;
+}
+
+/** @brief Exercise the size classes of the pool-based thread stack allocator */
+ZTEST(dynamic_thread_stack, test_dynamic_thread_stack_pool_classes)
+{
+	static k_thread_stack_t *small[MAX(CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE, 1)];
+	k_thread_stack_t *stack, *other;
+	size_t unused, reused;
+
+	if (!IS_ENABLED(CONFIG_DYNAMIC_THREAD_PREFER_POOL)) {
+		ztest_test_skip();
+	}
+
+	if ((CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE == 0) ||
+	    (CONFIG_DYNAMIC_THREAD_POOL_SIZE == 0)) {
+		ztest_test_skip();
+	}
+
+	/* small requests drain the small stacks first */
+	for (size_t i = 0; i < CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE; ++i) {
+		small[i] = k_thread_stack_alloc(CONFIG_DYNAMIC_THREAD_SMALL_STACK_SIZE, 0);
+		zassert_not_null(small[i]);
+	}
+
+	/* and then fall back to the larger ones */
+	stack = k_thread_stack_alloc(CONFIG_DYNAMIC_THREAD_SMALL_STACK_SIZE, 0);
+	zassert_not_null(stack);
+	for (size_t i = 0; i < CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE; ++i) {
+		zassert_not_equal(stack, small[i]);
+	}
+	zassert_ok(k_thread_stack_free(stack));
+
+	/* a released stack is the next one handed out for its class */
+	stack = small[0];
+	zassert_ok(k_thread_stack_free(stack));
+	zassert_equal(k_thread_stack_free(stack), -EINVAL);
+	zassert_equal(k_thread_stack_alloc(CONFIG_DYNAMIC_THREAD_SMALL_STACK_SIZE, 0),
+		      stack);
+
+	/* large requests never get a small stack */
+	other = k_thread_stack_alloc(CONFIG_DYNAMIC_THREAD_SMALL_STACK_SIZE + 1, 0);
+	zassert_not_null(other);
+	for (size_t i = 0; i < CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE; ++i) {
+		zassert_not_equal(other, small[i]);
+	}
+	zassert_ok(k_thread_stack_free(other));
+
+	/* a stack is in use until its thread exits, and a recycled stack
+	 * reports the usage of its new thread only
+	 */
+	unused = hold_run(stack, CONFIG_DYNAMIC_THREAD_SMALL_STACK_SIZE, true);
+	zassert_ok(k_thread_stack_free(stack));
+	zassert_equal(k_thread_stack_alloc(CONFIG_DYNAMIC_THREAD_SMALL_STACK_SIZE, 0),
+		      stack);
+	reused = hold_run(stack, CONFIG_DYNAMIC_THREAD_SMALL_STACK_SIZE, false);
+	zassert_within(reused, unused, 64, "unused %zu, was %zu", reused, unused);
+
+	for (size_t i = 0; i < CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE; ++i) {
+		zassert_ok(k_thread_stack_free(small[i]));
+	}
+}
+
 static void *dynamic_thread_stack_setup(void)
 {
 	k_thread_heap_assign(k_current_get(), &stack_heap);
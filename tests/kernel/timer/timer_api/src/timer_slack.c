@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#ifdef CONFIG_TIMEOUT_SLACK
+
+#define SLACK_PERIODS 4
+
+static struct k_timer strict_timer;
+static struct k_timer slack_timer;
+static struct k_work_delayable slack_work;
+
+static int64_t strict_tick;
+static int64_t slack_tick;
+static int64_t work_tick;
+static int64_t period_ticks[SLACK_PERIODS];
+static int periods;
+
+static void strict_expire(struct k_timer *timer)
+{
+	strict_tick = k_uptime_ticks();
+}
+
+static void slack_expire(struct k_timer *timer)
+{
+	slack_tick = k_uptime_ticks();
+}
+
+static void periodic_expire(struct k_timer *timer)
+{
+	if (periods < SLACK_PERIODS) {
+		period_ticks[periods++] = k_uptime_ticks();
+	}
+}
+
+static void slack_work_handler(struct k_work *work)
+{
+	work_tick = k_uptime_ticks();
+}
+
+static void *slack_setup(void)
+{
+	k_timer_init(&strict_timer, strict_expire, NULL);
+	k_timer_init(&slack_timer, slack_expire, NULL);
+	k_work_init_delayable(&slack_work, slack_work_handler);
+
+	return NULL;
+}
+
+static void slack_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	strict_tick = 0;
+	slack_tick = 0;
+	work_tick = 0;
+	periods = 0;
+
+	/* tick align */
+	k_usleep(1);
+}
+
+/**
+ * @brief Verify that a timer expires along with another one within its slack
+ */
+ZTEST(timer_slack, test_timer_slack_merge)
+{
+	uint32_t merged = sys_clock_merged_wakeups_get();
+
+	/* A ticked kernel announces every tick, there is nothing to merge */
+	Z_TEST_SKIP_IFNDEF(CONFIG_TICKLESS_KERNEL);
+
+	k_timer_start(&strict_timer, K_MSEC(100), K_NO_WAIT);
+	k_timer_start_slack(&slack_timer, K_MSEC(60), K_NO_WAIT, K_MSEC(60));
+
+	/* Reported expiry is the end of the slack window */
+	zassert_true(k_timer_expires_ticks(&slack_timer) >
+		     k_timer_expires_ticks(&strict_timer));
+
+	k_msleep(150);
+
+	zassert_not_equal(strict_tick, 0, "strict timer did not expire");
+	zassert_equal(slack_tick, strict_tick,
+		      "slack timer expired at %lld, not with strict timer at %lld",
+		      slack_tick, strict_tick);
+	zassert_true(sys_clock_merged_wakeups_get() > merged,
+		     "merged wakeup not counted");
+}
+
+/**
+ * @brief Verify that a timer without competition expires at its deadline
+ */
+ZTEST(timer_slack, test_timer_slack_deadline)
+{
+	int64_t start = k_uptime_ticks();
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_TICKLESS_KERNEL);
+
+	k_timer_start_slack(&slack_timer, K_MSEC(50), K_NO_WAIT, K_MSEC(20));
+	k_msleep(100);
+
+	zassert_true(slack_tick >= start + k_ms_to_ticks_ceil64(50),
+		     "slack timer expired early");
+	zassert_true(slack_tick <= start + k_ms_to_ticks_ceil64(70) + 1,
+		     "slack timer expired past its slack");
+}
+
+/**
+ * @brief Verify that periodic expiries keep their nominal stride
+ */
+ZTEST(timer_slack, test_timer_slack_periodic)
+{
+	k_ticks_t period = k_ms_to_ticks_ceil32(50);
+
+	k_timer_init(&slack_timer, periodic_expire, NULL);
+	k_timer_start_slack(&slack_timer, K_TICKS(period), K_TICKS(period),
+			    K_MSEC(20));
+	k_msleep(50 * (SLACK_PERIODS + 1));
+	k_timer_stop(&slack_timer);
+	k_timer_init(&slack_timer, slack_expire, NULL);
+
+	zassert_equal(periods, SLACK_PERIODS, "%d expiries", periods);
+	for (int i = 1; i < SLACK_PERIODS; i++) {
+		zassert_equal(period_ticks[i] - period_ticks[0], i * period,
+			      "expiry %d drifted: %lld ticks after the first",
+			      i, period_ticks[i] - period_ticks[0]);
+	}
+}
+
+/**
+ * @brief Verify that delayable work with slack shares a timer wakeup
+ */
+ZTEST(timer_slack, test_work_schedule_slack)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_TICKLESS_KERNEL);
+
+	k_timer_start(&strict_timer, K_MSEC(100), K_NO_WAIT);
+	zassert_equal(k_work_schedule_slack(&slack_work, K_MSEC(60), K_MSEC(60)), 1);
+
+	k_msleep(150);
+
+	zassert_not_equal(work_tick, 0, "work did not run");
+	zassert_true(work_tick >= strict_tick,
+		     "work ran at %lld, before the timer at %lld",
+		     work_tick, strict_tick);
+}
+
+ZTEST_SUITE(timer_slack, NULL, slack_setup, slack_before, NULL, NULL);
+
+#endif /* CONFIG_TIMEOUT_SLACK */
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+/* Work queues serviced by several threads */
+
+#define POOL_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define POOL_PRIORITY K_PRIO_PREEMPT(1)
+#define POOL_WORKERS 3
+#define SETTLE_TIME K_MSEC(20)
+
+static K_THREAD_STACK_DEFINE(pool_stack, POOL_STACK_SIZE);
+K_WORK_QUEUE_WORKERS_DEFINE(pool_workers, POOL_WORKERS - 1, POOL_STACK_SIZE);
+static struct k_work_q pool_queue;
+
+static struct k_work pool_work[POOL_WORKERS];
+static struct k_work_sync pool_sync;
+
+/* Given by the test to let one handler complete */
+static K_SEM_DEFINE(pool_rel_sem, 0, POOL_WORKERS);
+/* Given by a handler on completion */
+static K_SEM_DEFINE(pool_done_sem, 0, POOL_WORKERS);
+
+static atomic_t pool_running;
+static atomic_t pool_max_running;
+static atomic_t pool_runs;
+
+static void pool_handler(struct k_work *work)
+{
+	atomic_val_t running = atomic_inc(&pool_running) + 1;
+	atomic_val_t max;
+
+	do {
+		max = atomic_get(&pool_max_running);
+	} while ((running > max) &&
+		 !atomic_cas(&pool_max_running, max, running));
+
+	(void)k_sem_take(&pool_rel_sem, K_FOREVER);
+
+	atomic_inc(&pool_runs);
+	atomic_dec(&pool_running);
+	k_sem_give(&pool_done_sem);
+}
+
+static void pool_release_cb(struct k_timer *timer)
+{
+	k_sem_give(&pool_rel_sem);
+}
+
+static K_TIMER_DEFINE(pool_releaser, pool_release_cb, NULL);
+
+static void *pool_setup(void)
+{
+	struct k_work_queue_config cfg = {
+		.name = "wq.pool",
+		.num_workers = POOL_WORKERS,
+		.workers = &pool_workers,
+	};
+
+	k_work_queue_start(&pool_queue, pool_stack, K_THREAD_STACK_SIZEOF(pool_stack),
+			   POOL_PRIORITY, &cfg);
+
+	for (int i = 0; i < POOL_WORKERS; i++) {
+		k_work_init(&pool_work[i], pool_handler);
+	}
+
+	return NULL;
+}
+
+static void pool_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	atomic_set(&pool_running, 0);
+	atomic_set(&pool_max_running, 0);
+	atomic_set(&pool_runs, 0);
+}
+
+/* Distinct items run concurrently on distinct workers. */
+ZTEST(work_pool, test_pool_concurrent)
+{
+	for (int i = 0; i < POOL_WORKERS; i++) {
+		zassert_equal(k_work_submit_to_queue(&pool_queue, &pool_work[i]), 1);
+	}
+
+	k_sleep(SETTLE_TIME);
+	zassert_equal(atomic_get(&pool_running), POOL_WORKERS,
+		      "%ld of %d items running", atomic_get(&pool_running),
+		      POOL_WORKERS);
+
+	for (int i = 0; i < POOL_WORKERS; i++) {
+		k_sem_give(&pool_rel_sem);
+	}
+	for (int i = 0; i < POOL_WORKERS; i++) {
+		zassert_equal(k_sem_take(&pool_done_sem, K_FOREVER), 0);
+	}
+
+	zassert_equal(atomic_get(&pool_runs), POOL_WORKERS);
+	zassert_equal(k_work_queue_drain(&pool_queue, false), 0);
+}
+
+/* An item resubmitted while running is not started by an idle worker
+ * until its handler returns.
+ */
+ZTEST(work_pool, test_pool_no_reentrancy)
+{
+	struct k_work *work = &pool_work[0];
+
+	zassert_equal(k_work_submit_to_queue(&pool_queue, work), 1);
+	k_sleep(SETTLE_TIME);
+	zassert_equal(k_work_busy_get(work), K_WORK_RUNNING);
+
+	/* Requeued to the queue running it, but must not start yet */
+	zassert_equal(k_work_submit_to_queue(&pool_queue, work), 2);
+	k_sleep(SETTLE_TIME);
+	zassert_equal(atomic_get(&pool_running), 1);
+	zassert_equal(k_work_busy_get(work), K_WORK_RUNNING | K_WORK_QUEUED);
+
+	k_sem_give(&pool_rel_sem);
+	zassert_equal(k_sem_take(&pool_done_sem, K_FOREVER), 0);
+
+	k_sleep(SETTLE_TIME);
+	zassert_equal(k_work_busy_get(work), K_WORK_RUNNING);
+
+	k_sem_give(&pool_rel_sem);
+	zassert_equal(k_sem_take(&pool_done_sem, K_FOREVER), 0);
+
+	zassert_equal(atomic_get(&pool_runs), 2);
+	zassert_equal(atomic_get(&pool_max_running), 1);
+	zassert_equal(k_work_queue_drain(&pool_queue, false), 0);
+}
+
+/* Flushing a running item waits for it even though other workers are
+ * idle and could process the flush immediately.
+ */
+ZTEST(work_pool, test_pool_running_flush)
+{
+	struct k_work *work = &pool_work[0];
+
+	zassert_equal(k_work_submit_to_queue(&pool_queue, work), 1);
+	k_sleep(SETTLE_TIME);
+	zassert_equal(k_work_busy_get(work), K_WORK_RUNNING);
+
+	k_timer_start(&pool_releaser, SETTLE_TIME, K_NO_WAIT);
+	zassert_true(k_work_flush(work, &pool_sync));
+	zassert_equal(atomic_get(&pool_runs), 1);
+
+	zassert_equal(k_sem_take(&pool_done_sem, K_FOREVER), 0);
+	zassert_equal(k_work_queue_drain(&pool_queue, false), 0);
+}
+
+ZTEST_SUITE(work_pool, NULL, pool_setup, pool_before, NULL, NULL);